@@ -315,6 +315,11 @@ NORETURN void sched_task_exit(void)
     print_stack_usage_metric(me->name, me->stack_start, me->stack_size);
 #endif
 
+#if defined(MODULE_MALLOC_THREAD_SAFE) && defined(MODULE_MALLOC_THREAD_CACHE)
+    void thread_cache_exit(void);
+    thread_cache_exit();
+#endif
+
     (void)irq_disable();
     sched_threads[thread_getpid()] = NULL;
     sched_num_threads--;
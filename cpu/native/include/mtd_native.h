@@ -26,10 +26,43 @@ extern "C" {
 
 #include "mtd.h"
 
+/**
+ * @name    Emulated access latency
+ *
+ * The backing file is memory mapped, so accesses are a lot faster than on
+ * real flash. To emulate the timing of a real device (e.g. to test timeouts
+ * of file systems), each operation can be delayed by a fixed amount.
+ * @{
+ */
+/**
+ * @brief   Delay of each read in microseconds
+ */
+#ifndef CONFIG_MTD_NATIVE_READ_LATENCY_US
+#define CONFIG_MTD_NATIVE_READ_LATENCY_US       (0)
+#endif
+
+/**
+ * @brief   Delay of each page (or part of a page) written in microseconds
+ */
+#ifndef CONFIG_MTD_NATIVE_WRITE_LATENCY_US
+#define CONFIG_MTD_NATIVE_WRITE_LATENCY_US      (0)
+#endif
+
+/**
+ * @brief   Delay of each sector erased in microseconds
+ */
+#ifndef CONFIG_MTD_NATIVE_ERASE_LATENCY_US
+#define CONFIG_MTD_NATIVE_ERASE_LATENCY_US      (0)
+#endif
+/** @} */
+
 /** mtd native descriptor */
 typedef struct mtd_native_dev {
     mtd_dev_t base;     /**< mtd generic device */
     const char *fname;  /**< filename to use for memory emulation */
+    uint8_t *mem;       /**< memory mapping of @ref mtd_native_dev_t::fname,
+                         *   set up by the driver's init function */
+    size_t mem_size;    /**< size of @ref mtd_native_dev_t::mem */
 } mtd_native_dev_t;
 
 /**
@@ -96,6 +96,11 @@ extern off_t (*real_lseek)(int fd, off_t offset, int whence);
 extern off_t (*real_fstat)(int fd, struct stat *statbuf);
 extern int (*real_statvfs)(const char *restrict path, struct statvfs *restrict buf);
 extern int (*real_fsync)(int fd);
+extern int (*real_ftruncate)(int fd, off_t length);
+extern void *(*real_mmap)(void *addr, size_t length, int prot, int flags,
+                          int fd, off_t offset);
+extern int (*real_munmap)(void *addr, size_t length);
+extern int (*real_nanosleep)(const struct timespec *req, struct timespec *rem);
 extern size_t (*real_fread)(void *ptr, size_t size, size_t nmemb, FILE *stream);
 extern void (*real_clearerr)(FILE *stream);
 extern __attribute__((noreturn)) void (*real_exit)(int status);
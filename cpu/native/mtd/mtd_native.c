@@ -16,42 +16,103 @@
  */
 
 #include <errno.h>
+#include <fcntl.h>
 #include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
 #include "macros/utils.h"
 #include "mtd.h"
 #include "mtd_native.h"
 #include "native_internal.h"
+#include "timex.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+static void _delay(uint32_t us)
+{
+    if (us == 0) {
+        return;
+    }
+
+    struct timespec ts = {
+        .tv_sec = us / US_PER_SEC,
+        .tv_nsec = (us % US_PER_SEC) * NS_PER_US,
+    };
+
+    /* like real flash, the emulated access blocks the CPU */
+    _native_syscall_enter();
+    while ((real_nanosleep(&ts, &ts) != 0) && (errno == EINTR)) {}
+    _native_syscall_leave();
+}
+
+/* NOR flash semantics: a write can only clear bits */
+static void _program(uint8_t *dst, const uint8_t *src, size_t size)
+{
+    for (size_t i = 0; i < size; i++) {
+        dst[i] &= src[i];
+    }
+}
+
 static int _init(mtd_dev_t *dev)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
+    size_t sector_size = dev->pages_per_sector * dev->page_size;
+    size_t size = dev->sector_count * sector_size;
+    bool created = false;
+    struct stat st;
 
     DEBUG("mtd_native: init, filename=%s\n", _dev->fname);
 
-    FILE *f = real_fopen(_dev->fname, "r");
+    if (_dev->mem) {
+        real_munmap(_dev->mem, _dev->mem_size);
+        _dev->mem = NULL;
+    }
+
+    int fd = real_open(_dev->fname, O_RDWR);
 
-    if (!f) {
+    if (fd < 0) {
         DEBUG("mtd_native: init: creating file %s\n", _dev->fname);
-        f = real_fopen(_dev->fname, "w+");
-        if (!f) {
+        fd = real_open(_dev->fname, O_RDWR | O_CREAT, 0644);
+        if (fd < 0) {
             return -EIO;
         }
-        size_t size = dev->sector_count * dev->pages_per_sector * dev->page_size;
-        for (size_t i = 0; i < size; i++) {
-            real_fputc(0xff, f);
+        if (real_ftruncate(fd, size) != 0) {
+            real_close(fd);
+            return -EIO;
         }
-    } else {
-        real_fseek(f, 0, SEEK_END);
-        size_t size = real_ftell(f);
-        dev->sector_count = size / (dev->pages_per_sector * dev->page_size);
+        created = true;
+    }
+    else {
+        if (real_fstat(fd, &st) != 0) {
+            real_close(fd);
+            return -EIO;
+        }
+        dev->sector_count = st.st_size / sector_size;
+        size = dev->sector_count * sector_size;
+    }
+
+    if (size == 0) {
+        real_close(fd);
+        return -EIO;
+    }
+
+    void *mem = real_mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+    /* the mapping stays valid after closing the file */
+    real_close(fd);
+    if (mem == MAP_FAILED) {
+        return -EIO;
     }
 
-    real_fclose(f);
+    _dev->mem = mem;
+    _dev->mem_size = size;
+    if (created) {
+        memset(_dev->mem, 0xff, size);
+    }
 
     return 0;
 }
@@ -59,50 +120,51 @@ static int _init(mtd_dev_t *dev)
 static int _read(mtd_dev_t *dev, void *buff, uint32_t addr, uint32_t size)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
-    size_t mtd_size = dev->sector_count * dev->pages_per_sector * dev->page_size;
 
     DEBUG("mtd_native: read from page %" PRIu32 " count %" PRIu32 "\n", addr, size);
 
-    if (addr + size > mtd_size) {
+    if (((uint64_t)addr + size) > _dev->mem_size) {
         return -EOVERFLOW;
     }
 
-    FILE *f = real_fopen(_dev->fname, "r");
-    if (!f) {
-        return -EIO;
+    memcpy(buff, &_dev->mem[addr], size);
+    _delay(CONFIG_MTD_NATIVE_READ_LATENCY_US);
+
+    return 0;
+}
+
+static int _read_page(mtd_dev_t *dev, void *buff, uint32_t page, uint32_t offset,
+                      uint32_t size)
+{
+    uint64_t addr = (uint64_t)page * dev->page_size + offset;
+
+    DEBUG("mtd_native: read from page %" PRIu32 ", offset 0x%" PRIx32 " count %" PRIu32 "\n",
+          page, offset, size);
+
+    if (addr > UINT32_MAX) {
+        return -EOVERFLOW;
     }
-    real_fseek(f, addr, SEEK_SET);
-    size_t nread = real_fread(buff, 1, size, f);
-    real_fclose(f);
 
-    return (nread == size) ? 0 : -EIO;
+    int res = _read(dev, buff, addr, size);
+
+    return (res < 0) ? res : (int)size;
 }
 
 static int _write(mtd_dev_t *dev, const void *buff, uint32_t addr, uint32_t size)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
-    size_t mtd_size = dev->sector_count * dev->pages_per_sector * dev->page_size;
 
     DEBUG("mtd_native: write from 0x%" PRIx32 " count %" PRIu32 "\n", addr, size);
 
-    if (addr + size > mtd_size) {
+    if (((uint64_t)addr + size) > _dev->mem_size) {
         return -EOVERFLOW;
     }
     if (((addr % dev->page_size) + size) > dev->page_size) {
         return -EOVERFLOW;
     }
 
-    FILE *f = real_fopen(_dev->fname, "r+");
-    if (!f) {
-        return -EIO;
-    }
-    real_fseek(f, addr, SEEK_SET);
-    for (size_t i = 0; i < size; i++) {
-        uint8_t c = real_fgetc(f);
-        real_fseek(f, -1, SEEK_CUR);
-        real_fputc(c & ((uint8_t*)buff)[i], f);
-    }
-    real_fclose(f);
+    _program(&_dev->mem[addr], buff, size);
+    _delay(CONFIG_MTD_NATIVE_WRITE_LATENCY_US);
 
     return 0;
 }
@@ -111,15 +173,11 @@ static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t
                        uint32_t size)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
-    uint32_t addr = page * dev->page_size + offset;
+    uint64_t addr = (uint64_t)page * dev->page_size + offset;
 
     DEBUG("mtd_native: write from page %" PRIx32 ", offset 0x%" PRIx32 " count %" PRIu32 "\n",
           page, offset, size);
 
-    if (page > dev->sector_count * dev->pages_per_sector) {
-        return -EOVERFLOW;
-    }
-
     if (offset > dev->page_size) {
         return -EOVERFLOW;
     }
@@ -127,47 +185,44 @@ static int _write_page(mtd_dev_t *dev, const void *buff, uint32_t page, uint32_t
     uint32_t remaining = dev->page_size - offset;
     size = MIN(remaining, size);
 
-    FILE *f = real_fopen(_dev->fname, "r+");
-    if (!f) {
-        return -EIO;
-    }
-    real_fseek(f, addr, SEEK_SET);
-    for (size_t i = 0; i < size; i++) {
-        uint8_t c = real_fgetc(f);
-        real_fseek(f, -1, SEEK_CUR);
-        real_fputc(c & ((uint8_t*)buff)[i], f);
+    if ((addr + size) > _dev->mem_size) {
+        return -EOVERFLOW;
     }
-    real_fclose(f);
+
+    _program(&_dev->mem[addr], buff, size);
+    _delay(CONFIG_MTD_NATIVE_WRITE_LATENCY_US);
 
     return size;
 }
 
-static int _erase(mtd_dev_t *dev, uint32_t addr, uint32_t size)
+static int _erase_sector(mtd_dev_t *dev, uint32_t sector, uint32_t count)
 {
     mtd_native_dev_t *_dev = (mtd_native_dev_t*) dev;
-    size_t mtd_size = dev->sector_count * dev->pages_per_sector * dev->page_size;
     size_t sector_size = dev->pages_per_sector * dev->page_size;
 
-    DEBUG("mtd_native: erase from sector %" PRIu32 " count %" PRIu32 "\n", addr, size);
+    DEBUG("mtd_native: erase from sector %" PRIu32 " count %" PRIu32 "\n", sector, count);
 
-    if (addr + size > mtd_size) {
+    if (((uint64_t)sector + count) > dev->sector_count) {
         return -EOVERFLOW;
     }
+
+    memset(&_dev->mem[sector * sector_size], 0xff, count * sector_size);
+    _delay(count * CONFIG_MTD_NATIVE_ERASE_LATENCY_US);
+
+    return 0;
+}
+
+static int _erase(mtd_dev_t *dev, uint32_t addr, uint32_t size)
+{
+    size_t sector_size = dev->pages_per_sector * dev->page_size;
+
+    DEBUG("mtd_native: erase from address 0x%" PRIx32 " count %" PRIu32 "\n", addr, size);
+
     if (((addr % sector_size) != 0) || ((size % sector_size) != 0)) {
         return -EOVERFLOW;
     }
 
-    FILE *f = real_fopen(_dev->fname, "r+");
-    if (!f) {
-        return -EIO;
-    }
-    real_fseek(f, addr, SEEK_SET);
-    for (size_t i = 0; i < size; i++) {
-        real_fputc(0xff, f);
-    }
-    real_fclose(f);
-
-    return 0;
+    return _erase_sector(dev, addr / sector_size, size / sector_size);
 }
 
 static int _power(mtd_dev_t *dev, enum mtd_power_state power)
@@ -180,11 +235,14 @@ static int _power(mtd_dev_t *dev, enum mtd_power_state power)
 
 const mtd_desc_t native_flash_driver = {
     .read = _read,
+    .read_page = _read_page,
     .power = _power,
     .write = _write,
     .write_page = _write_page,
     .erase = _erase,
+    .erase_sector = _erase_sector,
     .init = _init,
+    .flags = MTD_DRIVER_FLAG_CLEARING_OVERWRITE,
 };
 
 /** @} */
@@ -108,6 +108,11 @@ ssize_t (*real_send)(int sockfd, const void *buf, size_t len, int flags);
 off_t (*real_lseek)(int fd, off_t offset, int whence);
 off_t (*real_fstat)(int fd, struct stat *statbuf);
 int (*real_fsync)(int fd);
+int (*real_ftruncate)(int fd, off_t length);
+void *(*real_mmap)(void *addr, size_t length, int prot, int flags,
+                   int fd, off_t offset);
+int (*real_munmap)(void *addr, size_t length);
+int (*real_nanosleep)(const struct timespec *req, struct timespec *rem);
 int (*real_mkdir)(const char *pathname, mode_t mode);
 int (*real_rmdir)(const char *pathname);
 DIR *(*real_opendir)(const char *name);
@@ -564,6 +569,10 @@ void _native_init_syscalls(void)
     *(void **)(&real_lseek) = dlsym(RTLD_NEXT, "lseek");
     *(void **)(&real_fstat) = dlsym(RTLD_NEXT, "fstat");
     *(void **)(&real_fsync) = dlsym(RTLD_NEXT, "fsync");
+    *(void **)(&real_ftruncate) = dlsym(RTLD_NEXT, "ftruncate");
+    *(void **)(&real_mmap) = dlsym(RTLD_NEXT, "mmap");
+    *(void **)(&real_munmap) = dlsym(RTLD_NEXT, "munmap");
+    *(void **)(&real_nanosleep) = dlsym(RTLD_NEXT, "nanosleep");
     *(void **)(&real_rename) = dlsym(RTLD_NEXT, "rename");
     *(void **)(&real_opendir) = dlsym(RTLD_NEXT, "opendir");
     *(void **)(&real_readdir) = dlsym(RTLD_NEXT, "readdir");
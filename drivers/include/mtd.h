@@ -73,6 +73,7 @@
 #ifndef MTD_H
 #define MTD_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -99,6 +100,15 @@ enum mtd_power_state {
  */
 typedef struct mtd_desc mtd_desc_t;
 
+/**
+ * @brief   Statistics of @ref mtd_write_page
+ */
+typedef struct {
+    uint32_t erases;            /**< sectors erased to write data */
+    uint32_t erases_avoided;    /**< partial sector writes that did not need
+                                 *   an erase of their own */
+} mtd_write_page_stats_t;
+
 /**
  * @brief   MTD device descriptor
  *
@@ -113,6 +123,15 @@ typedef struct {
     uint32_t write_size;       /**< Minimum size and alignment of writes to the device */
 #if defined(MODULE_MTD_WRITE_PAGE) || DOXYGEN
     void *work_area;           /**< sector-sized buffer (only present when @ref mtd_write_page is enabled) */
+    mtd_write_page_stats_t write_page_stats;    /**< statistics of @ref mtd_write_page */
+#endif
+#if defined(MODULE_MTD_WRITE_PAGE_CACHE) || DOXYGEN
+    uint32_t cache_sector;      /**< sector held in mtd_dev_t::work_area */
+    uint32_t cache_dirty_start; /**< start of the modified region in the cached sector */
+    uint32_t cache_dirty_end;   /**< end of the modified region in the cached sector,
+                                 *   0 if the cache is clean */
+    bool cache_valid;           /**< mtd_dev_t::cache_sector is valid */
+    bool cache_needs_erase;     /**< the cached sector must be erased on flush */
 #endif
 } mtd_dev_t;
 
@@ -391,7 +410,15 @@ int mtd_write_page_raw(mtd_dev_t *mtd, const void *src, uint32_t page,
  * writes if it is required by the underlying storage media.
  *
  * If the underlying sector needs to be erased before it can be written, the MTD
- * layer will take care of the read-modify-write operation.
+ * layer will take care of the read-modify-write operation. If the driver has
+ * @ref MTD_DRIVER_FLAG_CLEARING_OVERWRITE set and the write only clears bits
+ * (e.g. appending to erased memory), the data is written without erasing the
+ * sector.
+ *
+ * With the `mtd_write_page_cache` module, partial writes are collected in a
+ * sector sized write-back cache and only written to the device when a
+ * different sector is written, on @ref mtd_flush or on power down. Reads
+ * through the MTD layer see the cached data.
  *
  * @p offset must be smaller than the page size
  *
@@ -462,6 +489,19 @@ int mtd_erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t num);
  */
 int mtd_power(mtd_dev_t *mtd, enum mtd_power_state power);
 
+/**
+ * @brief   Write data cached by @ref mtd_write_page to the device
+ *
+ * This is a no-op unless the `mtd_write_page_cache` module is used.
+ *
+ * @param      mtd   the device to flush
+ *
+ * @return 0 on success
+ * @return < 0 if an error occurred writing the cached data
+ * @return -ENODEV if @p mtd is not a valid device
+ */
+int mtd_flush(mtd_dev_t *mtd);
+
 #ifdef __cplusplus
 }
 #endif
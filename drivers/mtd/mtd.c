@@ -27,6 +27,7 @@
 #include <string.h>
 
 #include "bitarithm.h"
+#include "macros/utils.h"
 #include "mtd.h"
 
 static bool out_of_bounds(mtd_dev_t *mtd, uint32_t page, uint32_t offset, uint32_t len)
@@ -46,6 +47,83 @@ static bool out_of_bounds(mtd_dev_t *mtd, uint32_t page, uint32_t offset, uint32
     return false;
 }
 
+#ifdef MODULE_MTD_WRITE_PAGE_CACHE
+static int _cache_flush(mtd_dev_t *mtd);
+
+/* copies modified data of the cached sector overlapping [addr, addr + count)
+ * to dest */
+static void _cache_overlay(mtd_dev_t *mtd, void *dest, uint64_t addr, uint32_t count)
+{
+    if (!mtd->cache_valid || (mtd->cache_dirty_end == 0)) {
+        return;
+    }
+
+    const uint64_t base = (uint64_t)mtd->cache_sector
+                        * mtd->pages_per_sector * mtd->page_size;
+    const uint64_t start = MAX(base + mtd->cache_dirty_start, addr);
+    const uint64_t end = MIN(base + mtd->cache_dirty_end, addr + count);
+
+    if (start < end) {
+        memcpy((uint8_t *)dest + (start - addr),
+               (uint8_t *)mtd->work_area + (start - base), end - start);
+    }
+}
+
+/* flushes and invalidates the cache if the cached sector is written to
+ * bypassing it */
+static int _cache_sync(mtd_dev_t *mtd, uint64_t addr, uint32_t count)
+{
+    if (!mtd->cache_valid) {
+        return 0;
+    }
+
+    const uint32_t sector_size = mtd->pages_per_sector * mtd->page_size;
+    const uint64_t base = (uint64_t)mtd->cache_sector * sector_size;
+
+    if ((addr >= (base + sector_size)) || ((addr + count) <= base)) {
+        return 0;
+    }
+
+    int res = _cache_flush(mtd);
+    mtd->cache_valid = false;
+
+    return res;
+}
+
+/* drops the cache if the cached sector is erased */
+static void _cache_drop(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    if (mtd->cache_valid && (mtd->cache_sector >= sector) &&
+        ((mtd->cache_sector - sector) < count)) {
+        mtd->cache_valid = false;
+    }
+}
+#else
+static inline void _cache_overlay(mtd_dev_t *mtd, void *dest, uint64_t addr,
+                                  uint32_t count)
+{
+    (void)mtd;
+    (void)dest;
+    (void)addr;
+    (void)count;
+}
+
+static inline int _cache_sync(mtd_dev_t *mtd, uint64_t addr, uint32_t count)
+{
+    (void)mtd;
+    (void)addr;
+    (void)count;
+    return 0;
+}
+
+static inline void _cache_drop(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    (void)mtd;
+    (void)sector;
+    (void)count;
+}
+#endif
+
 int mtd_init(mtd_dev_t *mtd)
 {
     if (!mtd || !mtd->driver) {
@@ -77,6 +155,11 @@ int mtd_init(mtd_dev_t *mtd)
             res = -ENOMEM;
         }
     }
+    memset(&mtd->write_page_stats, 0, sizeof(mtd->write_page_stats));
+#endif
+#ifdef MODULE_MTD_WRITE_PAGE_CACHE
+    mtd->cache_valid = false;
+    mtd->cache_dirty_end = 0;
 #endif
 
     return res;
@@ -93,7 +176,11 @@ int mtd_read(mtd_dev_t *mtd, void *dest, uint32_t addr, uint32_t count)
     }
 
     if (mtd->driver->read) {
-        return mtd->driver->read(mtd, dest, addr, count);
+        int res = mtd->driver->read(mtd, dest, addr, count);
+        if (res == 0) {
+            _cache_overlay(mtd, dest, addr, count);
+        }
+        return res;
     }
 
     /* page size is always a power of two */
@@ -117,7 +204,11 @@ int mtd_read_page(mtd_dev_t *mtd, void *dest, uint32_t page, uint32_t offset,
     if (mtd->driver->read_page == NULL) {
         /* TODO: remove when all backends implement read_page */
         if (mtd->driver->read) {
-            return mtd->driver->read(mtd, dest, mtd->page_size * page + offset, count);
+            int res = mtd->driver->read(mtd, dest, mtd->page_size * page + offset, count);
+            if (res == 0) {
+                _cache_overlay(mtd, dest, (uint64_t)mtd->page_size * page + offset, count);
+            }
+            return res;
         } else {
             return -ENOTSUP;
         }
@@ -137,6 +228,8 @@ int mtd_read_page(mtd_dev_t *mtd, void *dest, uint32_t page, uint32_t offset,
     offset = offset & page_mask;
 
     char *_dst = dest;
+    const uint64_t addr = ((uint64_t)page << page_shift) + offset;
+    const uint32_t len = count;
 
     while (count) {
         int read_bytes = mtd->driver->read_page(mtd, _dst, page, offset, count);
@@ -156,6 +249,8 @@ int mtd_read_page(mtd_dev_t *mtd, void *dest, uint32_t page, uint32_t offset,
         offset  = (offset + read_bytes) & page_mask;
     }
 
+    _cache_overlay(mtd, dest, addr, len);
+
     return 0;
 }
 
@@ -170,6 +265,10 @@ int mtd_write(mtd_dev_t *mtd, const void *src, uint32_t addr, uint32_t count)
     }
 
     if (mtd->driver->write) {
+        int res = _cache_sync(mtd, addr, count);
+        if (res < 0) {
+            return res;
+        }
         return mtd->driver->write(mtd, src, addr, count);
     }
 
@@ -181,42 +280,187 @@ int mtd_write(mtd_dev_t *mtd, const void *src, uint32_t addr, uint32_t count)
 }
 
 #ifdef MODULE_MTD_WRITE_PAGE
+/* checks whether programming data over the current content results in data,
+ * i.e. the write only clears bits */
+static bool _only_clears_bits(const uint8_t *cur, const uint8_t *data, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++) {
+        if ((cur[i] & data[i]) != data[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* widens [*start, *end) to the write size alignment of the device */
+static void _align_to_write_size(const mtd_dev_t *mtd, uint32_t *start, uint32_t *end)
+{
+    *start -= *start % mtd->write_size;
+    *end += (mtd->write_size - (*end % mtd->write_size)) % mtd->write_size;
+}
+
+/* erases a sector and writes it completely from data */
+static int _rewrite_sector(mtd_dev_t *mtd, const void *data, uint32_t sector)
+{
+    const uint32_t sector_page = sector * mtd->pages_per_sector;
+    const uint32_t sector_size = mtd->pages_per_sector * mtd->page_size;
+
+    int res = mtd_erase_sector(mtd, sector, 1);
+    if (res < 0) {
+        return res;
+    }
+    mtd->write_page_stats.erases++;
+
+    return mtd_write_page_raw(mtd, data, sector_page, 0, sector_size);
+}
+
+#ifdef MODULE_MTD_WRITE_PAGE_CACHE
+static int _cache_flush(mtd_dev_t *mtd)
+{
+    if (!mtd->cache_valid || (mtd->cache_dirty_end == 0)) {
+        return 0;
+    }
+
+    const uint32_t sector_page = mtd->cache_sector * mtd->pages_per_sector;
+    const uint32_t start = mtd->cache_dirty_start;
+    const uint32_t end = mtd->cache_dirty_end;
+    uint8_t *work = mtd->work_area;
+    int res;
+
+    /* keeps the erase and write below from flushing or dropping the cache */
+    mtd->cache_valid = false;
+    mtd->cache_dirty_end = 0;
+
+    if (mtd->cache_needs_erase) {
+        res = _rewrite_sector(mtd, work, mtd->cache_sector);
+    }
+    else {
+        res = mtd_write_page_raw(mtd, work + start, sector_page, start, end - start);
+    }
+    if (res < 0) {
+        return res;
+    }
+
+    mtd->cache_valid = true;
+    mtd->cache_needs_erase = false;
+
+    return 0;
+}
+
+/**
+ * @brief   Write to a sector through the write-back cache
+ *
+ *          The sector is read into the cache if it isn't cached already. The
+ *          data is only written to the device when the cache is flushed.
+ *
+ * @param[in]  mtd      Pointer to the selected device
+ * @param[in]  data     Pointer to the data to be written
+ * @param[in]  sector   Sector to write
+ * @param[in]  offset   Byte offset from the start of the sector
+ * @param[in]  len      Number of bytes
+ *
+ * @return bytes written on success
+ * @return < 0 value on error
+ */
+static int _write_sector_partial(mtd_dev_t *mtd, const void *data, uint32_t sector,
+                                 uint32_t offset, uint32_t len)
+{
+    uint8_t *work = mtd->work_area;
+    uint32_t start = offset;
+    uint32_t end = offset + len;
+    int res;
+
+    if (!mtd->cache_valid || (mtd->cache_sector != sector)) {
+        const uint32_t sector_size = mtd->pages_per_sector * mtd->page_size;
+
+        res = _cache_flush(mtd);
+        if (res < 0) {
+            return res;
+        }
+        mtd->cache_valid = false;
+        res = mtd_read_page(mtd, work, sector * mtd->pages_per_sector, 0, sector_size);
+        if (res < 0) {
+            return res;
+        }
+        mtd->cache_sector = sector;
+        mtd->cache_needs_erase = false;
+        mtd->cache_valid = true;
+    }
+
+    if (!mtd->cache_needs_erase &&
+        (mtd->driver->flags & MTD_DRIVER_FLAG_CLEARING_OVERWRITE) &&
+        _only_clears_bits(work + offset, data, len)) {
+        mtd->write_page_stats.erases_avoided++;
+    }
+    else if (mtd->cache_needs_erase) {
+        /* coalesced with an earlier write that needs the erase anyway */
+        mtd->write_page_stats.erases_avoided++;
+    }
+    else {
+        mtd->cache_needs_erase = true;
+    }
+
+    memcpy(work + offset, data, len);
+
+    _align_to_write_size(mtd, &start, &end);
+    if (mtd->cache_dirty_end == 0) {
+        mtd->cache_dirty_start = start;
+        mtd->cache_dirty_end = end;
+    }
+    else {
+        mtd->cache_dirty_start = MIN(mtd->cache_dirty_start, start);
+        mtd->cache_dirty_end = MAX(mtd->cache_dirty_end, end);
+    }
+
+    return len;
+}
+#else
 /**
- * @brief   Write to a sector on a Memory Technology Device (MTD) by performing a
- *          read-modify-write cycle.
+ * @brief   Write to a part of a sector on a Memory Technology Device (MTD)
  *
- *          This reads the sector into RAM, modifies it, clears the sector on the
- *          device and writes it back from RAM.
+ *          If the driver allows clearing overwrites and the write only clears
+ *          bits, the data is written directly. Otherwise this performs a
+ *          read-modify-write cycle: The sector is read into RAM, modified,
+ *          erased on the device and written back from RAM.
  *
  * @param[in]  mtd      Pointer to the selected device
  * @param[in]  data     Pointer to the data to be written
  * @param[in]  sector   Sector to write
  * @param[in]  offset   Byte offset from the start of the sector
- * @param[in]  size     Number of bytes
+ * @param[in]  len      Number of bytes
  *
  * @return bytes written on success
  * @return < 0 value on error
  */
-static size_t _write_sector(mtd_dev_t *mtd, const void *data, uint32_t sector,
-                            uint32_t offset, uint32_t len)
+static int _write_sector_partial(mtd_dev_t *mtd, const void *data, uint32_t sector,
+                                 uint32_t offset, uint32_t len)
 {
     int res;
     uint8_t *work = mtd->work_area;
     const uint32_t sector_page = sector * mtd->pages_per_sector;
     const uint32_t sector_size = mtd->pages_per_sector * mtd->page_size;
 
-    if (offset >= sector_size) {
-        return len;
-    }
+    if (mtd->driver->flags & MTD_DRIVER_FLAG_CLEARING_OVERWRITE) {
+        uint32_t start = offset;
+        uint32_t end = offset + len;
 
-    if (offset + len > sector_size) {
-        len = sector_size - offset;
-    }
+        /* only read what is about to be written */
+        _align_to_write_size(mtd, &start, &end);
+        res = mtd_read_page(mtd, work + start, sector_page, start, end - start);
+        if (res < 0) {
+            return res;
+        }
 
-    /* fast path: skip reading the sector if we overwrite it completely */
-    if (offset == 0 && len == sector_size) {
-        work = (void *)data;
-        goto write;
+        if (_only_clears_bits(work + offset, data, len)) {
+            memcpy(work + offset, data, len);
+            res = mtd_write_page_raw(mtd, work + start, sector_page, start, end - start);
+            if (res < 0) {
+                return res;
+            }
+            mtd->write_page_stats.erases_avoided++;
+            return len;
+        }
     }
 
     /* copy sector to RAM */
@@ -225,18 +469,53 @@ static size_t _write_sector(mtd_dev_t *mtd, const void *data, uint32_t sector,
         return res;
     }
 
-    /* erase sector */
-    res = mtd_erase_sector(mtd, sector, 1);
+    /* modify sector in RAM */
+    memcpy(work + offset, data, len);
+
+    /* erase sector and write back modified sector copy */
+    res = _rewrite_sector(mtd, work, sector);
     if (res < 0) {
         return res;
     }
 
-    /* modify sector in RAM */
-    memcpy(work + offset, data, len);
+    return len;
+}
+#endif
 
-write:
-    /* write back modified sector copy */
-    res = mtd_write_page_raw(mtd, work, sector_page, 0, sector_size);
+/**
+ * @brief   Write to a sector on a Memory Technology Device (MTD), erasing it
+ *          if needed
+ *
+ * @param[in]  mtd      Pointer to the selected device
+ * @param[in]  data     Pointer to the data to be written
+ * @param[in]  sector   Sector to write
+ * @param[in]  offset   Byte offset from the start of the sector
+ * @param[in]  len      Number of bytes
+ *
+ * @return bytes written on success
+ * @return < 0 value on error
+ */
+static int _write_sector(mtd_dev_t *mtd, const void *data, uint32_t sector,
+                         uint32_t offset, uint32_t len)
+{
+    int res;
+    const uint32_t sector_size = mtd->pages_per_sector * mtd->page_size;
+
+    if (offset >= sector_size) {
+        return len;
+    }
+
+    if (offset + len > sector_size) {
+        len = sector_size - offset;
+    }
+
+    if (offset != 0 || len != sector_size) {
+        return _write_sector_partial(mtd, data, sector, offset, len);
+    }
+
+    /* fast path: skip reading the sector if we overwrite it completely */
+    _cache_drop(mtd, sector, 1);
+    res = _rewrite_sector(mtd, data, sector);
     if (res < 0) {
         return res;
     }
@@ -292,6 +571,11 @@ int mtd_write_page_raw(mtd_dev_t *mtd, const void *src, uint32_t page, uint32_t
         return -EOVERFLOW;
     }
 
+    int res = _cache_sync(mtd, (uint64_t)mtd->page_size * page + offset, count);
+    if (res < 0) {
+        return res;
+    }
+
     if (mtd->driver->write_page == NULL) {
         /* TODO: remove when all backends implement write_page */
         if (mtd->driver->write) {
@@ -343,12 +627,17 @@ int mtd_erase(mtd_dev_t *mtd, uint32_t addr, uint32_t count)
         return -ENODEV;
     }
 
+    uint32_t sector_size = mtd->pages_per_sector * mtd->page_size;
+
     if (mtd->driver->erase) {
-        return mtd->driver->erase(mtd, addr, count);
+        int res = mtd->driver->erase(mtd, addr, count);
+        if ((res == 0) && count) {
+            _cache_drop(mtd, addr / sector_size,
+                        (addr + count - 1) / sector_size - addr / sector_size + 1);
+        }
+        return res;
     }
 
-    uint32_t sector_size = mtd->pages_per_sector * mtd->page_size;
-
     if (count % sector_size) {
         return -EOVERFLOW;
     }
@@ -374,19 +663,28 @@ int mtd_erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
         return -EOVERFLOW;
     }
 
+    int res;
+
     if (mtd->driver->erase_sector == NULL) {
         /* TODO: remove when all backends implement erase_sector */
         if (mtd->driver->erase) {
             uint32_t sector_size = mtd->pages_per_sector * mtd->page_size;
-            return mtd->driver->erase(mtd,
-                                      sector * sector_size,
-                                      count * sector_size);
+            res = mtd->driver->erase(mtd,
+                                     sector * sector_size,
+                                     count * sector_size);
         } else {
             return -ENOTSUP;
         }
     }
+    else {
+        res = mtd->driver->erase_sector(mtd, sector, count);
+    }
 
-    return mtd->driver->erase_sector(mtd, sector, count);
+    if (res == 0) {
+        _cache_drop(mtd, sector, count);
+    }
+
+    return res;
 }
 
 int mtd_power(mtd_dev_t *mtd, enum mtd_power_state power)
@@ -395,6 +693,13 @@ int mtd_power(mtd_dev_t *mtd, enum mtd_power_state power)
         return -ENODEV;
     }
 
+    if (power == MTD_POWER_DOWN) {
+        int res = mtd_flush(mtd);
+        if (res < 0) {
+            return res;
+        }
+    }
+
     if (mtd->driver->power) {
         return mtd->driver->power(mtd, power);
     }
@@ -403,4 +708,17 @@ int mtd_power(mtd_dev_t *mtd, enum mtd_power_state power)
     }
 }
 
+int mtd_flush(mtd_dev_t *mtd)
+{
+    if (!mtd || !mtd->driver) {
+        return -ENODEV;
+    }
+
+#ifdef MODULE_MTD_WRITE_PAGE_CACHE
+    return _cache_flush(mtd);
+#else
+    return 0;
+#endif
+}
+
 /** @} */
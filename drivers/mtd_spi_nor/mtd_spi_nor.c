@@ -764,4 +764,5 @@ const mtd_desc_t mtd_spi_nor_driver = {
     .write_page = mtd_spi_nor_write_page,
     .erase = mtd_spi_nor_erase,
     .power = mtd_spi_nor_power,
+    .flags = MTD_DRIVER_FLAG_CLEARING_OVERWRITE,
 };
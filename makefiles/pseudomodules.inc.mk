@@ -48,7 +48,9 @@ PSEUDOMODULES += cortexm_svc
 PSEUDOMODULES += cpp
 PSEUDOMODULES += cpu_check_address
 PSEUDOMODULES += crc16_fast
+PSEUDOMODULES += crc16_slicing
 PSEUDOMODULES += crc32_fast
+PSEUDOMODULES += crc32_slicing
 PSEUDOMODULES += credman_load
 PSEUDOMODULES += dbgpin
 PSEUDOMODULES += devfs_%
@@ -121,6 +123,14 @@ PSEUDOMODULES += gnrc_netdev_default
 PSEUDOMODULES += gnrc_neterr
 PSEUDOMODULES += gnrc_netapi_callbacks
 PSEUDOMODULES += gnrc_netapi_mbox
+## @defgroup net_gnrc_netreg_hash  gnrc_netreg_hash
+## @ingroup net_gnrc_netreg
+## @brief   Demultiplex via a hash table instead of per-type lists
+##
+## Keeps the cost of @ref gnrc_netreg_lookup() constant with many
+## registered entries (e.g. bound UDP sockets).
+## See @ref CONFIG_GNRC_NETREG_HASH_NUMOF for the size of the table.
+PSEUDOMODULES += gnrc_netreg_hash
 PSEUDOMODULES += gnrc_netif_bus
 PSEUDOMODULES += gnrc_netif_timestamp
 ## @defgroup net_gnrc_pktbuf_cmd  gnrc_pktbuf_cmd
@@ -258,6 +268,19 @@ PSEUDOMODULES += gnrc_sixlowpan_frag_sfr_congure_sfr
 PSEUDOMODULES += gnrc_sixlowpan_iphc_nhc
 PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
+PSEUDOMODULES += gnrc_tcp_congure
+## @defgroup net_gnrc_tcp_congure_reno gnrc_tcp_congure_reno: TCP Reno
+## @ingroup net_gnrc_tcp_congure
+## @brief  Congestion control for GNRC TCP using the [TCP Reno congestion control algorithm](@ref sys_congure_reno)
+## @{
+PSEUDOMODULES += gnrc_tcp_congure_reno
+## @}
+## @defgroup net_gnrc_tcp_congure_quic gnrc_tcp_congure_quic: QUIC CC
+## @ingroup net_gnrc_tcp_congure
+## @brief  Congestion control for GNRC TCP using the [congestion control algorithm of QUIC](@ref sys_congure_quic)
+## @{
+PSEUDOMODULES += gnrc_tcp_congure_quic
+## @}
 ## @defgroup net_gnrc_udp_cmd  gnrc_udp_cmd
 ## @ingroup net_gnrc_udp
 ## @{
@@ -265,6 +288,25 @@ PSEUDOMODULES += gnrc_sixlowpan_router_default
 ##              will be removed after 2023.07 release.
 PSEUDOMODULES += gnrc_udp_cmd
 ## @}
+## @defgroup net_gnrc_udp_fastpath  gnrc_udp_fastpath
+## @ingroup net_gnrc_udp
+## @brief   Deliver received UDP datagrams to sockets without passing
+##          through the IPv6 and UDP threads
+## @{
+##
+## Received datagrams are delivered from the network interface thread (or
+## from the 6LoWPAN thread for 6LoWPAN interfaces), so wakeups of blocking
+## sock_udp_recv() calls and the `gnrc_sock_async` callbacks of the receiving
+## sockets run on the stack of that thread. The stack of these threads is
+## increased by @ref GNRC_UDP_FASTPATH_EXTRA_STACKSIZE.
+##
+## @warning A socket callback must not call gnrc_netapi_get() or
+##          gnrc_netapi_set() on the interface the datagram was received on:
+##          this does a msg_send_receive() to the calling thread itself and
+##          never returns. Defer such work to another thread or an event
+##          queue.
+PSEUDOMODULES += gnrc_udp_fastpath
+## @}
 PSEUDOMODULES += gnrc_sock_async
 PSEUDOMODULES += gnrc_sock_check_reuse
 PSEUDOMODULES += gnrc_txtsnd
@@ -301,6 +343,11 @@ PSEUDOMODULES += lwext4_vfs_format
 ##
 PSEUDOMODULES += libc_gettimeofday
 
+## @defgroup pseudomodule_malloc_thread_cache malloc_thread_cache
+## @brief Serve small allocations from per-thread caches, see
+##        @ref sys_malloc_thread_cache
+PSEUDOMODULES += malloc_thread_cache
+
 ## @defgroup pseudomodule_malloc_tracing malloc_tracing
 ## @brief Debug dynamic memory management by hooking in a print into each call
 ##        of malloc(), calloc(), realloc() and free
@@ -339,6 +386,7 @@ PSEUDOMODULES += pmp_noexec_ram
 PSEUDOMODULES += md5sum
 ## @}
 PSEUDOMODULES += mtd_write_page
+PSEUDOMODULES += mtd_write_page_cache
 PSEUDOMODULES += nanocoap_%
 PSEUDOMODULES += netdev_default
 PSEUDOMODULES += netdev_ieee802154_%
@@ -473,8 +521,10 @@ PSEUDOMODULES += shell_cmd_gnrc_udp
 PSEUDOMODULES += shell_cmd_heap
 PSEUDOMODULES += shell_cmd_i2c_scan
 PSEUDOMODULES += shell_cmd_lwip_netif
+PSEUDOMODULES += shell_cmd_malloc_thread_cache
 PSEUDOMODULES += shell_cmd_mci
 PSEUDOMODULES += shell_cmd_md5sum
+PSEUDOMODULES += shell_cmd_nanocoap_cache
 PSEUDOMODULES += shell_cmd_nanocoap_vfs
 PSEUDOMODULES += shell_cmd_netstats_neighbor
 PSEUDOMODULES += shell_cmd_nice
@@ -537,6 +587,12 @@ PSEUDOMODULES += stm32_eth_auto
 PSEUDOMODULES += stm32_eth_link_up
 PSEUDOMODULES += stm32_eth_tracing
 PSEUDOMODULES += stm32mp1_eng_mode
+## @defgroup pseudomodule_suit_pipeline suit_pipeline
+## @brief Store fetched SUIT payload chunks in a separate thread
+##
+## Overlaps fetching the next chunk of a payload with digesting and writing
+## the previous one, see @ref sys_suit_pipeline.
+PSEUDOMODULES += suit_pipeline
 PSEUDOMODULES += suit_transport_%
 PSEUDOMODULES += suit_storage_%
 PSEUDOMODULES += sys_bus_%
@@ -577,6 +633,14 @@ PSEUDOMODULES += vfs_auto_mount
 ## backends.
 PSEUDOMODULES += vfs_default
 
+## @defgroup pseudomodule_vfs_stat_cache vfs_stat_cache
+## @brief Cache the results of vfs_stat()
+##
+## When this module is active, the results of the last
+## @ref CONFIG_VFS_STAT_CACHE_SIZE calls to vfs_stat() are cached until a file
+## on the same mount is written, created, renamed or removed.
+PSEUDOMODULES += vfs_stat_cache
+
 PSEUDOMODULES += wakaama_objects_%
 PSEUDOMODULES += wifi_enterprise
 PSEUDOMODULES += xtimer_on_ztimer
@@ -634,6 +698,8 @@ PSEUDOMODULES += crypto_aes_256
 PSEUDOMODULES += crypto_aes_precalculated
 # This pseudomodule causes a loop in AES to be unrolled (more flash, less CPU)
 PSEUDOMODULES += crypto_aes_unroll
+# Constant-time bitsliced AES instead of the table based implementation
+PSEUDOMODULES += crypto_aes_bitsliced
 
 # declare shell version of test_utils_interactive_sync
 PSEUDOMODULES += test_utils_interactive_sync_shell
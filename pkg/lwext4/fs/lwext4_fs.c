@@ -420,7 +420,13 @@ static int _fstat(vfs_file_t *filp, struct stat *buf)
 
 static int _fsync(vfs_file_t *filp)
 {
-    return -ext4_cache_flush(filp->mp->mount_point);
+    lwext4_desc_t *fs = filp->mp->private_data;
+    int res = -ext4_cache_flush(filp->mp->mount_point);
+
+    if (res < 0) {
+        return res;
+    }
+    return mtd_flush(fs->dev);
 }
 
 static int _close(vfs_file_t *filp)
@@ -54,7 +54,11 @@
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 static char _stack[LWIP_NETDEV_STACKSIZE];
 static msg_t _queue[LWIP_NETDEV_QUEUE_LEN];
-static char _tmp_buf[LWIP_NETDEV_BUFLEN];
+
+/* netdev's recv() writes a contiguous buffer, so every frame accepted has to
+ * fit into a single pool pbuf */
+static_assert(PBUF_POOL_BUFSIZE >= LWIP_NETDEV_BUFLEN,
+              "PBUF_POOL_BUFSIZE must be at least LWIP_NETDEV_BUFLEN");
 
 #ifdef MODULE_NETDEV_ETH
 static err_t _eth_link_output(struct netif *netif, struct pbuf *p);
@@ -257,26 +261,63 @@ static err_t _ieee802154_link_output(struct netif *netif, struct pbuf *p)
 }
 #endif
 
+static struct pbuf *_alloc_rx_pbuf(u16_t len)
+{
+    struct pbuf *p = pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
+
+    if (p == NULL) {
+        /* pool exhausted */
+        p = pbuf_alloc(PBUF_RAW, len, PBUF_RAM);
+    }
+    LWIP_ASSERT("p->next == NULL", (p == NULL) || (p->next == NULL));
+    return p;
+}
+
 static struct pbuf *_get_recv_pkt(netdev_t *dev)
 {
     lwip_netif_t *compat_netif = dev->context;
     struct netif *netif = &compat_netif->lwip_netif;
+    struct pbuf *p = NULL;
+    int len, res;
+
     lwip_netif_dev_acquire(netif);
-    int len = dev->driver->recv(dev, _tmp_buf, sizeof(_tmp_buf), NULL);
-    lwip_netif_dev_release(netif);
+    len = dev->driver->recv(dev, NULL, 0, NULL);
 
-    if (len < 0) {
-        DEBUG("lwip_netdev: an error occurred while reading the packet\n");
-        return NULL;
+    if (len == 0) {
+        /* nothing to receive */
+        goto out;
+    }
+    if ((len < 0) || (len > LWIP_NETDEV_BUFLEN)) {
+        DEBUG("lwip_netdev: invalid frame length %d\n", len);
+        if (len > 0) {
+            dev->driver->recv(dev, NULL, len, NULL);
+        }
+        compat_netif->rx_stats.dropped++;
+        goto out;
     }
-    assert(((unsigned)len) <= UINT16_MAX);
-    struct pbuf *p = pbuf_alloc(PBUF_RAW, (u16_t)len, PBUF_POOL);
 
+    p = _alloc_rx_pbuf((u16_t)len);
     if (p == NULL) {
         DEBUG("lwip_netdev: can not allocate in pbuf\n");
-        return NULL;
+        dev->driver->recv(dev, NULL, len, NULL);
+        compat_netif->rx_stats.alloc_failed++;
+        goto out;
     }
-    pbuf_take(p, _tmp_buf, len);
+
+    /* the driver writes the frame directly into the pbuf */
+    res = dev->driver->recv(dev, p->payload, len, NULL);
+    if (res < 0) {
+        DEBUG("lwip_netdev: an error occurred while reading the packet\n");
+        pbuf_free(p);
+        p = NULL;
+        compat_netif->rx_stats.dropped++;
+    }
+    else if (res < len) {
+        pbuf_realloc(p, (u16_t)res);
+    }
+
+out:
+    lwip_netif_dev_release(netif);
     return p;
 }
 
@@ -305,6 +346,9 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
             }
             if (netif->input(p, netif) != ERR_OK) {
                 DEBUG("lwip_netdev: error inputing packet\n");
+                /* the pbuf is still ours if lwIP did not take it */
+                pbuf_free(p);
+                compat_netif->rx_stats.dropped++;
                 return;
             }
             break;
@@ -28,6 +28,16 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Receive statistics of a network interface
+ */
+typedef struct {
+    uint32_t dropped;       /**< frames dropped due to driver errors or
+                                 because lwIP did not accept them */
+    uint32_t alloc_failed;  /**< frames dropped because no pbuf was
+                                 available */
+} lwip_netif_rx_stats_t;
+
 /**
  * @brief   Representation of a network interface
  */
@@ -35,6 +45,7 @@ typedef struct {
     netif_t common_netif;                /**< network interface descriptor */
     struct netif lwip_netif;             /**< lwIP interface data */
     rmutex_t lock;                       /**< lock for the interface */
+    lwip_netif_rx_stats_t rx_stats;      /**< receive statistics */
 #if IS_USED(MODULE_BHP_MSG)
     bhp_msg_t bhp;                       /**< IPC Bottom Half Processor */
 #endif
@@ -32,7 +32,11 @@ extern "C" {
 #endif
 
 /**
- * @brief   Length of the temporary copying buffer for receival.
+ * @brief   Maximum length of a received frame, longer frames are dropped.
+ *
+ * Frames are received directly into a single pool pbuf, so PBUF_POOL_BUFSIZE
+ * must be at least this long.
+ *
  * @note    It should be as long as the maximum packet length of all the netdev you use.
  */
 #ifndef LWIP_NETDEV_BUFLEN
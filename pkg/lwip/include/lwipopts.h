@@ -166,6 +166,12 @@ extern "C" {
 #endif
 
 #define MEM_ALIGNMENT           4
+#ifndef PBUF_POOL_BUFSIZE
+/* a received frame of up to LWIP_NETDEV_BUFLEN bytes fits into a single pool
+ * pbuf, so the netdev adapter can receive it in place. This is
+ * ETHERNET_MAX_LEN, spelled out as lwIP uses it in preprocessor checks */
+#define PBUF_POOL_BUFSIZE       (1500 + 14 + 4)
+#endif
 #ifndef MEM_SIZE
 /* packet buffer size of GNRC + stack for TCP/IP */
 #define MEM_SIZE                (TCPIP_THREAD_STACKSIZE + 6144)
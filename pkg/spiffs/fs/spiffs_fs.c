@@ -336,7 +336,14 @@ static int _fsync(vfs_file_t *filp)
 
     int ret = SPIFFS_fflush(&fs_desc->fs, filp->private_data.value);
 
-    return spiffs_err_to_errno(ret);
+    if (ret < 0) {
+        return spiffs_err_to_errno(ret);
+    }
+#if SPIFFS_HAL_CALLBACK_EXTRA == 1
+    return mtd_flush(fs_desc->dev);
+#else
+    return mtd_flush(SPIFFS_MTD_DEV);
+#endif
 }
 
 static int _fstat(vfs_file_t *filp, struct stat *buf)
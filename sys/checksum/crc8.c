@@ -19,6 +19,7 @@
  */
 
 #include <stdbool.h>
+#include "checksum/crc.h"
 #include "checksum/crc8.h"
 
 uint8_t crc8(const uint8_t *data, size_t len, uint8_t g_polynom, uint8_t crc)
@@ -39,4 +40,10 @@ uint8_t crc8(const uint8_t *data, size_t len, uint8_t g_polynom, uint8_t crc)
     return crc;
 }
 
+uint32_t crc_algo_crc8_update(const crc_algo_t *algo, uint32_t crc,
+                              const uint8_t *buf, size_t len)
+{
+    return crc8(buf, len, algo->poly, crc);
+}
+
 /** @} */
@@ -16,6 +16,7 @@
 #include <assert.h>
 #include <inttypes.h>
 
+#include "checksum/crc.h"
 #include "checksum/ucrc16.h"
 
 #define UINT8_BIT_SIZE              (8U)
@@ -50,4 +51,16 @@ uint16_t ucrc16_calc_le(const uint8_t *buf, size_t len, uint16_t poly,
     return seed;
 }
 
+uint32_t crc_algo_ucrc16_be_update(const crc_algo_t *algo, uint32_t crc,
+                                   const uint8_t *buf, size_t len)
+{
+    return ucrc16_calc_be(buf, len, algo->poly, crc);
+}
+
+uint32_t crc_algo_ucrc16_le_update(const crc_algo_t *algo, uint32_t crc,
+                                   const uint8_t *buf, size_t len)
+{
+    return ucrc16_calc_le(buf, len, algo->poly, crc);
+}
+
 /** @} */
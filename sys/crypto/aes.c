@@ -77,11 +77,14 @@ static const cipher_interface_t aes_interface = {
     AES_BLOCK_SIZE,
     aes_init,
     aes_encrypt,
-    aes_decrypt
+    aes_decrypt,
+    aes_encrypt_blocks
 };
 
 const cipher_id_t CIPHER_AES = &aes_interface;
 
+#if !IS_USED(MODULE_CRYPTO_AES_BITSLICED)
+
 static const u32 Te0[256] = {
     0xc66363a5U, 0xf87c7c84U, 0xee777799U, 0xf67b7b8dU,
     0xfff2f20dU, 0xd66b6bbdU, 0xde6f6fb1U, 0x91c5c554U,
@@ -824,6 +827,7 @@ static const u32 rcon[] = {
     0x10000000, 0x20000000, 0x40000000, 0x80000000,
     0x1B000000, 0x36000000,
 };
+#endif /* !MODULE_CRYPTO_AES_BITSLICED */
 
 int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize)
 {
@@ -864,6 +868,8 @@ int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize)
     return CIPHER_INIT_SUCCESS;
 }
 
+#if !IS_USED(MODULE_CRYPTO_AES_BITSLICED)
+
 /**
  * Expand the cipher key into the encryption key schedule.
  */
@@ -1062,23 +1068,12 @@ static int aes_set_decrypt_key(const unsigned char *userKey, const int bits,
 
 #ifndef AES_ASM
 /*
- * Encrypt a single block
+ * Encrypt a single block with an expanded key
  * in and out can overlap
  */
-int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
-                uint8_t *cipherBlock)
+static void aes_encrypt_block(const aes_key_t *key, const uint8_t *plainBlock,
+                              uint8_t *cipherBlock)
 {
-    /* setup AES_KEY */
-    int res;
-    aes_key_t aeskey;
-    const aes_key_t *key = &aeskey;
-
-    res = aes_set_encrypt_key((unsigned char *)context->context,
-                              AES_KEY_SIZE(context) * 8, &aeskey);
-    if (res < 0) {
-        return res;
-    }
-
     const u32 *rk;
     u32 s0, s1, s2, s3, t0, t1, t2, t3;
 
@@ -1327,6 +1322,39 @@ int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
         (Te4((t2) & 0xff)       & 0x000000ff) ^
         rk[3];
     PUTU32(cipherBlock + 12, s3);
+}
+
+/*
+ * Encrypt a single block
+ * in and out can overlap
+ */
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plainBlock,
+                uint8_t *cipherBlock)
+{
+    return aes_encrypt_blocks(context, plainBlock, cipherBlock, 1);
+}
+
+/*
+ * Encrypt consecutive blocks, expanding the key only once
+ * in and out can overlap
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t nblocks)
+{
+    int res;
+    aes_key_t aeskey;
+
+    res = aes_set_encrypt_key((unsigned char *)context->context,
+                              AES_KEY_SIZE(context) * 8, &aeskey);
+    if (res < 0) {
+        return res;
+    }
+
+    for (size_t i = 0; i < nblocks; i++) {
+        aes_encrypt_block(&aeskey, input, output);
+        input += AES_BLOCK_SIZE;
+        output += AES_BLOCK_SIZE;
+    }
     return 1;
 }
 
@@ -1593,3 +1621,4 @@ int aes_decrypt(const cipher_context_t *context, const uint8_t *cipherBlock,
 }
 
 #endif /* AES_ASM */
+#endif /* !MODULE_CRYPTO_AES_BITSLICED */
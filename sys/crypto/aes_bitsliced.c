@@ -0,0 +1,444 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_crypto
+ * @{
+ *
+ * @file
+ * @brief       Constant-time AES backend with a bitsliced S-box
+ *
+ * The S-box is evaluated as the boolean circuit by Boyar and Peralta on
+ * 32 bytes at a time (two blocks), so neither the key schedule nor the
+ * rounds perform secret dependent memory accesses or branches. ShiftRows and
+ * MixColumns work on bytes and words with masks instead of tables.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "crypto/aes.h"
+#include "crypto/ciphers.h"
+#include "crypto/helper.h"
+
+/* two blocks share one pass through the S-box circuit */
+#define PAIR_SIZE   (2 * AES_BLOCK_SIZE)
+
+#define SWAPN(cl, ch, s, x, y)  do { \
+        uint32_t a = (x), b = (y); \
+        (x) = (a & (uint32_t)(cl)) | ((b & (uint32_t)(cl)) << (s)); \
+        (y) = ((a & (uint32_t)(ch)) >> (s)) | (b & (uint32_t)(ch)); \
+} while (0)
+
+/* transposes the 8x8 bit matrices formed by byte i of all words, this is
+ * its own inverse */
+static void _ortho(uint32_t q[8])
+{
+    SWAPN(0x55555555, 0xaaaaaaaa, 1, q[0], q[1]);
+    SWAPN(0x55555555, 0xaaaaaaaa, 1, q[2], q[3]);
+    SWAPN(0x55555555, 0xaaaaaaaa, 1, q[4], q[5]);
+    SWAPN(0x55555555, 0xaaaaaaaa, 1, q[6], q[7]);
+
+    SWAPN(0x33333333, 0xcccccccc, 2, q[0], q[2]);
+    SWAPN(0x33333333, 0xcccccccc, 2, q[1], q[3]);
+    SWAPN(0x33333333, 0xcccccccc, 2, q[4], q[6]);
+    SWAPN(0x33333333, 0xcccccccc, 2, q[5], q[7]);
+
+    SWAPN(0x0f0f0f0f, 0xf0f0f0f0, 4, q[0], q[4]);
+    SWAPN(0x0f0f0f0f, 0xf0f0f0f0, 4, q[1], q[5]);
+    SWAPN(0x0f0f0f0f, 0xf0f0f0f0, 4, q[2], q[6]);
+    SWAPN(0x0f0f0f0f, 0xf0f0f0f0, 4, q[3], q[7]);
+}
+
+/* S-box on bitsliced input, q[i] holds bit i of 32 bytes */
+static void _sbox(uint32_t q[8])
+{
+    uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+    uint32_t y1, y2, y3, y4, y5, y6, y7, y8, y9, y10, y11;
+    uint32_t y12, y13, y14, y15, y16, y17, y18, y19, y20, y21;
+    uint32_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9, z10, z11;
+    uint32_t z12, z13, z14, z15, z16, z17;
+    uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, t10, t11;
+    uint32_t t12, t13, t14, t15, t16, t17, t18, t19, t20, t21, t22;
+    uint32_t t23, t24, t25, t26, t27, t28, t29, t30, t31, t32, t33;
+    uint32_t t34, t35, t36, t37, t38, t39, t40, t41, t42, t43, t44;
+    uint32_t t45, t46, t47, t48, t49, t50, t51, t52, t53, t54, t55;
+    uint32_t t56, t57, t58, t59, t60, t61, t62, t63, t64, t65, t66, t67;
+    uint32_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    /* top linear transformation */
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    /* non-linear section */
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    /* bottom linear transformation */
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0;
+    q[6] = s1;
+    q[5] = s2;
+    q[4] = s3;
+    q[3] = s4;
+    q[2] = s5;
+    q[1] = s6;
+    q[0] = s7;
+}
+
+/* inverse of the affine transformation of the S-box, including the removal
+ * of the constant 0x63: b' = (b <<< 1) ^ (b <<< 3) ^ (b <<< 6) ^ 0x05 */
+static void _inv_affine(uint32_t q[8])
+{
+    uint32_t r[8];
+
+    for (unsigned i = 0; i < 8; i++) {
+        r[i] = q[(i + 7) & 7] ^ q[(i + 5) & 7] ^ q[(i + 2) & 7];
+    }
+    r[0] = ~r[0];
+    r[2] = ~r[2];
+    memcpy(q, r, sizeof(r));
+}
+
+static void _sub_bytes(uint8_t s[PAIR_SIZE])
+{
+    uint32_t q[8];
+
+    memcpy(q, s, sizeof(q));
+    _ortho(q);
+    _sbox(q);
+    _ortho(q);
+    memcpy(s, q, sizeof(q));
+}
+
+/* S^-1(x) = A^-1(S(A^-1(x ^ 0x63)) ^ 0x63) */
+static void _inv_sub_bytes(uint8_t s[PAIR_SIZE])
+{
+    uint32_t q[8];
+
+    memcpy(q, s, sizeof(q));
+    _ortho(q);
+    _inv_affine(q);
+    _sbox(q);
+    _inv_affine(q);
+    _ortho(q);
+    memcpy(s, q, sizeof(q));
+}
+
+/* position i of the result takes byte _shift_rows_idx[i] of the state */
+static const uint8_t _shift_rows_idx[AES_BLOCK_SIZE] = {
+    0, 5, 10, 15, 4, 9, 14, 3, 8, 13, 2, 7, 12, 1, 6, 11
+};
+
+static const uint8_t _inv_shift_rows_idx[AES_BLOCK_SIZE] = {
+    0, 13, 10, 7, 4, 1, 14, 11, 8, 5, 2, 15, 12, 9, 6, 3
+};
+
+/* the permutation is public, so indexing does not leak anything */
+static void _permute(uint8_t s[PAIR_SIZE], const uint8_t idx[AES_BLOCK_SIZE])
+{
+    uint8_t t[PAIR_SIZE];
+
+    for (unsigned i = 0; i < AES_BLOCK_SIZE; i++) {
+        t[i] = s[idx[i]];
+        t[i + AES_BLOCK_SIZE] = s[idx[i] + AES_BLOCK_SIZE];
+    }
+    memcpy(s, t, sizeof(t));
+}
+
+static inline uint32_t _load_col(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline void _store_col(uint8_t *p, uint32_t w)
+{
+    p[0] = w;
+    p[1] = w >> 8;
+    p[2] = w >> 16;
+    p[3] = w >> 24;
+}
+
+static inline uint32_t _rotr(uint32_t w, unsigned n)
+{
+    return (w >> n) | (w << (32 - n));
+}
+
+/* multiplies the four bytes of w by x in GF(2^8) */
+static inline uint32_t _xtime(uint32_t w)
+{
+    return ((w & 0x7f7f7f7f) << 1) ^ (((w >> 7) & 0x01010101) * 0x1b);
+}
+
+static inline uint32_t _mix_col(uint32_t w)
+{
+    uint32_t r8 = _rotr(w, 8);
+
+    return _xtime(w ^ r8) ^ r8 ^ _rotr(w, 16) ^ _rotr(w, 24);
+}
+
+static void _mix_columns(uint8_t s[PAIR_SIZE])
+{
+    for (unsigned i = 0; i < PAIR_SIZE; i += 4) {
+        _store_col(&s[i], _mix_col(_load_col(&s[i])));
+    }
+}
+
+static void _inv_mix_columns(uint8_t s[PAIR_SIZE])
+{
+    for (unsigned i = 0; i < PAIR_SIZE; i += 4) {
+        uint32_t w = _load_col(&s[i]);
+
+        /* InvMixColumns = MixColumns after multiplying a0 ^ a2 and a1 ^ a3
+         * by x^2 into the column */
+        w ^= _xtime(_xtime(w ^ _rotr(w, 16)));
+        _store_col(&s[i], _mix_col(w));
+    }
+}
+
+static void _add_round_key(uint8_t s[PAIR_SIZE], const uint8_t *rk)
+{
+    for (unsigned i = 0; i < AES_BLOCK_SIZE; i++) {
+        s[i] ^= rk[i];
+        s[i + AES_BLOCK_SIZE] ^= rk[i];
+    }
+}
+
+/* expands the key into (rounds + 1) round keys, returns the number of
+ * rounds */
+static unsigned _expand_key(const cipher_context_t *context,
+                            uint8_t rk[AES_BLOCK_SIZE * (AES_MAXNR + 1)])
+{
+    unsigned nk = context->key_size / 4;
+    unsigned rounds = nk + 6;
+    uint8_t rcon = 0x01;
+
+    memcpy(rk, context->context, context->key_size);
+    for (unsigned i = nk; i < 4 * (rounds + 1); i++) {
+        /* only the first four bytes are used, the S-box works on pairs */
+        uint8_t t[PAIR_SIZE] = { 0 };
+
+        if ((i % nk) == 0) {
+            /* RotWord */
+            memcpy(t, &rk[4 * (i - 1) + 1], 3);
+            t[3] = rk[4 * (i - 1)];
+            _sub_bytes(t);
+            t[0] ^= rcon;
+            rcon = (rcon << 1) ^ (0x1b & -(rcon >> 7));
+        }
+        else {
+            memcpy(t, &rk[4 * (i - 1)], 4);
+            if ((nk > 6) && ((i % nk) == 4)) {
+                _sub_bytes(t);
+            }
+        }
+        for (unsigned j = 0; j < 4; j++) {
+            rk[4 * i + j] = rk[4 * (i - nk) + j] ^ t[j];
+        }
+    }
+    return rounds;
+}
+
+static void _encrypt_pair(const uint8_t *rk, unsigned rounds,
+                          uint8_t s[PAIR_SIZE])
+{
+    _add_round_key(s, rk);
+    for (unsigned r = 1; r < rounds; r++) {
+        _sub_bytes(s);
+        _permute(s, _shift_rows_idx);
+        _mix_columns(s);
+        _add_round_key(s, &rk[r * AES_BLOCK_SIZE]);
+    }
+    _sub_bytes(s);
+    _permute(s, _shift_rows_idx);
+    _add_round_key(s, &rk[rounds * AES_BLOCK_SIZE]);
+}
+
+static void _decrypt_pair(const uint8_t *rk, unsigned rounds,
+                          uint8_t s[PAIR_SIZE])
+{
+    _add_round_key(s, &rk[rounds * AES_BLOCK_SIZE]);
+    for (unsigned r = rounds - 1; r > 0; r--) {
+        _permute(s, _inv_shift_rows_idx);
+        _inv_sub_bytes(s);
+        _add_round_key(s, &rk[r * AES_BLOCK_SIZE]);
+        _inv_mix_columns(s);
+    }
+    _permute(s, _inv_shift_rows_idx);
+    _inv_sub_bytes(s);
+    _add_round_key(s, rk);
+}
+
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t nblocks)
+{
+    uint8_t rk[AES_BLOCK_SIZE * (AES_MAXNR + 1)];
+    uint8_t s[PAIR_SIZE] = { 0 };
+    unsigned rounds = _expand_key(context, rk);
+
+    while (nblocks) {
+        size_t len = (nblocks > 1) ? PAIR_SIZE : AES_BLOCK_SIZE;
+
+        memcpy(s, input, len);
+        _encrypt_pair(rk, rounds, s);
+        memcpy(output, s, len);
+        input += len;
+        output += len;
+        nblocks -= len / AES_BLOCK_SIZE;
+    }
+    /* don't leave key material and state on the stack */
+    crypto_secure_wipe(rk, sizeof(rk));
+    crypto_secure_wipe(s, sizeof(s));
+    return 1;
+}
+
+int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
+                uint8_t *cipher_block)
+{
+    return aes_encrypt_blocks(context, plain_block, cipher_block, 1);
+}
+
+int aes_decrypt(const cipher_context_t *context, const uint8_t *cipher_block,
+                uint8_t *plain_block)
+{
+    uint8_t rk[AES_BLOCK_SIZE * (AES_MAXNR + 1)];
+    uint8_t s[PAIR_SIZE] = { 0 };
+    unsigned rounds = _expand_key(context, rk);
+
+    memcpy(s, cipher_block, AES_BLOCK_SIZE);
+    _decrypt_pair(rk, rounds, s);
+    memcpy(plain_block, s, AES_BLOCK_SIZE);
+    crypto_secure_wipe(rk, sizeof(rk));
+    crypto_secure_wipe(s, sizeof(s));
+    return 1;
+}
@@ -38,7 +38,7 @@ static inline int min(int a, int b)
 static int ccm_compute_cbc_mac(const cipher_t *cipher, const uint8_t iv[16],
                                const uint8_t *input, size_t length, uint8_t *mac)
 {
-    uint8_t block_size, mac_enc[16] = { 0 };
+    uint8_t block_size;
     uint32_t offset;
 
     block_size = cipher_get_block_size(cipher);
@@ -59,11 +59,10 @@ static int ccm_compute_cbc_mac(const cipher_t *cipher, const uint8_t iv[16],
             mac[i] ^= input[offset + i];
         }
 
-        if (cipher_encrypt(cipher, mac, mac_enc) != 1) {
+        if (cipher_encrypt(cipher, mac, mac) != 1) {
             return CIPHER_ERR_ENC_FAILED;
         }
 
-        memcpy(mac, mac_enc, block_size);
         offset += block_size_input;
     } while (offset < length);
 
@@ -181,7 +180,7 @@ int cipher_encrypt_ccm(const cipher_t *cipher,
 {
     int len = -1;
     uint8_t nonce_counter[16] = { 0 }, mac_iv[16] = { 0 }, mac[16] = { 0 },
-            stream_block[16] = { 0 }, zero_block[16] = { 0 }, block_size;
+            stream_block[16] = { 0 }, block_size;
 
     if (mac_length % 2 != 0  || mac_length < 4 || mac_length > 16) {
         return CCM_ERR_INVALID_MAC_LENGTH;
@@ -215,10 +214,8 @@ int cipher_encrypt_ccm(const cipher_t *cipher,
     nonce_counter[0] = length_encoding - 1;
     memcpy(&nonce_counter[1], nonce,
            min(nonce_len, (size_t)15 - length_encoding));
-    len = cipher_encrypt_ctr(cipher, nonce_counter, block_size,
-                             zero_block, block_size, stream_block);
-    if (len < 0) {
-        return len;
+    if (cipher_encrypt(cipher, nonce_counter, stream_block) != 1) {
+        return CIPHER_ERR_ENC_FAILED;
     }
 
     /* Encrypt message in counter mode  */
@@ -246,9 +243,7 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
 {
     int len = -1;
     uint8_t nonce_counter[16] = { 0 }, mac_iv[16] = { 0 }, mac[16] = { 0 },
-            mac_recv[16] = { 0 }, stream_block[16] = { 0 },
-            zero_block[16] = { 0 },
-            block_size;
+            mac_recv[16] = { 0 }, stream_block[16] = { 0 }, block_size;
     size_t plain_len;
 
     if (mac_length % 2 != 0  || mac_length < 4 || mac_length > 16) {
@@ -266,10 +261,8 @@ int cipher_decrypt_ccm(const cipher_t *cipher,
     assert(block_size == CCM_BLOCK_SIZE);
     memcpy(&nonce_counter[1], nonce, min(nonce_len,
                                          (size_t)15 - length_encoding));
-    len = cipher_encrypt_ctr(cipher, nonce_counter, block_size, zero_block,
-                             block_size, stream_block);
-    if (len < 0) {
-        return len;
+    if (cipher_encrypt(cipher, nonce_counter, stream_block) != 1) {
+        return CIPHER_ERR_ENC_FAILED;
     }
 
     /* Decrypt message in counter mode */
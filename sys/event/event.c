@@ -32,6 +32,76 @@
 #if IS_USED(MODULE_XTIMER)
 #include "xtimer.h"
 #endif
+#if IS_USED(MODULE_EVENT_STATS)
+#include "ztimer.h"
+#endif
+
+/* Events taken by event_get_batch() point here until they are dispatched, so
+ * that they still count as queued for event_post() and event_cancel() */
+static clist_node_t _batched;
+
+#if IS_USED(MODULE_EVENT_STATS)
+/* all _stats_*() functions must be called with IRQs disabled */
+static void _stats_add(event_queue_t *queue)
+{
+    event_queue_stats_t *stats = &queue->stats;
+
+    if (stats->depth == 0) {
+        stats->since = ztimer_now(ZTIMER_USEC);
+    }
+    stats->depth++;
+    if (stats->depth > stats->depth_max) {
+        stats->depth_max = stats->depth;
+    }
+}
+
+static void _stats_remove(event_queue_t *queue)
+{
+    queue->stats.depth--;
+}
+
+static void _stats_batch(event_queue_t *queue, size_t numof)
+{
+    if (numof == 0) {
+        return;
+    }
+
+    event_queue_stats_t *stats = &queue->stats;
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+    uint32_t latency = (now - stats->since) >> 4;
+    unsigned bucket = 0;
+
+    while (latency && (bucket < (CONFIG_EVENT_STATS_LATENCY_NUMOF - 1))) {
+        latency >>= 2;
+        bucket++;
+    }
+    stats->latency[bucket]++;
+    stats->depth -= numof;
+    stats->batches++;
+    stats->events += numof;
+    if (numof > stats->batch_max) {
+        stats->batch_max = numof;
+    }
+    /* the remaining events are handled with the next batch */
+    stats->since = now;
+}
+
+void event_queue_get_stats(const event_queue_t *queue,
+                           event_queue_stats_t *stats)
+{
+    unsigned state = irq_disable();
+    *stats = queue->stats;
+    irq_restore(state);
+}
+#else
+static inline void _stats_add(event_queue_t *queue) { (void)queue; }
+static inline void _stats_remove(event_queue_t *queue) { (void)queue; }
+static inline void _stats_batch(event_queue_t *queue, size_t numof)
+{
+    (void)queue;
+    (void)numof;
+}
+#endif
 
 void event_post(event_queue_t *queue, event_t *event)
 {
@@ -40,6 +110,7 @@ void event_post(event_queue_t *queue, event_t *event)
     unsigned state = irq_disable();
     if (!event->list_node.next) {
         clist_rpush(&queue->event_list, &event->list_node);
+        _stats_add(queue);
     }
     thread_t *waiter = queue->waiter;
     irq_restore(state);
@@ -55,7 +126,9 @@ void event_cancel(event_queue_t *queue, event_t *event)
     assert(event);
 
     unsigned state = irq_disable();
-    clist_remove(&queue->event_list, &event->list_node);
+    if (clist_remove(&queue->event_list, &event->list_node)) {
+        _stats_remove(queue);
+    }
     event->list_node.next = NULL;
     irq_restore(state);
 }
@@ -64,6 +137,9 @@ event_t *event_get(event_queue_t *queue)
 {
     unsigned state = irq_disable();
     event_t *result = (event_t *) clist_lpop(&queue->event_list);
+    if (result) {
+        _stats_remove(queue);
+    }
     irq_restore(state);
 
     if (result) {
@@ -72,6 +148,68 @@ event_t *event_get(event_queue_t *queue)
     return result;
 }
 
+size_t event_get_batch(event_queue_t *queue, event_t **events, size_t max)
+{
+    size_t numof = 0;
+
+    assert(queue && (events || !max));
+
+    unsigned state = irq_disable();
+    while (numof < max) {
+        clist_node_t *node = clist_lpop(&queue->event_list);
+        if (node == NULL) {
+            break;
+        }
+        node->next = &_batched;
+        events[numof++] = container_of(node, event_t, list_node);
+    }
+    _stats_batch(queue, numof);
+    irq_restore(state);
+
+    return numof;
+}
+
+void event_dispatch_batch(event_t **events, size_t numof)
+{
+    for (size_t i = 0; i < numof; i++) {
+        event_t *event = events[i];
+
+        /* event_cancel() clears the mark, it may even have been posted
+         * again since */
+        unsigned state = irq_disable();
+        bool pending = (event->list_node.next == &_batched);
+        if (pending) {
+            event->list_node.next = NULL;
+        }
+        irq_restore(state);
+
+        if (pending) {
+            event->handler(event);
+        }
+    }
+}
+
+void event_loop_batched_multi(event_queue_t *queues, size_t n_queues)
+{
+    event_t *batch[CONFIG_EVENT_LOOP_BATCH_SIZE];
+
+    assert(queues && n_queues);
+
+    while (1) {
+        size_t numof = 0;
+
+        for (size_t i = 0; (numof == 0) && (i < n_queues); i++) {
+            assert(queues[i].waiter);
+            numof = event_get_batch(&queues[i], batch, ARRAY_SIZE(batch));
+        }
+        if (numof == 0) {
+            thread_flags_wait_any(THREAD_FLAG_EVENT);
+            continue;
+        }
+        event_dispatch_batch(batch, numof);
+    }
+}
+
 event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
 {
     assert(queues && n_queues);
@@ -84,6 +222,7 @@ event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
             result = container_of(clist_lpop(&queues[i].event_list),
                                   event_t, list_node);
             if (result) {
+                _stats_remove(&queues[i]);
                 break;
             }
         }
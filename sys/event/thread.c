@@ -38,7 +38,12 @@ static void *_handler_thread(void *tagged_ptr)
     size_t n = ptrtag_tag(tagged_ptr) + 1;
     event_queues_claim(qs, n);
     /* start event loop */
-    event_loop_multi(qs, n);
+    if (IS_USED(MODULE_EVENT_THREAD_BATCHED)) {
+        event_loop_batched_multi(qs, n);
+    }
+    else {
+        event_loop_multi(qs, n);
+    }
 
     /* should be never reached */
     return NULL;
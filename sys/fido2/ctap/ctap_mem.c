@@ -101,6 +101,10 @@ static int _flash_write(const void *buf, uint32_t addr, size_t len)
         const uint32_t page_mask = _mtd_dev->page_size - 1;
 
         ret = mtd_write_page(_mtd_dev, buf, addr >> page_shift, addr & page_mask, len);
+        if (ret == 0) {
+            /* data must be persistent when returning */
+            ret = mtd_flush(_mtd_dev);
+        }
 
         if (ret < 0) {
             return CTAP1_ERR_OTHER;
@@ -47,6 +47,7 @@
  */
 
 #include <stdint.h>
+#include <string.h>
 #include <assert.h>
 
 #include "hashes/sha2xx_common.h"
@@ -54,9 +55,6 @@
 #ifdef __BIG_ENDIAN__
 /* Copy a vector of big-endian uint32_t into a vector of bytes */
 #define be32enc_vect memcpy
-
-/* Copy a vector of bytes into a vector of big-endian uint32_t */
-#define be32dec_vect memcpy
 #else /* !__BIG_ENDIAN__ */
 
 /*
@@ -88,13 +86,32 @@ static void be32enc_vect(void *dst_, const void *src_, size_t len)
     }
 }
 
+#endif /* __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__ */
+
+/* Load a big-endian uint32_t from a not necessarily aligned address */
+static inline uint32_t be32dec(const unsigned char *p)
+{
+    uint32_t w;
+
+    memcpy(&w, p, sizeof(w));
+#ifdef __BIG_ENDIAN__
+    return w;
+#else
+    return __builtin_bswap32(w);
+#endif
+}
+
 /*
- * Decode a big-endian length len vector of (unsigned char) into a length
- * len/4 vector of (uint32_t).  Assumes len is a multiple of 4.
+ * One round of the mix. Instead of rotating the working variables, the
+ * callers rotate the arguments: d and h are the ones updated.
  */
-#define be32dec_vect be32enc_vect
-
-#endif /* __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__ */
+#define SHA2XX_ROUND(a, b, c, d, e, f, g, h, i)                 \
+    do {                                                        \
+        uint32_t t0 = h + S1(e) + Ch(e, f, g) + W[i] + K[i];    \
+        uint32_t t1 = S0(a) + Maj(a, b, c);                     \
+        d += t0;                                                \
+        h = t0 + t1;                                            \
+    } while (0)
 
 /*
  * SHA256 block compression function.  The 256-bit state is transformed via
@@ -103,35 +120,35 @@ static void be32enc_vect(void *dst_, const void *src_, size_t len)
 static void sha2xx_transform(uint32_t *state, const unsigned char block[64])
 {
     uint32_t W[64];
-    uint32_t S[8];
 
     /* 1. Prepare message schedule W. */
-    be32dec_vect(W, block, 64);
+    for (int i = 0; i < 16; i++) {
+        W[i] = be32dec(&block[i * 4]);
+    }
     for (int i = 16; i < 64; i++) {
         W[i] = s1(W[i - 2]) + W[i - 7] + s0(W[i - 15]) + W[i - 16];
     }
 
     /* 2. Initialize working variables. */
-    memcpy(S, state, 32);
-
-    /* 3. Mix. */
-    for (int i = 0; i < 64; ++i) {
-        uint32_t e = S[(68 - i) % 8], f = S[(69 - i) % 8];
-        uint32_t g = S[(70 - i) % 8], h = S[(71 - i) % 8];
-        uint32_t t0 = h + S1(e) + Ch(e, f, g) + W[i] + K[i];
-
-        uint32_t a = S[(64 - i) % 8], b = S[(65 - i) % 8];
-        uint32_t c = S[(66 - i) % 8], d = S[(67 - i) % 8];
-        uint32_t t1 = S0(a) + Maj(a, b, c);
-
-        S[(67 - i) % 8] = d + t0;
-        S[(71 - i) % 8] = t0 + t1;
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    /* 3. Mix, eight rounds per iteration so the variables keep their
+     *    registers. */
+    for (int i = 0; i < 64; i += 8) {
+        SHA2XX_ROUND(a, b, c, d, e, f, g, h, i);
+        SHA2XX_ROUND(h, a, b, c, d, e, f, g, i + 1);
+        SHA2XX_ROUND(g, h, a, b, c, d, e, f, i + 2);
+        SHA2XX_ROUND(f, g, h, a, b, c, d, e, i + 3);
+        SHA2XX_ROUND(e, f, g, h, a, b, c, d, i + 4);
+        SHA2XX_ROUND(d, e, f, g, h, a, b, c, i + 5);
+        SHA2XX_ROUND(c, d, e, f, g, h, a, b, i + 6);
+        SHA2XX_ROUND(b, c, d, e, f, g, h, a, i + 7);
     }
 
     /* 4. Mix local working variables into global state */
-    for (int i = 0; i < 8; i++) {
-        state[i] += S[i];
-    }
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
 }
 
 static unsigned char PAD[64] = {
@@ -186,15 +203,17 @@ void sha2xx_update(sha2xx_context_t *ctx, const void *data, size_t len)
         return;
     }
 
-    /* Finish the current block */
     const unsigned char *src = data;
 
-    memcpy(&ctx->buf[r], src, 64 - r);
-    sha2xx_transform(ctx->state, ctx->buf);
-    src += 64 - r;
-    len -= 64 - r;
+    /* Finish the current block, if any */
+    if (r) {
+        memcpy(&ctx->buf[r], src, 64 - r);
+        sha2xx_transform(ctx->state, ctx->buf);
+        src += 64 - r;
+        len -= 64 - r;
+    }
 
-    /* Perform complete blocks */
+    /* Perform complete blocks directly from the input */
     while (len >= 64) {
         sha2xx_transform(ctx->state, src);
         src += 64;
@@ -40,10 +40,10 @@
 
    The drawbacks of this implementation are:
     - There is no message queue. The whole message must be ready in a buffer.
-    - It is not optimized for performance.
+    - It is not optimized for performance (RIOT: except for the permutation).
 
-   The implementation is even simpler on a little endian platform. Just define the
-   LITTLE_ENDIAN symbol in that case.
+   The implementation is even simpler on a little endian platform, which is
+   detected via __BYTE_ORDER__.
 
    For a more complete set of implementations, please refer to
    the Keccak Code Package at https://github.com/gvanas/KeccakCodePackage
@@ -174,12 +174,14 @@ void sha3_512_final(keccak_state_t *ctx, void *digest)
 typedef uint8_t UINT8;
 typedef uint64_t UINT64;
 typedef UINT64 tKeccakLane;
+/* a lane of the state, which is declared as array of bytes */
+typedef UINT64 __attribute__((__may_alias__)) tKeccakStateLane;
 
-#if __BYTE_ORDER__ == __ORDER__LITTLE_ENDIAN__
-#define LITTLE_ENDIAN
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define KECCAK_LITTLE_ENDIAN
 #endif
 
-#ifndef LITTLE_ENDIAN
+#ifndef KECCAK_LITTLE_ENDIAN
 /** Function to load a 64-bit value using the little-endian (LE) convention.
  * On a LE platform, this could be greatly simplified using a cast.
  */
@@ -207,122 +209,143 @@ static void store64(UINT8 *x, UINT64 u)
         u >>= 8;
     }
 }
-
-/** Function to XOR into a 64-bit value using the little-endian (LE) convention.
- * On a LE platform, this could be greatly simplified using a cast.
- */
-static void xor64(UINT8 *x, UINT64 u)
-{
-    unsigned int i;
-
-    for (i = 0; i < 8; ++i) {
-        x[i] ^= u;
-        u >>= 8;
-    }
-}
 #endif
 
 /*
    ================================================================
-   A readable and compact implementation of the Keccak-f[1600] permutation.
+   A lane-oriented implementation of the Keccak-f[1600] permutation.
+
+   RIOT: the state is permuted in place as 25 64-bit lanes (on big endian
+   platforms, a copy of it), with the round constants, the ρ rotation offsets
+   and the π lane order precomputed, and the θ and χ steps unrolled.
    ================================================================
  */
 
 #define ROL64(a, offset) ((((UINT64)a) << offset) ^ (((UINT64)a) >> (64 - offset)))
-#define i(x, y) ((x) + 5 * (y))
 
-#ifdef LITTLE_ENDIAN
-    #define readLane(x, y)          (((tKeccakLane *)state)[i(x, y)])
-    #define writeLane(x, y, lane)   (((tKeccakLane *)state)[i(x, y)]) = (lane)
-    #define XORLane(x, y, lane)     (((tKeccakLane *)state)[i(x, y)]) ^= (lane)
-#else
-    #define readLane(x, y)          load64((UINT8 *)state + sizeof(tKeccakLane) * i(x, y))
-    #define writeLane(x, y, lane)   store64((UINT8 *)state + sizeof(tKeccakLane) * i(x, y), lane)
-    #define XORLane(x, y, lane)     xor64((UINT8 *)state + sizeof(tKeccakLane) * i(x, y), lane)
-#endif
+/**
+ * Round constants of the ι step (see [Keccak Reference, Section 1.2]).
+ */
+static const tKeccakLane KeccakF_RoundConstants[24] = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+    0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+    0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+    0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+    0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+    0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+    0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+    0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL,
+};
 
 /**
- * Function that computes the linear feedback shift register (LFSR) used to
- * define the round constants (see [Keccak Reference, Section 1.2]).
+ * Rotation offsets r = (t+1)(t+2)/2 of the ρ step, in the order the lanes are
+ * visited by the π step.
  */
-static int LFSR86540(UINT8 *LFSR)
-{
-    int result = ((*LFSR) & 0x01) != 0;
+static const UINT8 KeccakF_RhoOffsets[24] = {
+    1, 3, 6, 10, 15, 21, 28, 36, 45, 55, 2, 14,
+    27, 41, 56, 8, 25, 43, 62, 18, 39, 61, 20, 44,
+};
 
-    if (((*LFSR) & 0x80) != 0) {
-        /* Primitive polynomial over GF(2): x^8+x^6+x^5+x^4+1 */
-        (*LFSR) = ((*LFSR) << 1) ^ 0x71;
-    }
-    else {
-        (*LFSR) <<= 1;
-    }
-    return result;
-}
+/**
+ * Lane indices x + 5y of ((0 1)(2 3))^t * (1 0) for 1 ≤ t ≤ 24, the order in
+ * which the π step moves the lanes.
+ */
+static const UINT8 KeccakF_PiLanes[24] = {
+    10, 7, 11, 17, 18, 3, 5, 16, 8, 21, 24, 4,
+    15, 23, 19, 13, 12, 2, 20, 14, 22, 9, 6, 1,
+};
 
 /**
  * Function that computes the Keccak-f[1600] permutation on the given state.
  */
 static void KeccakF1600_StatePermute(void *state)
 {
-    unsigned int round, x, y, j, t;
-    UINT8 LFSRstate = 0x01;
-
-    for (round = 0; round < 24; round++) {
-        {   /* === θ step (see [Keccak Reference, Section 2.3.2]) === */
-            tKeccakLane C[5];
-
-            /* Compute the parity of the columns */
-            for (x = 0; x < 5; x++)
-                C[x] = readLane(x, 0) ^ readLane(x, 1) ^ readLane(x, 2) ^ readLane(x, 3) ^
-                       readLane(x, 4);
-            for (x = 0; x < 5; x++) {
-                /* Compute the θ effect for a given column */
-                tKeccakLane D = C[(x + 4) % 5] ^ ROL64(C[(x + 1) % 5], 1);
-                /* Add the θ effect to the whole column */
-                for (y = 0; y < 5; y++)
-                    XORLane(x, y, D);
-            }
-        }
+#ifdef KECCAK_LITTLE_ENDIAN
+    tKeccakStateLane *A = state;
+#else
+    tKeccakLane A[25];
 
-        {   /* === ρ and π steps (see [Keccak Reference, Sections 2.3.3 and 2.3.4]) === */
-            tKeccakLane current;
-            /* Start at coordinates (1 0) */
-            x = 1; y = 0;
-            current = readLane(x, y);
-            /* Iterate over ((0 1)(2 3))^t * (1 0) for 0 ≤ t ≤ 23 */
-            for (t = 0; t < 24; t++) {
-                /* Compute the rotation constant r = (t+1)(t+2)/2 */
-                unsigned int r = ((t + 1) * (t + 2) / 2) % 64;
-                /* Compute ((0 1)(2 3)) * (x y) */
-                unsigned int Y = (2 * x + 3 * y) % 5; x = y; y = Y;
-                /* Swap current and state(x,y), and rotate */
-                tKeccakLane temp = readLane(x, y);
-                writeLane(x, y, ROL64(current, r));
-                current = temp;
-            }
-        }
+    for (unsigned int i = 0; i < 25; i++) {
+        A[i] = load64((UINT8 *)state + sizeof(tKeccakLane) * i);
+    }
+#endif
 
-        {   /* === χ step (see [Keccak Reference, Section 2.3.1]) === */
-            tKeccakLane temp[5];
-            for (y = 0; y < 5; y++) {
-                /* Take a copy of the plane */
-                for (x = 0; x < 5; x++)
-                    temp[x] = readLane(x, y);
-                /* Compute χ on the plane */
-                for (x = 0; x < 5; x++)
-                    writeLane(x, y, temp[x] ^ ((~temp[(x + 1) % 5]) & temp[(x + 2) % 5]));
-            }
+    for (unsigned int round = 0; round < 24; round++) {
+        tKeccakLane C0, C1, C2, C3, C4, D;
+
+        /* === θ step (see [Keccak Reference, Section 2.3.2]) === */
+        /* Compute the parity of the columns */
+        C0 = A[0] ^ A[5] ^ A[10] ^ A[15] ^ A[20];
+        C1 = A[1] ^ A[6] ^ A[11] ^ A[16] ^ A[21];
+        C2 = A[2] ^ A[7] ^ A[12] ^ A[17] ^ A[22];
+        C3 = A[3] ^ A[8] ^ A[13] ^ A[18] ^ A[23];
+        C4 = A[4] ^ A[9] ^ A[14] ^ A[19] ^ A[24];
+        /* Add the θ effect to the whole column */
+        D = C4 ^ ROL64(C1, 1);
+        A[0] ^= D; A[5] ^= D; A[10] ^= D; A[15] ^= D; A[20] ^= D;
+        D = C0 ^ ROL64(C2, 1);
+        A[1] ^= D; A[6] ^= D; A[11] ^= D; A[16] ^= D; A[21] ^= D;
+        D = C1 ^ ROL64(C3, 1);
+        A[2] ^= D; A[7] ^= D; A[12] ^= D; A[17] ^= D; A[22] ^= D;
+        D = C2 ^ ROL64(C4, 1);
+        A[3] ^= D; A[8] ^= D; A[13] ^= D; A[18] ^= D; A[23] ^= D;
+        D = C3 ^ ROL64(C0, 1);
+        A[4] ^= D; A[9] ^= D; A[14] ^= D; A[19] ^= D; A[24] ^= D;
+
+        /* === ρ and π steps (see [Keccak Reference, Sections 2.3.3 and 2.3.4]) === */
+        /* Start at coordinates (1 0), swap the current lane with the next
+         * one and rotate it */
+        tKeccakLane current = A[1];
+        for (unsigned int t = 0; t < 24; t++) {
+            unsigned int j = KeccakF_PiLanes[t];
+            tKeccakLane temp = A[j];
+            A[j] = ROL64(current, KeccakF_RhoOffsets[t]);
+            current = temp;
         }
 
-        {
-            /* === ι step (see [Keccak Reference, Section 2.3.5]) === */
-            for (j = 0; j < 7; j++) {
-                unsigned int bitPosition = (1 << j) - 1;    /* 2^j-1 */
-                if (LFSR86540(&LFSRstate)) {
-                    XORLane(0, 0, (tKeccakLane)1 << bitPosition);
-                }
-            }
+        /* === χ step (see [Keccak Reference, Section 2.3.1]) === */
+        for (unsigned int y = 0; y < 25; y += 5) {
+            /* Take a copy of the plane */
+            C0 = A[y]; C1 = A[y + 1]; C2 = A[y + 2]; C3 = A[y + 3]; C4 = A[y + 4];
+            /* Compute χ on the plane */
+            A[y] = C0 ^ ((~C1) & C2);
+            A[y + 1] = C1 ^ ((~C2) & C3);
+            A[y + 2] = C2 ^ ((~C3) & C4);
+            A[y + 3] = C3 ^ ((~C4) & C0);
+            A[y + 4] = C4 ^ ((~C0) & C1);
         }
+
+        /* === ι step (see [Keccak Reference, Section 2.3.5]) === */
+        A[0] ^= KeccakF_RoundConstants[round];
+    }
+
+#ifndef KECCAK_LITTLE_ENDIAN
+    for (unsigned int i = 0; i < 25; i++) {
+        store64((UINT8 *)state + sizeof(tKeccakLane) * i, A[i]);
+    }
+#endif
+}
+
+/**
+ * Function that XORs @p len bytes (a multiple of the lane size) of input into
+ * the state, a lane at a time.
+ */
+static void KeccakF1600_StateXORLanes(void *state, const UINT8 *input,
+                                      unsigned int len)
+{
+    tKeccakStateLane *A = state;
+
+    for (unsigned int i = 0; i < len / sizeof(tKeccakLane); i++) {
+#ifdef KECCAK_LITTLE_ENDIAN
+        tKeccakLane lane;
+        /* the input is not necessarily aligned */
+        memcpy(&lane, input + sizeof(tKeccakLane) * i, sizeof(lane));
+        A[i] ^= lane;
+#else
+        UINT8 *x = (UINT8 *)state + sizeof(tKeccakLane) * i;
+        store64(x, load64(x) ^ load64(input + sizeof(tKeccakLane) * i));
+        (void)A;
+#endif
     }
 }
 
@@ -337,7 +360,9 @@ static void Keccak(unsigned int rate, unsigned int capacity, const unsigned char
                    unsigned long long int inputByteLen, unsigned char delimitedSuffix,
                    unsigned char *output, unsigned long long int outputByteLen)
 {
-    UINT8 state[200];
+    /* lanes, so the state can be permuted in place */
+    tKeccakLane lanes[25];
+    UINT8 *state = (UINT8 *)lanes;
     unsigned int rateInBytes = rate / 8;
     unsigned int blockSize = 0;
     unsigned int i;
@@ -347,9 +372,15 @@ static void Keccak(unsigned int rate, unsigned int capacity, const unsigned char
     }
 
     /* === Initialize the state === */
-    memset(state, 0, sizeof(state));
+    memset(lanes, 0, sizeof(lanes));
 
     /* === Absorb all the input blocks === */
+    while (inputByteLen >= rateInBytes) {
+        KeccakF1600_StateXORLanes(state, input, rateInBytes);
+        KeccakF1600_StatePermute(state);
+        input += rateInBytes;
+        inputByteLen -= rateInBytes;
+    }
     while (inputByteLen > 0) {
         blockSize = MIN(inputByteLen, rateInBytes);
         for (i = 0; i < blockSize; i++)
@@ -413,6 +444,15 @@ void Keccak_update(keccak_state_t *ctx, const unsigned char *input,
 {
     /* === Absorb all the input blocks === */
     while (inputByteLen > 0) {
+        if ((ctx->i == 0) && (inputByteLen >= ctx->rateInBytes)) {
+            /* absorb whole blocks directly from the input */
+            KeccakF1600_StateXORLanes(ctx->state, input, ctx->rateInBytes);
+            KeccakF1600_StatePermute(ctx->state);
+            input += ctx->rateInBytes;
+            inputByteLen -= ctx->rateInBytes;
+            continue;
+        }
+
         unsigned int blockSize = MIN(inputByteLen + ctx->i, ctx->rateInBytes);
         while (ctx->i < blockSize) {
             ctx->state[ctx->i] ^= *input;
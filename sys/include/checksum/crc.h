@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_checksum_crc Generic CRC interface
+ * @ingroup     sys_checksum
+ *
+ * @brief       Incremental interface common to all CRC variants
+ *
+ * All CRC implementations of @ref sys_checksum are described by a
+ * @ref crc_algo_t, so data can be checksummed piece by piece (e.g. a firmware
+ * image page by page) without the caller having to know which variant is
+ * used, and the variant can be chosen at runtime.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * crc_ctx_t ctx;
+ *
+ * crc_init(&ctx, &crc_algo_crc32);
+ * while ((len = read_next_page(buf, sizeof(buf))) > 0) {
+ *     crc_update(&ctx, buf, len);
+ * }
+ * uint32_t checksum = crc_finish(&ctx);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * The speed of CRC-32 and of the CRC16-CCITT variants can be traded for flash
+ * by modules:
+ *
+ * Module          | Implementation | Table size
+ * :-------------- | :------------- | ---------------------------------:
+ * none            | bitwise        | -
+ * `crc32_fast`    | byte-wise      | 1 KiB
+ * `crc32_slicing` | slicing-by-N   | N KiB, see @ref CONFIG_CRC_SLICING_BY
+ * `crc16_fast`    | byte-wise      | 512 B per variant
+ * `crc16_slicing` | slicing-by-N   | N * 512 B per variant
+ *
+ * @{
+ *
+ * @file
+ */
+
+#ifndef CHECKSUM_CRC_H
+#define CHECKSUM_CRC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of bytes the slicing implementations process at once
+ *
+ * Used by the modules `crc32_slicing` and `crc16_slicing`. Either 4 or 8,
+ * every step doubles the size of the look-up tables.
+ */
+#ifndef CONFIG_CRC_SLICING_BY
+#define CONFIG_CRC_SLICING_BY   8
+#endif
+
+#if (CONFIG_CRC_SLICING_BY != 4) && (CONFIG_CRC_SLICING_BY != 8)
+#error "CONFIG_CRC_SLICING_BY must be 4 or 8"
+#endif
+
+/**
+ * @brief   CRC algorithm descriptor forward declaration
+ */
+typedef struct crc_algo crc_algo_t;
+
+/**
+ * @brief   Updates a CRC register with data
+ *
+ * @param[in] algo  The algorithm, for its parameters
+ * @param[in] crc   The current value of the CRC register
+ * @param[in] buf   The data to checksum
+ * @param[in] len   Length of the data in bytes
+ *
+ * @return  The new value of the CRC register
+ */
+typedef uint32_t (*crc_update_t)(const crc_algo_t *algo, uint32_t crc,
+                                 const uint8_t *buf, size_t len);
+
+/**
+ * @brief   CRC algorithm descriptor
+ */
+struct crc_algo {
+    crc_update_t update;    /**< updates the CRC register with data */
+    uint32_t init;          /**< initial value of the CRC register */
+    uint32_t xorout;        /**< XORed to the register to get the result */
+    uint16_t poly;          /**< polynomial, for the generic CRC-8/CRC-16 */
+};
+
+/**
+ * @brief   State of an incremental CRC calculation
+ */
+typedef struct {
+    const crc_algo_t *algo; /**< algorithm in use */
+    uint32_t crc;           /**< current value of the CRC register */
+} crc_ctx_t;
+
+/**
+ * @name    Algorithm descriptors
+ * @{
+ */
+extern const crc_algo_t crc_algo_crc32;                 /**< see @ref crc32() */
+extern const crc_algo_t crc_algo_crc16_ccitt_kermit;    /**< see @ref crc16_ccitt_kermit_calc() */
+extern const crc_algo_t crc_algo_crc16_ccitt_mcrf4xx;   /**< see @ref crc16_ccitt_mcrf4xx_calc() */
+extern const crc_algo_t crc_algo_crc16_ccitt_false;     /**< see @ref crc16_ccitt_false_calc() */
+extern const crc_algo_t crc_algo_crc16_ccitt_aug;       /**< see @ref crc16_ccitt_aug_calc() */
+
+/**
+ * @brief   Static initializer for a descriptor of @ref crc8()
+ *
+ * @param[in] _poly The CRC-8 polynomial
+ * @param[in] _seed The initial value
+ */
+#define CRC_ALGO_CRC8(_poly, _seed) \
+    { .update = crc_algo_crc8_update, .init = _seed, .xorout = 0, .poly = _poly }
+
+/**
+ * @brief   Static initializer for a descriptor of @ref ucrc16_calc_be()
+ *
+ * @param[in] _poly The CRC-16 polynomial
+ * @param[in] _seed The initial value
+ */
+#define CRC_ALGO_UCRC16_BE(_poly, _seed) \
+    { .update = crc_algo_ucrc16_be_update, .init = _seed, .xorout = 0, .poly = _poly }
+
+/**
+ * @brief   Static initializer for a descriptor of @ref ucrc16_calc_le()
+ *
+ * @param[in] _poly The CRC-16 polynomial (reversed representation)
+ * @param[in] _seed The initial value
+ */
+#define CRC_ALGO_UCRC16_LE(_poly, _seed) \
+    { .update = crc_algo_ucrc16_le_update, .init = _seed, .xorout = 0, .poly = _poly }
+/** @} */
+
+/**
+ * @name    Update functions for the generic CRC-8 and CRC-16 descriptors
+ * @internal
+ * @{
+ */
+uint32_t crc_algo_crc8_update(const crc_algo_t *algo, uint32_t crc,
+                              const uint8_t *buf, size_t len);
+uint32_t crc_algo_ucrc16_be_update(const crc_algo_t *algo, uint32_t crc,
+                                   const uint8_t *buf, size_t len);
+uint32_t crc_algo_ucrc16_le_update(const crc_algo_t *algo, uint32_t crc,
+                                   const uint8_t *buf, size_t len);
+/** @} */
+
+/**
+ * @brief   Starts an incremental CRC calculation
+ *
+ * @param[out] ctx  The calculation state
+ * @param[in]  algo The algorithm to use
+ */
+static inline void crc_init(crc_ctx_t *ctx, const crc_algo_t *algo)
+{
+    ctx->algo = algo;
+    ctx->crc = algo->init;
+}
+
+/**
+ * @brief   Adds data to an incremental CRC calculation
+ *
+ * @param[in,out] ctx   The calculation state
+ * @param[in]     buf   The data to checksum
+ * @param[in]     len   Length of the data in bytes
+ */
+static inline void crc_update(crc_ctx_t *ctx, const void *buf, size_t len)
+{
+    ctx->crc = ctx->algo->update(ctx->algo, ctx->crc, buf, len);
+}
+
+/**
+ * @brief   Gets the result of an incremental CRC calculation
+ *
+ * The calculation may be continued with @ref crc_update() afterwards.
+ *
+ * @param[in] ctx   The calculation state
+ *
+ * @return  The checksum of all data added so far
+ */
+static inline uint32_t crc_finish(const crc_ctx_t *ctx)
+{
+    return ctx->crc ^ ctx->algo->xorout;
+}
+
+/**
+ * @brief   Calculates a checksum in one go
+ *
+ * @param[in] algo  The algorithm to use
+ * @param[in] buf   The data to checksum
+ * @param[in] len   Length of the data in bytes
+ *
+ * @return  The checksum of @p buf
+ */
+static inline uint32_t crc_calc(const crc_algo_t *algo, const void *buf,
+                                size_t len)
+{
+    return algo->update(algo, algo->init, buf, len) ^ algo->xorout;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CHECKSUM_CRC_H */
+/** @} */
@@ -21,7 +21,10 @@
  *              enabling the look-up table.
  *
  *              @note enable the `crc16_fast` module for a look-up table based
- *              implementation that trades code size for speed.
+ *              implementation that trades code size for speed, or the
+ *              `crc16_slicing` module for a slicing-by-N implementation that
+ *              is faster still at the price of larger tables, see
+ *              @ref sys_checksum_crc.
  *
  * @{
  * @file
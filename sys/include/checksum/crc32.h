@@ -33,7 +33,9 @@ extern "C" {
  * Uses the `0xedb88320` polynomial
  *
  * @note enable the `crc32_fast` module for a look-up table based implementation
- *       that trades code size for speed.
+ *       that trades code size for speed, or the `crc32_slicing` module for a
+ *       slicing-by-N implementation that is faster still but needs
+ *       @ref CONFIG_CRC_SLICING_BY KiB of tables.
  *
  * @param[in] buf   The data to checksum
  * @param[in] size  Length of the data in bytes
@@ -42,6 +44,20 @@ extern "C" {
  */
 uint32_t crc32(const void *buf, size_t size);
 
+/**
+ * @brief   Update a CRC-32 checksum with more data
+ *
+ * `crc32_update(crc32(a, a_len), b, b_len)` is the checksum of the
+ * concatenation of `a` and `b`.
+ *
+ * @param[in] crc   Checksum of the preceding data, 0 to start
+ * @param[in] buf   The data to checksum
+ * @param[in] size  Length of the data in bytes
+ *
+ * @return  Checksum of the preceding data followed by @p buf
+ */
+uint32_t crc32_update(uint32_t crc, const void *buf, size_t size);
+
 #ifdef __cplusplus
 }
 #endif
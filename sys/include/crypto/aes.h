@@ -30,6 +30,7 @@
 #ifndef CRYPTO_AES_H
 #define CRYPTO_AES_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "crypto/ciphers.h"
 
@@ -105,6 +106,26 @@ int aes_init(cipher_context_t *context, const uint8_t *key, uint8_t keySize);
 int aes_encrypt(const cipher_context_t *context, const uint8_t *plain_block,
                 uint8_t *cipher_block);
 
+/**
+ * @brief   encrypts consecutive blocks
+ *
+ * The key schedule is computed once for all blocks, so this is considerably
+ * faster than calling @ref aes_encrypt for every block.
+ *
+ * @param       context       the cipher_context_t-struct to use for this
+ *                            encryption
+ * @param       input         the plaintext blocks
+ * @param       output        the place where the ciphertext blocks will be
+ *                            stored, may be the same as @p input
+ * @param       nblocks       number of blocks
+ *
+ * @return  1 on success
+ * @return  A negative value if the cipher key cannot be expanded with the
+ *          AES key schedule
+ */
+int aes_encrypt_blocks(const cipher_context_t *context, const uint8_t *input,
+                       uint8_t *output, size_t nblocks);
+
 /**
  * @brief   decrypts one cipher-block and saves the plain-block in plainBlock.
  *          decrypts one blocksize long block of ciphertext pointed to by
@@ -22,6 +22,7 @@
 #ifndef CRYPTO_CIPHERS_H
 #define CRYPTO_CIPHERS_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "modules.h"
 
@@ -102,6 +103,15 @@ typedef struct cipher_interface_st {
     /** @brief the decrypt function */
     int (*decrypt)(const cipher_context_t *ctx, const uint8_t *cipher_block,
                    uint8_t *plain_block);
+
+    /**
+     * @brief the function encrypting consecutive blocks at once
+     *
+     * Optional, if NULL @ref cipher_encrypt_blocks calls @p encrypt for
+     * every block.
+     */
+    int (*encrypt_blocks)(const cipher_context_t *ctx, const uint8_t *input,
+                          uint8_t *output, size_t nblocks);
 } cipher_interface_t;
 
 /** Pointer type to BlockCipher-Interface for the Cipher-Algorithms */
@@ -157,6 +167,25 @@ int cipher_init(cipher_t *cipher, cipher_id_t cipher_id, const uint8_t *key,
 int cipher_encrypt(const cipher_t *cipher, const uint8_t *input,
                    uint8_t *output);
 
+/**
+ * @brief Encrypt consecutive blocks of BLOCK_SIZE length
+ *
+ * Equivalent to calling @ref cipher_encrypt for every block, but ciphers
+ * can process all blocks in one call, e.g. expanding the key only once.
+ *
+ * @param cipher     Already initialized cipher struct
+ * @param input      pointer to input data to encrypt
+ * @param output     pointer to allocated memory for encrypted data. It has to
+ *                   be of size nblocks * BLOCK_SIZE and may be the same as
+ *                   @p input
+ * @param nblocks    number of blocks
+ *
+ * @return           1 in case of success
+ * @return           A negative value for an error
+ */
+int cipher_encrypt_blocks(const cipher_t *cipher, const uint8_t *input,
+                          uint8_t *output, size_t nblocks);
+
 /**
  * @brief Decrypt data of BLOCK_SIZE length
  * *
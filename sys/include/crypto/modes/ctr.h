@@ -26,6 +26,16 @@
 extern "C" {
 #endif
 
+/**
+ * @brief   Number of counter blocks encrypted with one call to
+ *          @ref cipher_encrypt_blocks
+ *
+ * The key stream is generated in a stack buffer of this many blocks.
+ */
+#ifndef CONFIG_CIPHER_CTR_BATCH
+#define CONFIG_CIPHER_CTR_BATCH     (4U)
+#endif
+
 /**
  * @brief Encrypt data of arbitrary length in counter mode.
  *
@@ -121,6 +121,29 @@ extern "C" {
 #define THREAD_FLAG_EVENT   (0x1)
 #endif
 
+/**
+ * @brief   Maximum number of events @ref event_loop_batched_multi() takes
+ *          from a queue at once
+ *
+ * A larger value means fewer look-ups, but a higher priority queue has to
+ * wait for up to this many handlers of a lower priority queue.
+ */
+#ifndef CONFIG_EVENT_LOOP_BATCH_SIZE
+#define CONFIG_EVENT_LOOP_BATCH_SIZE    (8U)
+#endif
+
+/**
+ * @brief   Number of buckets of the dispatch latency histogram of
+ *          @ref event_queue_stats_t
+ *
+ * Bucket 0 counts latencies below 16 us, each following bucket covers four
+ * times the range of the previous one. The last bucket counts everything
+ * above.
+ */
+#ifndef CONFIG_EVENT_STATS_LATENCY_NUMOF
+#define CONFIG_EVENT_STATS_LATENCY_NUMOF    (8U)
+#endif
+
 /**
  * @brief   event_queue_t static initializer
  */
@@ -149,12 +172,39 @@ struct event {
     event_handler_t handler;    /**< pointer to event handler function  */
 };
 
+/**
+ * @brief   Event queue statistics
+ *
+ * The latency and the batch counters are only updated by
+ * @ref event_get_batch() (and thus @ref event_loop_batched_multi()).
+ *
+ * @note    Only available with module `event_stats`.
+ */
+typedef struct {
+    uint32_t since;             /**< time the queue became non-empty in us  */
+    uint16_t depth;             /**< number of queued events                */
+    uint16_t depth_max;         /**< high-water mark of event_queue_stats_t::depth */
+    uint32_t batches;           /**< number of non-empty batches taken      */
+    uint32_t events;            /**< number of events taken in batches      */
+    uint16_t batch_max;         /**< largest batch taken                    */
+    /**
+     * @brief   Histogram of the time from the queue becoming non-empty until
+     *          the batch was taken
+     *
+     * @see     CONFIG_EVENT_STATS_LATENCY_NUMOF
+     */
+    uint32_t latency[CONFIG_EVENT_STATS_LATENCY_NUMOF];
+} event_queue_stats_t;
+
 /**
  * @brief   event queue structure
  */
 typedef struct PTRTAG {
     clist_node_t event_list;    /**< list of queued events              */
     thread_t *waiter;           /**< thread owning event queue          */
+#if IS_USED(MODULE_EVENT_STATS) || defined(DOXYGEN)
+    event_queue_stats_t stats;  /**< statistics, needs module `event_stats` */
+#endif
 } event_queue_t;
 
 /**
@@ -289,6 +339,34 @@ void event_cancel(event_queue_t *queue, event_t *event);
  */
 event_t *event_get(event_queue_t *queue);
 
+/**
+ * @brief   Get up to @p max events from event queue at once, non-blocking
+ *
+ * Takes the events in the order they were posted with interrupts disabled
+ * only once. The events stay pending until they are handed to
+ * @ref event_dispatch_batch(): posting them again has no effect, and
+ * event_cancel() prevents their handler from being called.
+ *
+ * @param[in]   queue   event queue to get events from
+ * @param[out]  events  array to store the events in
+ * @param[in]   max     maximum number of events to get, size of @p events
+ *
+ * @returns     number of events stored in @p events
+ */
+size_t event_get_batch(event_queue_t *queue, event_t **events, size_t max);
+
+/**
+ * @brief   Calls the handlers of events obtained by @ref event_get_batch()
+ *
+ * Events cancelled after they were taken from their queue are skipped. An
+ * event is no longer pending when its handler is called, so the handler may
+ * post it again.
+ *
+ * @param[in]   events  events obtained by @ref event_get_batch()
+ * @param[in]   numof   number of events in @p events
+ */
+void event_dispatch_batch(event_t **events, size_t numof);
+
 /**
  * @brief   Get next event from the given event queues, blocking
  *
@@ -429,6 +507,55 @@ static inline void event_loop_multi(event_queue_t *queues, size_t n_queues)
     }
 }
 
+/**
+ * @brief   Event loop with multiple queues handling events in batches
+ *
+ * Works like @ref event_loop_multi(), but takes up to
+ * @ref CONFIG_EVENT_LOOP_BATCH_SIZE events of the highest priority non-empty
+ * queue at once using @ref event_get_batch() and handles all of them before
+ * looking at the queues again. Under bursty load, this reduces the
+ * per-event overhead, at the price of a higher priority queue having to wait
+ * for a batch of a lower priority queue to finish.
+ *
+ * The event threads of @ref sys_event_thread use this loop when module
+ * `event_thread_batched` is used.
+ *
+ * @pre     The queue must have a waiter (i.e. it should have been claimed, or
+ *          initialized using @ref event_queue_init, @ref event_queues_init)
+ *
+ * @param[in]   queues      Event queues to process
+ * @param[in]   n_queues    Number of queues passed with @p queues
+ */
+void event_loop_batched_multi(event_queue_t *queues, size_t n_queues);
+
+/**
+ * @brief   Event loop handling events in batches
+ *
+ * @see     event_loop_batched_multi
+ *
+ * @pre     The queue must have a waiter (i.e. it should have been claimed, or
+ *          initialized using @ref event_queue_init, @ref event_queues_init)
+ *
+ * @param[in]   queue   event queue to process
+ */
+static inline void event_loop_batched(event_queue_t *queue)
+{
+    event_loop_batched_multi(queue, 1);
+}
+
+#if IS_USED(MODULE_EVENT_STATS) || defined(DOXYGEN)
+/**
+ * @brief   Get a consistent copy of the statistics of an event queue
+ *
+ * @note    Only available with module `event_stats`.
+ *
+ * @param[in]   queue   event queue to get the statistics of
+ * @param[out]  stats   statistics of @p queue
+ */
+void event_queue_get_stats(const event_queue_t *queue,
+                           event_queue_stats_t *stats);
+#endif
+
 /**
  * @brief   Simple event loop
  *
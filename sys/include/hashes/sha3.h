@@ -52,8 +52,8 @@ extern "C" {
  * @brief Context for operations on a sponge with keccak permutation
  */
 typedef struct {
-    /** State of the Keccak sponge */
-    unsigned char state[200];
+    /** State of the Keccak sponge, aligned to be permuted as 64-bit lanes */
+    unsigned char state[200] __attribute__((aligned(8)));
     /** Current position within the state */
     unsigned int i;
     /** The suffix used for padding */
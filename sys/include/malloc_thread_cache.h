@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_malloc_thread_cache Thread-cached small-object allocator
+ * @ingroup     sys_malloc_ts
+ * @brief       Per-thread caches for small allocations on top of
+ *              @ref sys_malloc_ts
+ *
+ * With module `malloc_thread_cache`, allocations of up to
+ * @ref MALLOC_THREAD_CACHE_MAX_SIZE bytes are served from a static arena that
+ * is carved into slabs of @ref CONFIG_MALLOC_THREAD_CACHE_SLAB_SIZE bytes, one
+ * size class per slab. Every thread keeps a free list per size class, so most
+ * calls to `malloc()` and `free()` of small objects neither take the global
+ * heap lock nor call into the C library. Only when a thread's free list runs
+ * empty (or grows beyond @ref CONFIG_MALLOC_THREAD_CACHE_LIMIT) blocks are
+ * moved in batches of @ref CONFIG_MALLOC_THREAD_CACHE_BATCH between it and a
+ * global free list, with the heap lock held.
+ *
+ * Larger allocations, allocations before the scheduler is started and small
+ * allocations when the arena is exhausted fall back to the C library.
+ *
+ * The shell command `malloc_cache` (module `shell_cmd_malloc_thread_cache`)
+ * prints the statistics below.
+ *
+ * @note    Memory freed by one thread is cached by that thread, no matter
+ *          which thread allocated it. When a thread exits, its cached blocks
+ *          are returned to the global free lists. Slabs are never returned to
+ *          the C library.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Thread-cached small-object allocator statistics
+ */
+
+#ifndef MALLOC_THREAD_CACHE_H
+#define MALLOC_THREAD_CACHE_H
+
+#include <stdint.h>
+
+#include "sched.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup sys_malloc_thread_cache_conf Thread-cached allocator compile configurations
+ * @ingroup config
+ * @{
+ */
+/**
+ * @brief   Size of the static arena small objects are allocated from in bytes
+ */
+#ifndef CONFIG_MALLOC_THREAD_CACHE_ARENA_SIZE
+#define CONFIG_MALLOC_THREAD_CACHE_ARENA_SIZE   (4096U)
+#endif
+
+/**
+ * @brief   Size of a slab in bytes
+ *
+ * A slab holds blocks of one size class only. Must be a multiple of the
+ * largest size class.
+ */
+#ifndef CONFIG_MALLOC_THREAD_CACHE_SLAB_SIZE
+#define CONFIG_MALLOC_THREAD_CACHE_SLAB_SIZE    (256U)
+#endif
+
+/**
+ * @brief   Number of size classes
+ *
+ * The smallest class holds 16 bytes, every further class doubles the size.
+ */
+#ifndef CONFIG_MALLOC_THREAD_CACHE_CLASSES
+#define CONFIG_MALLOC_THREAD_CACHE_CLASSES      (4U)
+#endif
+
+/**
+ * @brief   Number of blocks moved between a thread's cache and the global
+ *          free list at once
+ */
+#ifndef CONFIG_MALLOC_THREAD_CACHE_BATCH
+#define CONFIG_MALLOC_THREAD_CACHE_BATCH        (4U)
+#endif
+
+/**
+ * @brief   Maximum number of free blocks a thread caches per size class
+ *
+ * When exceeded, @ref CONFIG_MALLOC_THREAD_CACHE_BATCH blocks are returned to
+ * the global free list.
+ */
+#ifndef CONFIG_MALLOC_THREAD_CACHE_LIMIT
+#define CONFIG_MALLOC_THREAD_CACHE_LIMIT        (2 * CONFIG_MALLOC_THREAD_CACHE_BATCH)
+#endif
+/** @} */
+
+/**
+ * @brief   Size of the smallest size class in bytes
+ */
+#define MALLOC_THREAD_CACHE_MIN_SIZE    (16U)
+
+/**
+ * @brief   Size of the largest size class in bytes
+ */
+#define MALLOC_THREAD_CACHE_MAX_SIZE    \
+    (MALLOC_THREAD_CACHE_MIN_SIZE << (CONFIG_MALLOC_THREAD_CACHE_CLASSES - 1))
+
+/**
+ * @brief   Allocation statistics of a thread
+ */
+typedef struct {
+    uint32_t allocs;            /**< number of allocations */
+    uint32_t frees;             /**< number of deallocations */
+    uint32_t cache_hits;        /**< allocations served without locking */
+    uint32_t refills;           /**< batches taken from the global free list */
+    uint32_t flushes;           /**< batches returned to the global free list */
+    uint32_t fallbacks;         /**< allocations passed to the C library */
+    uint16_t cached;            /**< free blocks in the thread's cache */
+} malloc_thread_cache_thread_stats_t;
+
+/**
+ * @brief   Statistics of a size class
+ */
+typedef struct {
+    uint16_t size;              /**< block size in bytes */
+    uint16_t slabs;             /**< slabs assigned to the size class */
+    uint16_t blocks;            /**< blocks in those slabs */
+    uint16_t free_global;       /**< blocks in the global free list */
+    uint16_t free_cached;       /**< blocks in the caches of all threads */
+} malloc_thread_cache_class_stats_t;
+
+/**
+ * @brief   Gets the allocation statistics of a thread
+ *
+ * @param[in]  pid      The thread
+ * @param[out] stats    The statistics
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p pid is invalid
+ */
+int malloc_thread_cache_thread_stats(kernel_pid_t pid,
+                                     malloc_thread_cache_thread_stats_t *stats);
+
+/**
+ * @brief   Gets the statistics of a size class
+ *
+ * The free blocks of a class (in the global free list and in the thread
+ * caches) are external fragmentation: they can only be used by allocations of
+ * that class.
+ *
+ * @param[in]  idx      Index of the size class, smaller than
+ *                      @ref CONFIG_MALLOC_THREAD_CACHE_CLASSES
+ * @param[out] stats    The statistics
+ *
+ * @return  0 on success
+ * @return  -EINVAL if @p idx is invalid
+ */
+int malloc_thread_cache_class_stats(unsigned idx,
+                                    malloc_thread_cache_class_stats_t *stats);
+
+/**
+ * @brief   Gets the number of slabs of the arena not yet assigned to a size
+ *          class
+ *
+ * @return  Number of free slabs
+ */
+unsigned malloc_thread_cache_free_slabs(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MALLOC_THREAD_CACHE_H */
+/** @} */
@@ -34,6 +34,7 @@ extern "C" {
  * @{
  */
 #define DNS_TYPE_A              (1)
+#define DNS_TYPE_SOA            (6)
 #define DNS_TYPE_AAAA           (28)
 #define DNS_CLASS_IN            (1)
 /** @} */
@@ -19,13 +19,23 @@
  *
  * This implements a simple DNS cache for A and AAAA entries.
  *
+ * Entries are stored in a hash table with linear probing. A name is only
+ * looked for in the @ref CONFIG_DNS_CACHE_PROBES slots following its hash, so
+ * lookups take the same time for any @ref CONFIG_DNS_CACHE_SIZE.
+ *
  * The cache eviction strategy is based on the remaining time to live
- * of the cache entries, so the first entry to expire will be evicted.
+ * of the cache entries, so the first entry within the probed slots to expire
+ * will be evicted.
+ *
+ * Negative responses (the name does not exist or has no address of the
+ * requested family) are cached as well, see
+ * [RFC 2308](https://tools.ietf.org/html/rfc2308). A query for such a name
+ * fails with `-ENOENT` until the negative entry expires, so clients do not ask
+ * the server again and again.
  *
- * This is fine if there are only few cache entries and cache eviction
- * is unlikely.
- * If there is communication to many different hosts, the addition of a
- * least-recently used counter could likely improve the behavior.
+ * With dns_cache_query_prefetch(), a client is asked once to refresh an entry
+ * that expires in less than @ref CONFIG_DNS_CACHE_PREFETCH_THRESHOLD seconds,
+ * so frequently used names do not expire.
  *
  * @author  Benjamin Valentin <benjamin.valentin@ml-pa.com>
  */
@@ -33,7 +43,9 @@
 #ifndef NET_DNS_CACHE_H
 #define NET_DNS_CACHE_H
 
+#include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "modules.h"
 
@@ -62,6 +74,39 @@ extern "C" {
 #define CONFIG_DNS_CACHE_AAAA   IS_USED(MODULE_IPV6)
 #endif
 
+/**
+ * @brief   Maximum number of slots probed for a DNS name
+ */
+#ifndef CONFIG_DNS_CACHE_PROBES
+#define CONFIG_DNS_CACHE_PROBES 8
+#endif
+
+/**
+ * @brief   Upper bound for the lifetime of negative entries in seconds
+ */
+#ifndef CONFIG_DNS_CACHE_NEGATIVE_TTL_MAX
+#define CONFIG_DNS_CACHE_NEGATIVE_TTL_MAX   300
+#endif
+
+/**
+ * @brief   Remaining lifetime in seconds below which a client using
+ *          dns_cache_query_prefetch() is asked to refresh an entry
+ */
+#ifndef CONFIG_DNS_CACHE_PREFETCH_THRESHOLD
+#define CONFIG_DNS_CACHE_PREFETCH_THRESHOLD 10
+#endif
+
+/**
+ * @brief   DNS cache statistics
+ */
+typedef struct {
+    uint32_t hits;              /**< queries answered with an address */
+    uint32_t negative_hits;     /**< queries answered by a negative entry */
+    uint32_t misses;            /**< queries not answered by the cache */
+    uint32_t prefetches;        /**< clients asked to refresh an entry */
+    uint32_t evictions;         /**< entries evicted before they expired */
+} dns_cache_stats_t;
+
 #if IS_USED(MODULE_DNS_CACHE) || DOXYGEN
 /**
  * @brief Get IP address for a DNS name from the DNS cache
@@ -71,10 +116,36 @@ extern "C" {
  * @param[in]   family          Either AF_INET, AF_INET6 or AF_UNSPEC
  *
  * @return      the size of the resolved address on success
- * @return      <= 0 otherwise
+ * @return      -ENOENT if @p domain_name is known to have no address of
+ *              @p family
+ * @return      0 if @p domain_name is not in the cache
  */
 int dns_cache_query(const char *domain_name, void *addr_out, int family);
 
+/**
+ * @brief Get IP address for a DNS name from the DNS cache and check whether
+ *        the entry should be refreshed
+ *
+ * Same as dns_cache_query(), but sets @p prefetch if the entry expires in less
+ * than @ref CONFIG_DNS_CACHE_PREFETCH_THRESHOLD seconds and no other client
+ * was asked to refresh it yet. The client should then query the DNS server
+ * and add the response to the cache, and may still use the address in
+ * @p addr_out if that fails.
+ *
+ * @param[in]   domain_name     DNS name to resolve into address
+ * @param[out]  addr_out        buffer to write result into
+ * @param[in]   family          Either AF_INET, AF_INET6 or AF_UNSPEC
+ * @param[out]  prefetch        true if the caller should refresh the entry,
+ *                              may be NULL
+ *
+ * @return      the size of the resolved address on success
+ * @return      -ENOENT if @p domain_name is known to have no address of
+ *              @p family
+ * @return      0 if @p domain_name is not in the cache
+ */
+int dns_cache_query_prefetch(const char *domain_name, void *addr_out, int family,
+                             bool *prefetch);
+
 /**
  * @brief Add an IP address for a DNS name to the DNS cache
  *
@@ -84,6 +155,25 @@ int dns_cache_query(const char *domain_name, void *addr_out, int family);
  * @param[in]   ttl             lifetime of the entry in seconds
  */
 void dns_cache_add(const char *domain_name, const void *addr, int addr_len, uint32_t ttl);
+
+/**
+ * @brief Add a negative response for a DNS name to the DNS cache
+ *
+ * @param[in]   domain_name     DNS name that could not be resolved
+ * @param[in]   family          AF_INET or AF_INET6 if @p domain_name has no
+ *                              address of that family, AF_UNSPEC if it has
+ *                              none or does not exist at all
+ * @param[in]   ttl             lifetime of the entry in seconds, limited to
+ *                              @ref CONFIG_DNS_CACHE_NEGATIVE_TTL_MAX
+ */
+void dns_cache_add_negative(const char *domain_name, int family, uint32_t ttl);
+
+/**
+ * @brief Get the DNS cache statistics
+ *
+ * @param[out]  stats           the statistics
+ */
+void dns_cache_get_stats(dns_cache_stats_t *stats);
 #else
 static inline int dns_cache_query(const char *domain_name, void *addr_out, int family)
 {
@@ -93,6 +183,18 @@ static inline int dns_cache_query(const char *domain_name, void *addr_out, int f
     return 0;
 }
 
+static inline int dns_cache_query_prefetch(const char *domain_name, void *addr_out,
+                                           int family, bool *prefetch)
+{
+    (void)domain_name;
+    (void)addr_out;
+    (void)family;
+    if (prefetch) {
+        *prefetch = false;
+    }
+    return 0;
+}
+
 static inline void dns_cache_add(const char *domain_name, const void *addr,
                                  int addr_len, uint32_t ttl)
 {
@@ -101,6 +203,19 @@ static inline void dns_cache_add(const char *domain_name, const void *addr,
     (void)addr_len;
     (void)ttl;
 }
+
+static inline void dns_cache_add_negative(const char *domain_name, int family,
+                                          uint32_t ttl)
+{
+    (void)domain_name;
+    (void)family;
+    (void)ttl;
+}
+
+static inline void dns_cache_get_stats(dns_cache_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+}
 #endif
 
 #ifdef __cplusplus
@@ -107,6 +107,11 @@ size_t dns_msg_compose_query(void *dns_buf, const char *domain_name,
  * @param[out] ttl          The live time of the entry in seconds
  *
  * @return  Length of the @p addr_out on success.
+ * @return  -ENOENT, when @p buf is a negative response, i.e. the name does not
+ *          exist (NXDOMAIN) or has no address corresponding to @p family
+ *          (NODATA). @p ttl is then set to the negative caching TTL of the
+ *          response (see [RFC 2308, section 5](https://tools.ietf.org/html/rfc2308#section-5)),
+ *          or 0 if it must not be cached.
  * @return  -EBADMSG, when an address corresponding to @p family can not be found
  *          in @p buf.
  */
@@ -13,6 +13,12 @@
  *
  * This module is unused by RIOT's networking stacks, see @ref net_gnrc_ipv6_nib_ft
  * instead.
+ *
+ * Single hop entries are hashed by their prefix. A look-up probes only the
+ * prefix lengths in use, longest first, so its cost depends on the number of
+ * distinct prefix lengths rather than on the number of entries. Size the hash
+ * with @ref CONFIG_FIB_BUCKETS. Entries with a lifetime are kept in a list
+ * sorted by expiry, so the clock is only read while such entries exist.
  * @{
  *
  * @file
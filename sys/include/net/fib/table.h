@@ -35,10 +35,26 @@ extern "C" {
  */
 #define FIB_MAX_REGISTERED_RP (5)
 
+/**
+ * @brief number of hash buckets indexing the entries of a single hop table
+ *
+ * Must be a power of two. Entries are hashed by their prefix, so look-ups
+ * stay fast as long as this is in the order of the table size.
+ */
+#ifndef CONFIG_FIB_BUCKETS
+#define CONFIG_FIB_BUCKETS (16)
+#endif
+
+/**
+ * @brief number of words of the bitmap of prefix lengths in use
+ */
+#define FIB_PREFIX_LEN_WORDS (((UNIVERSAL_ADDRESS_SIZE * 8) / \
+                               (sizeof(unsigned) * 8)) + 1)
+
 /**
  * @brief Container descriptor for a FIB entry
  */
-typedef struct {
+typedef struct fib_entry {
     /** interface ID */
     kernel_pid_t iface_id;
     /** Lifetime of this entry (an absolute time-point is stored by the FIB) */
@@ -51,6 +67,13 @@ typedef struct {
     uint32_t next_hop_flags;
     /** Pointer to the shared generic address */
     universal_address_container_t *next_hop;
+    /** Next entry in the same hash bucket or in the list of unused entries */
+    struct fib_entry *next;
+    /** Next entry in the expiry list */
+    struct fib_entry *expiry_next;
+    /** Number of significant bits of the global address, 0 for a default
+     *  route */
+    uint16_t prefix_len;
 } fib_entry_t;
 
 /**
@@ -133,6 +156,17 @@ typedef struct {
     *   e.g. when the unreachable destination is covered by the prefix
     */
     universal_address_container_t* prefix_rp[FIB_MAX_REGISTERED_RP];
+    /** single hop entries, hashed by their prefix */
+    fib_entry_t *buckets[CONFIG_FIB_BUCKETS];
+    /** bitmap of the prefix lengths of all single hop entries */
+    unsigned prefix_lens[FIB_PREFIX_LEN_WORDS];
+    /** number of single hop entries per prefix length, a bit in
+     *  fib_table_t::prefix_lens is set as long as its count is not 0 */
+    uint16_t prefix_len_refs[(UNIVERSAL_ADDRESS_SIZE * 8) + 1];
+    /** single hop entries with a finite lifetime, the next to expire first */
+    fib_entry_t *expiry;
+    /** unused single hop entries */
+    fib_entry_t *unused;
 } fib_table_t;
 
 #ifdef __cplusplus
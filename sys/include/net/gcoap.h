@@ -191,6 +191,17 @@
  * Finally, call gcoap_obs_send() for the resource, with the sum of the
  * metadata length and payload length for the representation.
  *
+ * ### Notifying many observers ###
+ *
+ * By default, only one client at a time can observe a resource. Set
+ * @ref CONFIG_GCOAP_OBS_RESOURCE_OBSERVERS_MAX to allow more. Then send
+ * notifications with gcoap_obs_notify_all() instead of gcoap_obs_send(). The
+ * notification is built once as above. For every observer, only the header
+ * with its token and a new message ID is rebuilt, and the options and payload
+ * are sent from the same buffer. Registrations are indexed by resource, so
+ * finding the observers of a resource does not depend on the total number of
+ * registrations.
+ *
  * ### Other considerations ###
  *
  * By default, the value for the Observe option in a notification is three
@@ -563,6 +574,25 @@ extern "C" {
 #define CONFIG_GCOAP_OBS_REGISTRATIONS_MAX     (2)
 #endif
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Maximum number of clients that can observe the same resource
+ *
+ * With more than one, use gcoap_obs_notify_all() to send notifications.
+ */
+#ifndef CONFIG_GCOAP_OBS_RESOURCE_OBSERVERS_MAX
+#define CONFIG_GCOAP_OBS_RESOURCE_OBSERVERS_MAX    (1)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of buckets of the index of Observe registrations by
+ *          resource
+ */
+#ifndef CONFIG_GCOAP_OBS_INDEX_BUCKETS
+#define CONFIG_GCOAP_OBS_INDEX_BUCKETS  (CONFIG_GCOAP_OBS_REGISTRATIONS_MAX)
+#endif
+
 /**
  * @name    States for the memo used to track Observe registrations
  * @{
@@ -833,7 +863,8 @@ struct gcoap_request_memo {
 /**
  * @brief   Memo for Observe registration and notifications
  */
-typedef struct {
+typedef struct gcoap_observe_memo {
+    struct gcoap_observe_memo *next;    /**< Next memo in the same index bucket */
     sock_udp_ep_t *observer;            /**< Client endpoint; unused if null */
     const coap_resource_t *resource;    /**< Entity being observed */
     uint8_t token[GCOAP_TOKENLEN_MAX];  /**< Client token for notifications */
@@ -1062,7 +1093,8 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
  * @brief   Sends a buffer containing a CoAP Observe notification to the
  *          observer registered for a resource
  *
- * Assumes a single observer for a resource.
+ * Assumes a single observer for a resource. Use gcoap_obs_notify_all() if
+ * @ref CONFIG_GCOAP_OBS_RESOURCE_OBSERVERS_MAX is greater than 1.
  *
  * @param[in] buf Buffer containing the PDU
  * @param[in] len Length of the buffer
@@ -1074,6 +1106,42 @@ int gcoap_obs_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 size_t gcoap_obs_send(const uint8_t *buf, size_t len,
                       const coap_resource_t *resource);
 
+/**
+ * @brief   Sends a CoAP Observe notification to all observers registered for
+ *          a resource
+ *
+ * @p buf must be initialized with gcoap_obs_init() for @p resource. For each
+ * observer, a header with the token of the observer and a new message ID is
+ * built, followed by the options and payload of @p buf. The notifications are
+ * sent back to back.
+ *
+ * @param[in] buf       Buffer containing the PDU
+ * @param[in] len       Length of the PDU in @p buf
+ * @param[in] resource  Resource to send
+ *
+ * @return  number of observers notified
+ */
+size_t gcoap_obs_notify_all(const uint8_t *buf, size_t len,
+                            const coap_resource_t *resource);
+
+/**
+ * @brief   Observe notification statistics
+ */
+typedef struct {
+    uint32_t notifications;     /**< notifications sent by gcoap_obs_notify_all() */
+    uint32_t bursts;            /**< calls to gcoap_obs_notify_all() */
+    uint32_t rate;              /**< notifications sent during the last full second */
+    uint32_t encode_usec;       /**< time spent building headers in microseconds */
+    uint32_t send_usec;         /**< time spent sending in microseconds */
+} gcoap_obs_stats_t;
+
+/**
+ * @brief   Gets the Observe notification statistics
+ *
+ * @param[out] stats    The statistics
+ */
+void gcoap_obs_get_stats(gcoap_obs_stats_t *stats);
+
 /**
  * @brief   Provides important operational statistics
  *
@@ -98,6 +98,8 @@
 #ifndef NET_GNRC_IPV6_H
 #define NET_GNRC_IPV6_H
 
+#include <stdbool.h>
+
 #include "sched.h"
 #include "thread.h"
 
@@ -229,6 +231,29 @@ kernel_pid_t gnrc_ipv6_init(void);
  */
 ipv6_hdr_t *gnrc_ipv6_get_header(gnrc_pktsnip_t *pkt);
 
+/**
+ * @brief   Delivers a received UDP datagram to its sockets in the calling
+ *          thread
+ *
+ * Called by the network interface (or 6LoWPAN) thread for every received
+ * IPv6 packet. Packets that take the threaded path, e.g. because they carry
+ * extension headers, ICMPv6 or need to be forwarded, are left untouched.
+ *
+ * @note    Only available with module `gnrc_udp_fastpath`.
+ *
+ * @warning The socket callbacks run on the stack of the calling thread. Only
+ *          network interfaces created with the default stack size and the
+ *          6LoWPAN thread reserve @ref GNRC_UDP_FASTPATH_EXTRA_STACKSIZE for
+ *          that; drivers passing their own stack size must add it.
+ *
+ * @param[in] pkt   A received packet in receive order, starting with the
+ *                  IPv6 header.
+ *
+ * @return  true, if @p pkt was consumed.
+ * @return  false, if @p pkt must be passed on to the IPv6 thread.
+ */
+bool gnrc_ipv6_fastpath_recv(gnrc_pktsnip_t *pkt);
+
 #ifdef __cplusplus
 }
 #endif
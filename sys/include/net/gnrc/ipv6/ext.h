@@ -49,12 +49,33 @@ extern "C" {
  *
  * This limits the total amount of datagrams that can be fragmented at the same time.
  *
+ * The default stays at 1: a datagram that needs fragmentation is larger than
+ * the link MTU and stays in the packet buffer until its last fragment is sent,
+ * so a second one in flight would claim most of the remaining default
+ * @ref CONFIG_GNRC_PKTBUF_SIZE. Increase it together with the packet buffer
+ * size; concurrent datagrams are then sent interleaved, one burst of
+ * @ref CONFIG_GNRC_IPV6_EXT_FRAG_SEND_BURST fragments per round each.
+ *
  * @note    Only applicable with [gnrc_ipv6_ext_frag](@ref net_gnrc_ipv6_ext_frag) module
  */
 #ifndef CONFIG_GNRC_IPV6_EXT_FRAG_SEND_SIZE
 #define CONFIG_GNRC_IPV6_EXT_FRAG_SEND_SIZE    (1U)
 #endif
 
+/**
+ * @brief   Maximum number of fragments sent in one go
+ *
+ * A datagram is fragmented in rounds of the IPv6 thread, so other packets can
+ * be sent in between. This is the number of fragments that is passed to the
+ * IPv6 thread per round. It is further bounded by the free space in its
+ * message queue.
+ *
+ * @note    Only applicable with [gnrc_ipv6_ext_frag](@ref net_gnrc_ipv6_ext_frag) module
+ */
+#ifndef CONFIG_GNRC_IPV6_EXT_FRAG_SEND_BURST
+#define CONFIG_GNRC_IPV6_EXT_FRAG_SEND_BURST   (4U)
+#endif
+
 /**
  * @brief   IPv6 fragmentation reassembly buffer size
  *
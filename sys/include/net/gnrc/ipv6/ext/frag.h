@@ -84,12 +84,16 @@ typedef struct {
     /**
      * @brief   The limits of the fragments in the reassembled packet
      *
+     * Limits are sorted by their start, and overlapping or adjacent limits
+     * are merged, so the list holds one element per gap-free range.
+     *
      * @note    Members of this list can be cast to gnrc_ipv6_ext_frag_limits_t.
      */
     clist_node_t limits;
     uint32_t id;            /**< the identification from the fragment headers */
     uint32_t arrival;       /**< arrival time of last received fragment */
     uint16_t pkt_len;       /**< length of gnrc_ipv6_ext_frag_rbuf_t::pkt */
+    uint16_t frags;         /**< number of received fragments */
     uint8_t last;           /**< received last fragment */
 } gnrc_ipv6_ext_frag_rbuf_t;
 
@@ -103,6 +107,10 @@ typedef struct {
                              *   no @ref gnrc_sixlowpan_frag_fb_t available */
     unsigned datagrams;     /**< reassembled datagrams */
     unsigned fragments;     /**< total fragments of reassembled fragments */
+    unsigned sent_datagrams;    /**< fragmented datagrams that were sent */
+    unsigned sent_fragments;    /**< fragments that were sent */
+    unsigned bursts;        /**< rounds in which fragments were sent, see
+                             *   @ref CONFIG_GNRC_IPV6_EXT_FRAG_SEND_BURST */
 } gnrc_ipv6_ext_frag_stats_t;
 
 /**
@@ -297,6 +297,22 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_NUMOF                   (4)
 #endif
 
+/**
+ * @brief   Use a hash index to look up neighbor cache entries
+ *
+ * Without this, every neighbor cache look-up (i.e. every address resolution
+ * for an outgoing unicast packet) scans all @ref CONFIG_GNRC_IPV6_NIB_NUMOF
+ * entries. With this, an open-addressing hash table over the IPv6 addresses
+ * of the entries is kept, at the price of 2 * @ref CONFIG_GNRC_IPV6_NIB_NUMOF
+ * slot indexes of RAM. Probe length statistics are available via
+ * @ref gnrc_ipv6_nib_nc_get_hash_stats().
+ *
+ * Only worth it for nodes with a lot of neighbors, e.g. in dense meshes.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_NC_HASH
+#define CONFIG_GNRC_IPV6_NIB_NC_HASH                 0
+#endif
+
 /**
  * @brief   Number of off-link entries in NIB
  *
@@ -307,6 +323,21 @@ extern "C" {
 #define CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF              (8)
 #endif
 
+/**
+ * @brief   Use a longest-prefix-match trie to look up off-link entries
+ *
+ * Without this, every route look-up that is not answered by the neighbor
+ * cache scans all @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF off-link entries. With
+ * this, the look-up cost only depends on the prefix length, at the price of
+ * 2 * @ref CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF trie nodes of RAM.
+ *
+ * Only worth it for nodes with a large forwarding table, e.g. RPL roots or
+ * 6LBRs.
+ */
+#ifndef CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+#define CONFIG_GNRC_IPV6_NIB_OFFL_TRIE               0
+#endif
+
 #if CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C || defined(DOXYGEN)
 /**
  * @brief   Number of authoritative border router entries in NIB
@@ -300,6 +300,37 @@ void gnrc_ipv6_nib_nc_mark_reachable(const ipv6_addr_t *ipv6);
 bool gnrc_ipv6_nib_nc_iter(unsigned iface, void **state,
                            gnrc_ipv6_nib_nc_t *nce);
 
+#if CONFIG_GNRC_IPV6_NIB_NC_HASH || defined(DOXYGEN)
+/**
+ * @brief   Probe length statistics of the neighbor cache hash index
+ *
+ * The probe length of a look-up is the number of occupied slots of the hash
+ * index that were compared to the searched address.
+ */
+typedef struct {
+    uint32_t lookups;       /**< Number of look-ups */
+    uint32_t probes;        /**< Sum of the probe lengths of all look-ups */
+    uint16_t max_probes;    /**< Longest probe length of a single look-up */
+    uint16_t entries;       /**< Number of entries currently in the index */
+} gnrc_ipv6_nib_nc_hash_stats_t;
+
+/**
+ * @brief   Gets the probe length statistics of the neighbor cache hash index
+ *
+ * @pre `stats != NULL`
+ *
+ * @param[out] stats    The statistics.
+ * @param[in] reset     Reset gnrc_ipv6_nib_nc_hash_stats_t::lookups,
+ *                      gnrc_ipv6_nib_nc_hash_stats_t::probes, and
+ *                      gnrc_ipv6_nib_nc_hash_stats_t::max_probes after
+ *                      reading them.
+ *
+ * @note    Only available with @ref CONFIG_GNRC_IPV6_NIB_NC_HASH.
+ */
+void gnrc_ipv6_nib_nc_get_hash_stats(gnrc_ipv6_nib_nc_hash_stats_t *stats,
+                                     bool reset);
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH || defined(DOXYGEN) */
+
 /**
  * @brief   Prints a neighbor cache entry
  *
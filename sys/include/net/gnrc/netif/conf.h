@@ -175,6 +175,28 @@ extern "C" {
 #endif
 /** @} */
 
+/**
+ * @brief   Extra stack size for threads that deliver UDP datagrams to sockets
+ *
+ * With module `gnrc_udp_fastpath` the network interface threads (and the
+ * 6LoWPAN thread) run the IPv6 and UDP receive path and the asynchronous
+ * callbacks of the receiving sockets on their own stack. Increase this value
+ * if your socket callbacks need more stack.
+ *
+ * @warning Only the default stack size of the network interfaces
+ *          (`GNRC_NETIF_STACKSIZE_DEFAULT`) and the stack of the 6LoWPAN
+ *          thread include this value. Drivers that pass their own stack size
+ *          to @ref gnrc_netif_create() keep it unchanged and must add this
+ *          value themselves when used with `gnrc_udp_fastpath`.
+ */
+#ifndef GNRC_UDP_FASTPATH_EXTRA_STACKSIZE
+#if IS_USED(MODULE_GNRC_UDP_FASTPATH) || DOXYGEN
+#define GNRC_UDP_FASTPATH_EXTRA_STACKSIZE   (THREAD_EXTRA_STACKSIZE_PRINTF)
+#else
+#define GNRC_UDP_FASTPATH_EXTRA_STACKSIZE   (0)
+#endif
+#endif
+
 /**
  * @brief   Message queue size for network interface threads
  */
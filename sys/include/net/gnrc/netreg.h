@@ -72,6 +72,29 @@ typedef enum {
 } gnrc_netreg_type_t;
 #endif
 
+/**
+ * @defgroup net_gnrc_netreg_conf  GNRC network protocol registry compile
+ *                                 configurations
+ * @ingroup  net_gnrc_conf
+ * @{
+ */
+/**
+ * @brief   Number of buckets of the demultiplexing hash table
+ *
+ * Only used with the `gnrc_netreg_hash` module. Instead of one list of
+ * entries per @ref gnrc_nettype_t, entries are then kept in a hash table
+ * keyed by type and gnrc_netreg_entry_t::demux_ctx, so the cost of
+ * @ref gnrc_netreg_lookup() no longer grows with the number of registered
+ * entries (e.g. bound UDP sockets) as long as there are not significantly
+ * more entries than buckets.
+ *
+ * @note    Must be a power of 2.
+ */
+#ifndef CONFIG_GNRC_NETREG_HASH_NUMOF
+#define CONFIG_GNRC_NETREG_HASH_NUMOF   (32U)
+#endif
+/** @} */
+
 /**
  * @brief   Demux context value to get all packets of a certain type.
  *
@@ -79,6 +102,17 @@ typedef enum {
  */
 #define GNRC_NETREG_DEMUX_CTX_ALL   (0xffff0000)
 
+/**
+ * @brief   Initializer for gnrc_netreg_entry_t::nettype, set on registration
+ *
+ * @internal
+ */
+#ifdef MODULE_GNRC_NETREG_HASH
+#define _GNRC_NETREG_ENTRY_INIT_NETTYPE     , GNRC_NETTYPE_UNDEF
+#else
+#define _GNRC_NETREG_ENTRY_INIT_NETTYPE
+#endif
+
 /**
  * @name    Static entry initialization macros
  * @anchor  net_gnrc_netreg_init_static
@@ -96,9 +130,11 @@ typedef enum {
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
 #define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_DEFAULT, \
-                                                      { pid } }
+                                                      { pid } \
+                                                      _GNRC_NETREG_ENTRY_INIT_NETTYPE }
 #else
-#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid } }
+#define GNRC_NETREG_ENTRY_INIT_PID(demux_ctx, pid)  { NULL, demux_ctx, { pid } \
+                                                      _GNRC_NETREG_ENTRY_INIT_NETTYPE }
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(DOXYGEN)
@@ -115,7 +151,8 @@ typedef enum {
  */
 #define GNRC_NETREG_ENTRY_INIT_MBOX(demux_ctx, _mbox) { NULL, demux_ctx, \
                                                        GNRC_NETREG_TYPE_MBOX, \
-                                                       { .mbox = _mbox } }
+                                                       { .mbox = _mbox } \
+                                                       _GNRC_NETREG_ENTRY_INIT_NETTYPE }
 #endif
 
 #if defined(MODULE_GNRC_NETAPI_CALLBACKS) || defined(DOXYGEN)
@@ -132,7 +169,8 @@ typedef enum {
  */
 #define GNRC_NETREG_ENTRY_INIT_CB(demux_ctx, _cbd)   { NULL, demux_ctx, \
                                                       GNRC_NETREG_TYPE_CB, \
-                                                      { .cbd = _cbd } }
+                                                      { .cbd = _cbd } \
+                                                      _GNRC_NETREG_ENTRY_INIT_NETTYPE }
 /** @} */
 
 /**
@@ -210,6 +248,17 @@ typedef struct gnrc_netreg_entry {
         gnrc_netreg_entry_cbd_t *cbd;
 #endif
     } target;                   /**< Target for the registry entry */
+#if defined(MODULE_GNRC_NETREG_HASH) || defined(DOXYGEN)
+    /**
+     * @brief   Protocol type the entry is registered for
+     *
+     * @internal
+     *
+     * @note    Only available with module `gnrc_netreg_hash`, as entries of
+     *          different types share the buckets of the hash table.
+     */
+    gnrc_nettype_t nettype;
+#endif
 } gnrc_netreg_entry_t;
 
 /**
@@ -63,6 +63,65 @@ extern "C" {
 #ifndef CONFIG_GNRC_PKTBUF_SIZE
 #define CONFIG_GNRC_PKTBUF_SIZE    (6144)
 #endif
+
+/**
+ * @brief   Number of packet snip descriptor blocks of `gnrc_pktbuf_slab`
+ *
+ * `gnrc_pktbuf_slab` serves packet snip descriptors and data from fixed-size
+ * blocks of four size classes. An allocation is served from the smallest
+ * class that fits and still has a free block. The class for packet snip
+ * descriptors has blocks of `sizeof(gnrc_pktsnip_t)` (rounded up to 8).
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF      (32)
+#endif
+
+/**
+ * @brief   Block size of the small class of `gnrc_pktbuf_slab`
+ *
+ * Must be a multiple of 8, as must all other block sizes.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE      (64)
+#endif
+
+/**
+ * @brief   Number of blocks of the small class of `gnrc_pktbuf_slab`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF     (24)
+#endif
+
+/**
+ * @brief   Block size of the medium class of `gnrc_pktbuf_slab`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE     (256)
+#endif
+
+/**
+ * @brief   Number of blocks of the medium class of `gnrc_pktbuf_slab`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF    (4)
+#endif
+
+/**
+ * @brief   Block size of the large class of `gnrc_pktbuf_slab`
+ *
+ * This is the maximum size of a single allocation. The default fits a full
+ * Ethernet frame.
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE      (1520)
+#endif
+
+/**
+ * @brief   Number of blocks of the large class of `gnrc_pktbuf_slab`
+ */
+#ifndef CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF
+#define CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF     (2)
+#endif
 /** @} */
 
 /**
@@ -101,6 +101,9 @@ extern "C" {
  * oldest entry that is older than @ref
  * CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US will be overwritten (they will
  * still timeout normally if reassembly buffer is not full).
+ * The same applies to the fragment intervals: when not set, the oldest
+ * datagram is dropped to free its intervals if no interval is left for a
+ * received fragment.
  */
 #ifdef DOXYGEN
 #define CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DO_NOT_OVERRIDE
@@ -20,6 +20,8 @@
 #ifndef NET_GNRC_SIXLOWPAN_FRAG_STATS_H
 #define NET_GNRC_SIXLOWPAN_FRAG_STATS_H
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -36,6 +38,10 @@ typedef struct {
                              *   no @ref gnrc_sixlowpan_frag_fb_t available */
     unsigned datagrams;     /**< reassembled datagrams */
     unsigned fragments;     /**< total fragments of reassembled fragments */
+    uint64_t latency_sum;   /**< sum of the reassembly latencies of all
+                             *   reassembled datagrams in microseconds, i.e.
+                             *   from first fragment to complete datagram */
+    uint32_t latency_max;   /**< maximum reassembly latency in microseconds */
 #if defined(MODULE_GNRC_SIXLOWPAN_FRAG_VRB) || DOXYGEN
     unsigned vrb_full;      /**< counts the number of events where the virtual
                              *   reassembly buffer is full */
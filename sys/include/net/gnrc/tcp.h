@@ -213,23 +213,28 @@ int gnrc_tcp_accept(gnrc_tcp_tcb_queue_t *queue, gnrc_tcp_tcb_t **tcb,
  * @pre @p tcb must not be NULL.
  * @pre @p data must not be NULL.
  *
- * @note Blocks until up to @p len bytes were transmitted or an error occurred.
+ * @note Blocks until all @p len bytes were transmitted and acknowledged, a timeout
+ *       expired or an error occurred.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
  * @param[in]     len                        Number of bytes that should be transmitted.
- * @param[in]     user_timeout_duration_ms   If not zero and there was not data transmitted
- *                                           the function returns after user_timeout_duration_ms.
+ * @param[in]     user_timeout_duration_ms   If not zero the function returns after
+ *                                           user_timeout_duration_ms.
  *                                           If zero, no timeout will be triggered.
  *                                           If GNRC_TCP_NO_TIMEOUT the timeout is disabled
- *                                           causing the function to block until some data was
+ *                                           causing the function to block until all data was
  *                                           transmitted or and error occurred.
  *
- * @return   The number of successfully transmitted bytes.
+ * @return   The number of successfully transmitted bytes. This is less than @p len if
+ *           @p user_timeout_duration_ms expired after some of the data was queued for
+ *           transmission (the queued data is still delivered), or if the connection
+ *           timed out after the peer acknowledged some of the data (only the
+ *           acknowledged bytes are counted).
  * @return   -ENOTCONN if connection is not established.
  * @return   -ECONNRESET if connection was reset by the peer.
- * @return   -ECONNABORTED if the connection was aborted.
- * @return   -ETIMEDOUT if @p user_timeout_duration_ms expired.
+ * @return   -ECONNABORTED if the connection was aborted before any data was acknowledged.
+ * @return   -ETIMEDOUT if @p user_timeout_duration_ms expired before any data was queued.
  */
 ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                       const uint32_t user_timeout_duration_ms);
@@ -108,6 +108,42 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (CONFIG_GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Number of segments that can be sent without waiting for their
+ *        acknowledgment.
+ *
+ * Every unacknowledged segment is held in the packet buffer until it is
+ * acknowledged, so @ref CONFIG_GNRC_PKTBUF_SIZE should be increased
+ * accordingly. With 1, GNRC TCP waits for each segment to be acknowledged
+ * before sending the next one.
+ *
+ * @note The number of segments in flight is further limited by the window of
+ *       the peer and, with module `gnrc_tcp_congure`, by the congestion window.
+ */
+#ifndef CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE (1U)
+#endif
+
+/**
+ * @brief Number of duplicate acknowledgments that trigger a fast retransmit
+ *        (see RFC 5681)
+ */
+#ifndef CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD
+#define CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD (3U)
+#endif
+
+/**
+ * @brief Number of out-of-order segments held per connection until the
+ *        missing data arrives.
+ *
+ * Only segments that fall completely into the receive window are held. Each
+ * held segment stays in the packet buffer, so the default of 0 drops
+ * out-of-order segments as before and relies on the peer to retransmit them.
+ */
+#ifndef CONFIG_GNRC_TCP_RCV_OOO_QUEUE_SIZE
+#define CONFIG_GNRC_TCP_RCV_OOO_QUEUE_SIZE (0U)
+#endif
+
 /**
  * @brief Lower bound for RTO in milliseconds. Default is 1 sec (see RFC 6298)
  *
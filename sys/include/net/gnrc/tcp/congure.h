@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup net_gnrc_tcp_congure Congestion control for GNRC TCP
+ * @ingroup net_gnrc_tcp
+ *
+ * @brief Congestion control for GNRC TCP using the @ref sys_congure
+ *
+ * When included, the number of bytes GNRC TCP has in flight is limited by the
+ * congestion window of a @ref sys_congure state object in addition to the
+ * window of the peer and @ref CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE. The
+ * flavor of congestion control can be selected using the following
+ * sub-modules:
+ *
+ * - `gnrc_tcp_congure_reno`: @ref sys_congure_reno (the default)
+ * - `gnrc_tcp_congure_quic`: @ref sys_congure_quic
+ *
+ * The window unit is one byte.
+ * @{
+ *
+ * @file
+ * @brief   CongURE definitions for @ref net_gnrc_tcp
+ */
+#ifndef NET_GNRC_TCP_CONGURE_H
+#define NET_GNRC_TCP_CONGURE_H
+
+#include <congure.h> /* sys/include/congure.h, not this file */
+#include "modules.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_USED(MODULE_GNRC_TCP_CONGURE) || DOXYGEN
+/**
+ * @brief   Retrieve CongURE state object from a pool of free objects
+ *
+ * Needs to be defined for each CongURE implementation `congure_x` as a
+ * sub-module `gnrc_tcp_congure_x`, calling the respective
+ * `congure_x_snd_setup` function when a free object is available. As such,
+ * congure_snd_t::driver == NULL can be used as an identifier if a state object
+ * is free.
+ *
+ * The pool of objects has to have an initial size of at least
+ * @ref CONFIG_GNRC_TCP_RCV_BUFFERS, the maximum number of connections.
+ *
+ * @return  A CongURE state object on success
+ * @return  NULL, if no free CongURE state object is available (including when
+ *          when module `gnrc_tcp_congure` is not included).
+ */
+congure_snd_t *gnrc_tcp_congure_snd_get(void);
+#else
+static inline congure_snd_t *gnrc_tcp_congure_snd_get(void)
+{
+    return NULL;
+}
+#endif
+
+/**
+ * @brief   Frees the CongURE state object
+ *
+ * This makes a CongURE state object retrievable with
+ * @ref gnrc_tcp_congure_snd_get again.
+ *
+ * @param[in] c     A CongURE state object
+ */
+static inline void gnrc_tcp_congure_snd_free(congure_snd_t *c)
+{
+    c->driver = NULL;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_TCP_CONGURE_H */
+/** @} */
@@ -34,10 +34,24 @@
 #include "net/gnrc/ipv6.h"
 #endif
 
+#ifdef MODULE_GNRC_TCP_CONGURE
+#include <congure.h> /* not net/gnrc/tcp/congure.h */
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Segment in the retransmission queue of GNRC TCP.
+ */
+typedef struct {
+    gnrc_pktsnip_t *pkt;   /**< The segment */
+    uint32_t seq_end;      /**< Sequence number following the segment */
+    uint32_t sent;         /**< Timestamp of the last transmission */
+    uint8_t retries;       /**< Number of retransmissions of the segment */
+} gnrc_tcp_rexmit_t;
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -62,15 +76,30 @@ typedef struct sock_tcp {
     uint32_t iss;          /**< Initial sequence sumber */
     uint32_t irs;          /**< Initial received sequence number */
     uint16_t mss;          /**< The peers MSS */
-    uint32_t rtt_start;    /**< Timer value for rtt estimation */
+    uint32_t snd_recover;  /**< snd_nxt when the last loss was detected */
     int32_t rtt_var;       /**< Round trip time variance */
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
     uint8_t retries;       /**< Number of retransmissions */
+    uint8_t dup_acks;      /**< Number of duplicate acknowledgments */
     evtimer_msg_event_t event_retransmit; /**< Retransmission event */
     evtimer_msg_event_t event_timeout;    /**< Timeout event */
     evtimer_mbox_event_t event_misc;      /**< General purpose event */
-    gnrc_pktsnip_t *pkt_retransmit;       /**< Pointer to packet in "retransmit queue" */
+    /**
+     * @brief Unacknowledged segments, oldest first
+     */
+    gnrc_tcp_rexmit_t rexmit[CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE];
+    uint8_t rexmit_len;      /**< Number of segments in rexmit */
+#if (CONFIG_GNRC_TCP_RCV_OOO_QUEUE_SIZE > 0) || defined(DOXYGEN)
+    uint8_t rcv_ooo_len;     /**< Number of segments in rcv_ooo */
+    /**
+     * @brief Received out-of-order segments, sorted by sequence number
+     */
+    gnrc_pktsnip_t *rcv_ooo[CONFIG_GNRC_TCP_RCV_OOO_QUEUE_SIZE];
+#endif
+#if defined(MODULE_GNRC_TCP_CONGURE) || defined(DOXYGEN)
+    congure_snd_t *congure;  /**< Congestion control state, see @ref net_gnrc_tcp_congure */
+#endif
     mbox_t *mbox;            /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
@@ -11,6 +11,17 @@
  * @ingroup     net_gnrc
  * @brief       GNRC's implementation of the UDP protocol
  *
+ * With the module `gnrc_udp_fastpath` received datagrams are delivered to
+ * their sockets in the thread of the network interface (or of 6LoWPAN),
+ * without passing through the IPv6 and UDP threads. This saves two context
+ * switches and message queue slots per datagram. Datagrams with extension
+ * headers or without registered receivers, packets to forward and packets
+ * another thread subscribed to still take the threaded path. Note that
+ * asynchronous socket callbacks are then called from the interface thread,
+ * whose stack is increased by @ref GNRC_UDP_FASTPATH_EXTRA_STACKSIZE, and must
+ * not call gnrc_netapi_get() or gnrc_netapi_set() on that interface (see
+ * @ref net_gnrc_udp_fastpath).
+ *
  * @{
  *
  * @file
@@ -99,6 +110,19 @@ int gnrc_udp_calc_csum(gnrc_pktsnip_t *hdr, gnrc_pktsnip_t *pseudo_hdr);
 gnrc_pktsnip_t *gnrc_udp_hdr_build(gnrc_pktsnip_t *payload, uint16_t src,
                                    uint16_t dst);
 
+/**
+ * @brief   Handles a received UDP datagram in the calling thread
+ *
+ * Checks the datagram the same way the UDP thread does and dispatches it to
+ * the registered receivers of its destination port.
+ *
+ * @note    Only available with module `gnrc_udp_fastpath`.
+ *
+ * @param[in] pkt   A received datagram in receive order with its IPv6
+ *                  header already marked.
+ */
+void gnrc_udp_fastpath_recv(gnrc_pktsnip_t *pkt);
+
 /**
  * @brief   Initialize and start UDP
  *
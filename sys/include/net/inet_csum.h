@@ -73,6 +73,53 @@ static inline uint16_t inet_csum(uint16_t sum, const uint8_t *buf, uint16_t len)
     return inet_csum_slice(sum, buf, len, 0);
 }
 
+/**
+ * @brief   Updates a checksum after a 16-bit word of its domain changed
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc1624">
+ *          RFC 1624
+ *      </a>
+ *
+ * @details Unlike the other functions of this module, this works on the
+ *          normalized checksum as it is stored in a header, so a header
+ *          field can be rewritten without summing the whole domain again.
+ *
+ * @param[in] csum      The checksum field, in host byte order.
+ * @param[in] from      Old value of the changed word, in host byte order.
+ * @param[in] to        New value of the changed word, in host byte order.
+ *
+ * @return  The updated checksum field, in host byte order.
+ */
+static inline uint16_t inet_csum_update(uint16_t csum, uint16_t from, uint16_t to)
+{
+    /* RFC 1624, eqn. 3: HC' = ~(~HC + ~m + m') */
+    uint32_t sum = (uint16_t)~csum + (uint16_t)~from + to;
+
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+    return ~sum;
+}
+
+/**
+ * @brief   Updates a checksum after a region of its domain changed
+ *
+ * @see <a href="https://tools.ietf.org/html/rfc1624">
+ *          RFC 1624
+ *      </a>
+ *
+ * @details Same as @ref inet_csum_update(), e.g. for rewriting an address.
+ *          The region must start at an even offset of the checksum domain.
+ *
+ * @param[in] csum      The checksum field, in host byte order.
+ * @param[in] from      Old content of the region.
+ * @param[in] to        New content of the region.
+ * @param[in] len       Length of the region in byte.
+ *
+ * @return  The updated checksum field, in host byte order.
+ */
+uint16_t inet_csum_update_buf(uint16_t csum, const uint8_t *from,
+                              const uint8_t *to, uint16_t len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -11,6 +11,17 @@
  * @ingroup     net_nanocoap
  * @brief       A cache implementation for nanocoap response messages
  *
+ * Entries are found via a hash table over the cache key, the least recently
+ * used entry is replaced in constant time when the cache is full. Responses
+ * are stored back to back in a buffer of @ref CONFIG_NANOCOAP_CACHE_SIZE bytes,
+ * so the capacity of the cache is a byte budget and small responses do not
+ * occupy @ref CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE bytes each.
+ *
+ * Entries that have been stale for @ref CONFIG_NANOCOAP_CACHE_STALE_TIMEOUT
+ * seconds are evicted by a timing wheel, which is advanced with
+ * @ref ZTIMER_SEC on every access to the cache. Stale entries are kept for
+ * that long so they can still be revalidated using their ETag.
+ *
  * @{
  *
  * @file
@@ -36,6 +47,8 @@ extern "C" {
 
 /**
  * @brief The number of maximum cache entries.
+ *
+ * The number of entries is further limited by @ref CONFIG_NANOCOAP_CACHE_SIZE.
  */
 #ifndef CONFIG_NANOCOAP_CACHE_ENTRIES
 #define CONFIG_NANOCOAP_CACHE_ENTRIES          (8)
@@ -49,21 +62,61 @@ extern "C" {
 #endif
 
 /**
- * @brief Size of the buffer to store responses in the cache.
+ * @brief Maximum size of a response stored in the cache.
  */
 #ifndef CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE
 #define CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE    (128)
 #endif
 
+/**
+ * @brief Number of bytes available to store responses in the cache.
+ */
+#ifndef CONFIG_NANOCOAP_CACHE_SIZE
+#define CONFIG_NANOCOAP_CACHE_SIZE  (CONFIG_NANOCOAP_CACHE_ENTRIES * \
+                                     CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE)
+#endif
+
+/**
+ * @brief Number of buckets of the hash table over the cache keys.
+ */
+#ifndef CONFIG_NANOCOAP_CACHE_BUCKETS
+#define CONFIG_NANOCOAP_CACHE_BUCKETS          (CONFIG_NANOCOAP_CACHE_ENTRIES)
+#endif
+
+/**
+ * @brief Number of one second slots of the timing wheel that evicts
+ *        stale entries.
+ *
+ * Entries that expire further in the future than the number of slots are
+ * checked once per rotation.
+ */
+#ifndef CONFIG_NANOCOAP_CACHE_WHEEL_SIZE
+#define CONFIG_NANOCOAP_CACHE_WHEEL_SIZE       (16)
+#endif
+
+/**
+ * @brief Time in seconds a stale entry is kept for revalidation before it
+ *        is evicted.
+ */
+#ifndef CONFIG_NANOCOAP_CACHE_STALE_TIMEOUT
+#define CONFIG_NANOCOAP_CACHE_STALE_TIMEOUT    (60)
+#endif
+
 /**
  * @brief   Cache container that holds a @p coap_pkt_t struct.
  */
-typedef struct {
+typedef struct nanocoap_cache_entry {
     /**
      * @brief needed for clist_t, must be the first struct member!
      */
     clist_node_t node;
 
+    struct nanocoap_cache_entry *bucket_next;   /**< next entry in hash bucket */
+    struct nanocoap_cache_entry *lru_prev;      /**< next less recently used entry */
+    struct nanocoap_cache_entry *lru_next;      /**< next more recently used entry */
+    struct nanocoap_cache_entry *wheel_next;    /**< next entry in wheel slot */
+    uint32_t evict_at;                          /**< time of the wheel slot */
+
     /**
      * @brief the calculated cache key, see nanocoap_cache_key_generate().
      */
@@ -77,7 +130,7 @@ typedef struct {
     /**
      * @brief buffer to hold the response message.
      */
-    uint8_t response_buf[CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE];
+    uint8_t *response_buf;
 
     size_t response_len; /**< length of the message in @p response */
 
@@ -93,6 +146,16 @@ typedef struct {
     uint32_t max_age;
 } nanocoap_cache_entry_t;
 
+/**
+ * @brief   Cache statistics
+ */
+typedef struct {
+    uint32_t hits;          /**< lookups that found an entry */
+    uint32_t misses;        /**< lookups that found no entry */
+    uint32_t evictions;     /**< entries replaced to make room */
+    uint32_t expirations;   /**< entries evicted after being stale */
+} nanocoap_cache_stats_t;
+
 /**
  * @brief Typedef for the cache replacement strategy on full cache list.
  *
@@ -137,6 +200,22 @@ size_t nanocoap_cache_used_count(void);
  */
 size_t nanocoap_cache_free_count(void);
 
+/**
+ * @brief   Returns the number of bytes used by cached responses.
+ *
+ * @return  Number of bytes used, at most @ref CONFIG_NANOCOAP_CACHE_SIZE
+ */
+size_t nanocoap_cache_bytes_used(void);
+
+/**
+ * @brief   Gets the cache statistics.
+ *
+ * The statistics are reset by @ref nanocoap_cache_init.
+ *
+ * @param[out] stats    The statistics
+ */
+void nanocoap_cache_get_stats(nanocoap_cache_stats_t *stats);
+
 /**
  * @brief   Determines if a response is cacheable and modifies the cache
  *          as reflected in RFC7252, Section 5.9.
@@ -195,6 +274,9 @@ nanocoap_cache_entry_t *nanocoap_cache_request_lookup(const coap_pkt_t *req);
 /**
  * @brief   Performs a cache lookup based on the cache key of a request.
  *
+ * Counts as hit or miss in the statistics and makes the entry the most
+ * recently used one.
+ *
  * @param[in] cache_key       The cache key of a request
  *
  * @return  An existing cache entry on cache hit
@@ -107,6 +107,7 @@ typedef struct {
     int target_slot;                        /**< update targets this slot     */
     size_t offset;                          /**< update is at this position   */
     unsigned flashpage;                     /**< update is at this flashpage  */
+    unsigned erased;                        /**< first page not yet erased    */
 
     /**
      * @brief flash writing buffer
@@ -185,6 +186,26 @@ static inline int riotboot_flashwrite_init(riotboot_flashwrite_t *state,
  */
 int riotboot_flashwrite_putbytes(riotboot_flashwrite_t *state,
                                  const uint8_t *bytes, size_t len, bool more);
+
+/**
+ * @brief   Erase the flash pages the next @p len bytes will be written to
+ *
+ * With @ref CONFIG_RIOTBOOT_FLASHWRITE_RAW, pages are otherwise erased by
+ * @ref riotboot_flashwrite_putbytes() when the write position enters them.
+ * Erasing them ahead of time allows to do it while waiting for the next chunk
+ * of the image, e.g. while it is being downloaded. Pages already erased are
+ * skipped, so this is cheap to call after every chunk.
+ *
+ * Without @ref CONFIG_RIOTBOOT_FLASHWRITE_RAW this is a no-op, as every page is
+ * erased when it is written.
+ *
+ * @param[in,out]   state   ptr to previously used update state
+ * @param[in]       len     number of bytes after the current position
+ *
+ * @returns         0 on success, <0 otherwise
+ */
+int riotboot_flashwrite_erase_ahead(riotboot_flashwrite_t *state, size_t len);
+
 /**
  * @brief   Force flush the buffer onto the flash
  *
@@ -62,6 +62,16 @@ extern "C" {
 #define CONFIG_SUIT_COMPONENT_MAX_NAME_LEN          (32U)
 #endif
 
+/**
+ * @brief Number of bytes ahead of the write position the storage is prepared
+ *        for while a payload is fetched
+ *
+ * @see suit_storage_driver_t::prepare
+ */
+#ifndef CONFIG_SUIT_STORAGE_PREPARE_AHEAD
+#define CONFIG_SUIT_STORAGE_PREPARE_AHEAD           (1024U)
+#endif
+
 /**
  * @brief Current SUIT serialization format version
  *
@@ -249,6 +259,16 @@ typedef struct {
     uint32_t seq_number;            /**< Set sequence number */
 } suit_manifest_t;
 
+/**
+ * @brief Progress of the payload fetch in progress, or the last one
+ */
+typedef struct {
+    size_t total;           /**< payload size announced by the manifest */
+    size_t received;        /**< bytes received so far */
+    uint32_t elapsed_ms;    /**< time since the fetch was started */
+    uint32_t stall_ms;      /**< time the transport waited for the storage */
+} suit_fetch_stats_t;
+
 /**
  * @brief Component index representing all components
  *
@@ -314,6 +334,19 @@ static inline bool suit_component_check_flag(suit_component_t *component,
     return (component->state & flag);
 }
 
+/**
+ * @brief Get the progress of the current (or last) payload fetch
+ *
+ * The throughput of the download is `received / elapsed_ms`. A high
+ * @ref suit_fetch_stats_t::stall_ms means writing the payload to storage,
+ * rather than the transport, limits the throughput.
+ *
+ * @note The times are only measured with module `ztimer_msec`
+ *
+ * @param[out]  stats   The statistics
+ */
+void suit_fetch_get_stats(suit_fetch_stats_t *stats);
+
 /**
  * @brief Convert a component name to a string
  *
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+/**
+ * @defgroup    sys_suit_pipeline SUIT pipelined payload storage
+ * @ingroup     sys_suit
+ * @brief       Stores fetched payload chunks in a separate thread
+ *
+ * Without this module, every chunk of a payload is digested and written to
+ * the storage by the transport callback, so the transport only requests the
+ * next chunk after the previous one was programmed to flash.
+ *
+ * With module `suit_pipeline`, the transport callback only copies the chunk
+ * into one of @ref CONFIG_SUIT_PIPELINE_BUF_NUMOF buffers and returns, so the
+ * request for the next chunk is sent right away. A writer thread of lower
+ * priority than the transport digests and stores the buffered chunks while the
+ * transport waits for the network, and prepares the storage (e.g. erases flash
+ * pages) for the chunks to come. The transport only blocks when all buffers are
+ * in use, see @ref suit_fetch_stats_t::stall_ms.
+ *
+ * @{
+ *
+ * @brief       SUIT pipelined payload storage
+ */
+
+#ifndef SUIT_PIPELINE_H
+#define SUIT_PIPELINE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "net/nanocoap.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of chunk buffers
+ */
+#ifndef CONFIG_SUIT_PIPELINE_BUF_NUMOF
+#define CONFIG_SUIT_PIPELINE_BUF_NUMOF  (2U)
+#endif
+
+/**
+ * @brief   Size of a chunk buffer in bytes
+ *
+ * Larger chunks are split over several buffers, so this should be at least
+ * the block size of the transport.
+ */
+#ifndef CONFIG_SUIT_PIPELINE_BUF_SIZE
+#define CONFIG_SUIT_PIPELINE_BUF_SIZE   (256U)
+#endif
+
+/**
+ * @brief   Stack size of the writer thread
+ */
+#ifndef SUIT_PIPELINE_STACKSIZE
+#define SUIT_PIPELINE_STACKSIZE         (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Priority of the writer thread
+ *
+ * Must be lower than the priority of the thread fetching the payload, so the
+ * transport is never delayed by the storage unless all buffers are in use.
+ */
+#ifndef SUIT_PIPELINE_PRIO
+#define SUIT_PIPELINE_PRIO              (THREAD_PRIORITY_MAIN)
+#endif
+
+/**
+ * @brief   Start a pipelined payload write
+ *
+ * @param[in]   cb      Called by the writer thread for every chunk
+ * @param[in]   arg     Argument for @p cb
+ */
+void suit_pipeline_start(coap_blockwise_cb_t cb, void *arg);
+
+/**
+ * @brief   Queue a chunk of the payload
+ *
+ * Copies the chunk and returns, unless all buffers are in use.
+ *
+ * @param[in]   offset  Offset of the chunk in the payload
+ * @param[in]   buf     The chunk
+ * @param[in]   len     Length of the chunk
+ * @param[in]   more    0 for the last chunk
+ *
+ * @returns     0 on success
+ * @returns     negative error returned by the callback for an earlier chunk
+ */
+int suit_pipeline_put(size_t offset, const uint8_t *buf, size_t len, int more);
+
+/**
+ * @brief   Wait until all queued chunks are written
+ *
+ * Must be called after the last chunk, or when the transport failed.
+ *
+ * @returns     0 if all chunks were written
+ * @returns     first negative error returned by the callback
+ */
+int suit_pipeline_finish(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SUIT_PIPELINE_H */
+/** @} */
@@ -81,10 +81,13 @@
  * 5.  @ref suit_storage_driver_t::start to start a payload write sequence.
  * 6.  At least one @ref suit_storage_driver_t::write calls to write the payload
  *     data.
+ *     Between writes, the optional @ref suit_storage_driver_t::prepare may be
+ *     called to prepare the storage for the following chunks.
  * 7.  @ref suit_storage_driver_t::finish to mark the end of the payload write.
  * 8.  @ref suit_storage_driver_t::read or @ref suit_storage_driver_t::read_ptr
  *     to read back the written payload. This to verify the digest of the
- *     payload with what is provided in the manifest.
+ *     payload with what is provided in the manifest. This step is skipped if
+ *     the payload was digested while it was written.
  * 9.  @ref suit_storage_driver_t::install if the digest matches with what is
  *     expected and the payload can be installed or marked as valid, or:
  * 10. @ref suit_storage_driver_t::erase if the digest does not match with what
@@ -160,6 +163,21 @@ typedef struct suit_storage_driver {
      */
     int (*finish)(suit_storage_t *storage, const suit_manifest_t *manifest);
 
+    /**
+     * @brief Prepare the storage for the next chunks of the payload, e.g. by
+     *        erasing flash pages ahead of the write position
+     *
+     * @note Optional to implement
+     *
+     * @param[in]   storage     Storage context
+     * @param[in]   len         Number of bytes after the last write to
+     *                          prepare
+     *
+     * @returns     @ref SUIT_OK on success
+     * @returns     @ref suit_error_t on error
+     */
+    int (*prepare)(suit_storage_t *storage, size_t len);
+
     /**
      * @brief Read a chunk of previously written data back.
      *
@@ -452,6 +470,26 @@ static inline int suit_storage_finish(suit_storage_t *storage,
     return storage->driver->finish(storage, manifest);
 }
 
+/**
+ * @brief Prepare the storage for the next chunks of the payload
+ *
+ * Does nothing if the backend doesn't implement @ref
+ * suit_storage_driver_t::prepare.
+ *
+ * @param[in]   storage     Storage context
+ * @param[in]   len         Number of bytes after the last write to prepare
+ *
+ * @returns     @ref SUIT_OK on success
+ * @returns     @ref suit_error_t on error
+ */
+static inline int suit_storage_prepare(suit_storage_t *storage, size_t len)
+{
+    if (storage->driver->prepare) {
+        return storage->driver->prepare(storage, len);
+    }
+    return SUIT_OK;
+}
+
 /**
  * @brief Read a chunk of previously written data back.
  *
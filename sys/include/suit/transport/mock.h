@@ -26,6 +26,7 @@
 #ifndef SUIT_TRANSPORT_MOCK_H
 #define SUIT_TRANSPORT_MOCK_H
 
+#include "net/nanocoap.h"
 #include "suit.h"
 
 #ifdef __cplusplus
@@ -40,18 +41,29 @@ typedef struct {
     size_t len;         /**< Length of the payload in bytes */
 } suit_transport_mock_payload_t;
 
+/**
+ * @brief Size of the chunks the payload is passed to the callback in
+ */
+#ifndef SUIT_TRANSPORT_MOCK_CHUNK_SIZE
+#define SUIT_TRANSPORT_MOCK_CHUNK_SIZE  (64U)
+#endif
+
 /**
  * @brief 'fetch' a payload
  *
  * The payload fetched from the payloads array is indicated by the @ref
- * suit_manifest_t::component_current member
+ * suit_manifest_t::component_current member. It is passed to @p cb in chunks
+ * of @ref SUIT_TRANSPORT_MOCK_CHUNK_SIZE, like a blockwise CoAP transfer.
  *
  * @param[in]   manifest    suit manifest context
+ * @param[in]   cb          block callback
+ * @param[in]   ctx         callback context
  *
  * @returns     SUIT_OK if valid
  * @returns     negative otherwise
  */
-int suit_transport_mock_fetch(const suit_manifest_t *manifest);
+int suit_transport_mock_fetch(const suit_manifest_t *manifest,
+                              coap_blockwise_cb_t cb, void *ctx);
 
 #ifdef __cplusplus
 }
@@ -192,6 +192,67 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c);
  */
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n);
 
+/**
+ * @name    Zero-copy access
+ *
+ * These functions give direct access to the largest contiguous readable or
+ * writable region of the ringbuffer. Data is copied from or to that region
+ * by the caller, interrupts are only disabled to read and update the indices.
+ *
+ * Unlike the functions above they are only safe to use with a single reader
+ * and a single writer (e.g. one ISR adding data and one thread consuming it),
+ * as the region handed out is not reserved until it is committed.
+ *
+ * @{
+ */
+/**
+ * @brief       Get the largest contiguous region of readable data
+ *
+ * As the readable data may wrap around the end of the buffer, a second call
+ * after @ref tsrb_read_commit() may return the remainder.
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[out]  src start of the readable region
+ * @return      nr of bytes readable from @p src
+ */
+size_t tsrb_read_span(tsrb_t *rb, const uint8_t **src);
+
+/**
+ * @brief       Remove bytes obtained by @ref tsrb_read_span()
+ *
+ * @pre         @p n is not larger than the size of the last region returned
+ *              by @ref tsrb_read_span()
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes consumed
+ */
+void tsrb_read_commit(tsrb_t *rb, size_t n);
+
+/**
+ * @brief       Get the largest contiguous region of free space
+ *
+ * As the free space may wrap around the end of the buffer, a second call
+ * after @ref tsrb_write_commit() may return the remainder.
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[out]  dst start of the writable region
+ * @return      nr of bytes writable to @p dst
+ */
+size_t tsrb_write_span(tsrb_t *rb, uint8_t **dst);
+
+/**
+ * @brief       Add bytes written to the region obtained by
+ *              @ref tsrb_write_span()
+ *
+ * @pre         @p n is not larger than the size of the last region returned
+ *              by @ref tsrb_write_span()
+ *
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes written
+ */
+void tsrb_write_commit(tsrb_t *rb, size_t n);
+/** @} */
+
 #ifdef __cplusplus
 }
 #endif
@@ -62,6 +62,7 @@ extern "C" {
 #define SCSI_SEEK                       0x2B    /**< SCSI Seek */
 #define SCSI_WRITE_AND_VERIFY           0x2E    /**< SCSI Write and Verify */
 #define SCSI_VERIFY10                   0x2F    /**< SCSI Verify10 */
+#define SCSI_SYNCHRONIZE_CACHE10        0x35    /**< SCSI Synchronize Cache10 */
 #define SCSI_MODE_SELECT10              0x55    /**< SCSI Mode Select10 */
 #define SCSI_MODE_SENSE10               0x5A    /**< SCSI Mode Sense10 */
 /** @} */
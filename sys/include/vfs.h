@@ -197,6 +197,23 @@ extern "C" {
 #define VFS_MAX_OPEN_FILES (16)
 #endif
 
+/**
+ * @brief Number of entries of the stat cache
+ *
+ * Only used with module `vfs_stat_cache`, see @ref vfs_stat.
+ */
+#ifndef CONFIG_VFS_STAT_CACHE_SIZE
+#define CONFIG_VFS_STAT_CACHE_SIZE      (8)
+#endif
+
+/**
+ * @brief Maximum length of a path (without terminating null byte) the stat
+ *        cache holds results for
+ */
+#ifndef CONFIG_VFS_STAT_CACHE_PATH_MAX
+#define CONFIG_VFS_STAT_CACHE_PATH_MAX  (31)
+#endif
+
 #ifndef VFS_DIR_BUFFER_SIZE
 /**
  * @brief Size of buffer space in vfs_DIR
@@ -359,6 +376,12 @@ struct vfs_mount_struct {
     size_t mount_point_len;      /**< Length of mount_point string (set by vfs_mount) */
     atomic_int open_files;       /**< Number of currently open files and directories */
     void *private_data;          /**< File system driver private data, implementation defined */
+    vfs_mount_t *index_next;     /**< Next mount with a mount point that is not
+                                      longer (set by vfs_mount) */
+#if IS_USED(MODULE_VFS_STAT_CACHE) || defined(DOXYGEN)
+    unsigned stat_cache_gen;     /**< Incremented whenever the cached results of
+                                      vfs_stat() for this mount are dropped */
+#endif
 };
 
 /**
@@ -1040,6 +1063,12 @@ int vfs_rmdir(const char *name);
 /**
  * @brief Get file status
  *
+ * With module `vfs_stat_cache`, the results for the last
+ * @ref CONFIG_VFS_STAT_CACHE_SIZE paths (including "does not exist") are
+ * cached. The cached results of a mount are dropped whenever a file on it is
+ * written, created, renamed or removed through the VFS, so the cache must not
+ * be used with file systems that are modified by other means.
+ *
  * @param[in]  path    path to file being queried
  * @param[out] buf     pointer to stat struct to fill
  *
@@ -157,6 +157,22 @@
  * to be shown whether the increased complexity would lead to better
  * performance for any reasonable amount of active timers.
  *
+ * For clocks that are expected to hold hundreds or thousands of active timers,
+ * the module `ztimer_heap` provides a pairing heap as an alternative timer
+ * queue. It is selected per clock by calling @ref ztimer_clock_use_heap()
+ * before the first timer is set on that clock (for ZTIMER_USEC, ZTIMER_MSEC
+ * and ZTIMER_SEC this can be done with @ref CONFIG_ZTIMER_USEC_HEAP,
+ * @ref CONFIG_ZTIMER_MSEC_HEAP and @ref CONFIG_ZTIMER_SEC_HEAP). With the
+ * heap, each timer stores its absolute target time and two additional
+ * pointers, leading to:
+ *
+ * - three pointers and two uint32_t per timer object
+ * - constant get_min() and insertion
+ * - O(log n) amortized removal of timer objects (including the removal of
+ *   expired timers)
+ * - timers with the exact same target time are triggered in unspecified
+ *   order (the linked list triggers them in the order they were set)
+ *
  *
  * ## Clock extension
  *
@@ -299,6 +315,14 @@ typedef void (*ztimer_callback_t)(void *arg);
 struct ztimer_base {
     ztimer_base_t *next;        /**< next timer in list */
     uint32_t offset;            /**< offset from last timer in list */
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    ztimer_base_t *child;       /**< first child (pairing heap only) */
+    ztimer_base_t *prev;        /**< parent or left sibling (pairing heap
+                                     only) */
+    uint32_t epoch;             /**< upper 32bit of the absolute target, the
+                                     lower ones are kept in @p offset
+                                     (pairing heap only) */
+#endif
 };
 
 /**
@@ -403,6 +427,11 @@ struct ztimer_clock {
     uint8_t block_pm_mode;          /**< min. pm mode to block for the clock to run
                                          don't use in combination with ztimer_ondemand! */
 #endif
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+    bool heap;                      /**< timers are kept in a pairing heap  */
+    uint32_t epoch;                 /**< upper 32bit of the heap's time base,
+                                         the lower ones are list.offset     */
+#endif
 };
 
 /**
@@ -455,6 +484,22 @@ static inline bool ztimer_release(ztimer_clock_t *clock)
 }
 #endif
 
+/**
+ * @brief   Use a pairing heap as timer queue for a clock
+ *
+ * By default, the timers of a clock are kept in a sorted linked list, which
+ * has O(n) insertion cost. After calling this function, @p clock keeps its
+ * timers in a pairing heap instead, making ztimer_set() a constant time
+ * operation regardless of the number of active timers.
+ *
+ * @pre     No timer is set on @p clock.
+ *
+ * @param[in]   clock       ztimer clock to operate on
+ */
+#if MODULE_ZTIMER_HEAP || DOXYGEN
+void ztimer_clock_use_heap(ztimer_clock_t *clock);
+#endif
+
 /**
  * @brief   Set a timer on a clock
  *
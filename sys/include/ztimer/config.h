@@ -198,6 +198,33 @@ extern "C" {
 #define CONFIG_ZTIMER_AUTO_ADJUST_SETTLE    0
 #endif
 
+/**
+ * @brief   Keep the timers of ZTIMER_USEC in a pairing heap
+ *
+ * Requires the module `ztimer_heap`, see @ref ztimer_clock_use_heap.
+ */
+#ifndef CONFIG_ZTIMER_USEC_HEAP
+#define CONFIG_ZTIMER_USEC_HEAP             0
+#endif
+
+/**
+ * @brief   Keep the timers of ZTIMER_MSEC in a pairing heap
+ *
+ * Requires the module `ztimer_heap`, see @ref ztimer_clock_use_heap.
+ */
+#ifndef CONFIG_ZTIMER_MSEC_HEAP
+#define CONFIG_ZTIMER_MSEC_HEAP             0
+#endif
+
+/**
+ * @brief   Keep the timers of ZTIMER_SEC in a pairing heap
+ *
+ * Requires the module `ztimer_heap`, see @ref ztimer_clock_use_heap.
+ */
+#ifndef CONFIG_ZTIMER_SEC_HEAP
+#define CONFIG_ZTIMER_SEC_HEAP              0
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -26,12 +26,35 @@
 #include "kernel_defines.h"
 #include "mutex.h"
 
+#include "thread_cache.h"
+
 extern void *__real_malloc(size_t size);
 extern void __real_free(void *ptr);
 extern void *__real_realloc(void *ptr, size_t size);
 
 static mutex_t _lock;
 
+static void *_malloc(size_t size)
+{
+    void *ptr = thread_cache_alloc(size);
+
+    if (ptr == NULL) {
+        mutex_lock(&_lock);
+        ptr = __real_malloc(size);
+        mutex_unlock(&_lock);
+    }
+    return ptr;
+}
+
+static void _free(void *ptr)
+{
+    if (!thread_cache_free(ptr)) {
+        mutex_lock(&_lock);
+        __real_free(ptr);
+        mutex_unlock(&_lock);
+    }
+}
+
 void __attribute__((used)) *__wrap_malloc(size_t size)
 {
     uinttxtptr_t pc;
@@ -39,9 +62,7 @@ void __attribute__((used)) *__wrap_malloc(size_t size)
         pc = cpu_get_caller_pc();
     }
     assert(!irq_is_in());
-    mutex_lock(&_lock);
-    void *ptr = __real_malloc(size);
-    mutex_unlock(&_lock);
+    void *ptr = _malloc(size);
     if (IS_USED(MODULE_MALLOC_TRACING)) {
         printf("malloc(%u) @ 0x%" PRIxTXTPTR " returned %p\n",
                (unsigned)size, pc, ptr);
@@ -56,9 +77,7 @@ void __attribute__((used)) __wrap_free(void *ptr)
         printf("free(%p) @0x%" PRIxTXTPTR ")\n", ptr, pc);
     }
     assert(!irq_is_in());
-    mutex_lock(&_lock);
-    __real_free(ptr);
-    mutex_unlock(&_lock);
+    _free(ptr);
 }
 
 void * __attribute__((used)) __wrap_calloc(size_t nmemb, size_t size)
@@ -79,9 +98,7 @@ void * __attribute__((used)) __wrap_calloc(size_t nmemb, size_t size)
         return NULL;
     }
 
-    mutex_lock(&_lock);
-    void *res = __real_malloc(total_size);
-    mutex_unlock(&_lock);
+    void *res = _malloc(total_size);
     if (res) {
         memset(res, 0, total_size);
     }
@@ -102,9 +119,31 @@ void * __attribute__((used))__wrap_realloc(void *ptr, size_t size)
     }
 
     assert(!irq_is_in());
-    mutex_lock(&_lock);
-    void *new = __real_realloc(ptr, size);
-    mutex_unlock(&_lock);
+    void *new;
+    size_t old_size = thread_cache_block_size(ptr);
+    if (ptr == NULL) {
+        new = _malloc(size);
+    }
+    else if (old_size == 0) {
+        mutex_lock(&_lock);
+        new = __real_realloc(ptr, size);
+        mutex_unlock(&_lock);
+    }
+    /* ptr is a block of the thread cache */
+    else if (size == 0) {
+        _free(ptr);
+        new = NULL;
+    }
+    else if (size <= old_size) {
+        new = ptr;
+    }
+    else {
+        new = _malloc(size);
+        if (new) {
+            memcpy(new, ptr, old_size);
+            _free(ptr);
+        }
+    }
 
     if (IS_USED(MODULE_MALLOC_TRACING)) {
         printf("realloc(%p, %u) @0x%" PRIxTXTPTR " returned %p\n",
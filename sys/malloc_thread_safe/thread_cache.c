@@ -0,0 +1,277 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_malloc_thread_cache
+ * @{
+ *
+ * @file
+ * @brief       Thread-cached small-object allocator
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "assert.h"
+#include "malloc_thread_cache.h"
+#include "mutex.h"
+#include "thread.h"
+
+#include "thread_cache.h"
+
+#define SLAB_NUMOF  (CONFIG_MALLOC_THREAD_CACHE_ARENA_SIZE / \
+                     CONFIG_MALLOC_THREAD_CACHE_SLAB_SIZE)
+
+static_assert(CONFIG_MALLOC_THREAD_CACHE_CLASSES > 0,
+              "CONFIG_MALLOC_THREAD_CACHE_CLASSES must not be 0");
+static_assert((CONFIG_MALLOC_THREAD_CACHE_SLAB_SIZE % MALLOC_THREAD_CACHE_MAX_SIZE) == 0,
+              "CONFIG_MALLOC_THREAD_CACHE_SLAB_SIZE must be a multiple of the largest size class");
+static_assert(SLAB_NUMOF <= UINT16_MAX, "too many slabs");
+static_assert(CONFIG_MALLOC_THREAD_CACHE_LIMIT >= CONFIG_MALLOC_THREAD_CACHE_BATCH,
+              "CONFIG_MALLOC_THREAD_CACHE_LIMIT must not be smaller than the batch size");
+
+typedef struct block {
+    struct block *next;
+} _block_t;
+
+typedef struct {
+    _block_t *head;
+    uint16_t len;
+} _list_t;
+
+typedef struct {
+    _list_t free[CONFIG_MALLOC_THREAD_CACHE_CLASSES];
+    malloc_thread_cache_thread_stats_t stats;
+} _cache_t;
+
+static uint8_t _arena[CONFIG_MALLOC_THREAD_CACHE_ARENA_SIZE]
+        __attribute__((aligned(MALLOC_THREAD_CACHE_MIN_SIZE)));
+static uint8_t _slab_class[SLAB_NUMOF];
+static uint16_t _slabs_used;
+static uint16_t _class_slabs[CONFIG_MALLOC_THREAD_CACHE_CLASSES];
+/* _lock protects the global free lists and the slab bookkeeping above, the
+ * caches are only modified by the threads they belong to */
+static _list_t _global[CONFIG_MALLOC_THREAD_CACHE_CLASSES];
+static mutex_t _lock = MUTEX_INIT;
+static _cache_t _caches[MAXTHREADS];
+
+static inline size_t _class_size(unsigned cls)
+{
+    return MALLOC_THREAD_CACHE_MIN_SIZE << cls;
+}
+
+static unsigned _class_of(size_t size)
+{
+    unsigned cls = 0;
+
+    while (_class_size(cls) < size) {
+        cls++;
+    }
+    return cls;
+}
+
+static inline bool _in_arena(const void *ptr)
+{
+    return ((uintptr_t)ptr >= (uintptr_t)_arena) &&
+           ((uintptr_t)ptr < ((uintptr_t)_arena + (SLAB_NUMOF * CONFIG_MALLOC_THREAD_CACHE_SLAB_SIZE)));
+}
+
+static inline unsigned _class_of_block(const void *ptr)
+{
+    return _slab_class[((uintptr_t)ptr - (uintptr_t)_arena) /
+                       CONFIG_MALLOC_THREAD_CACHE_SLAB_SIZE];
+}
+
+static _cache_t *_cache_get(void)
+{
+    kernel_pid_t pid = thread_getpid();
+
+    /* no thread is running yet, e.g. C++ constructors */
+    if (!pid_is_valid(pid)) {
+        return NULL;
+    }
+    return &_caches[pid - KERNEL_PID_FIRST];
+}
+
+static inline void _push(_list_t *list, _block_t *block)
+{
+    block->next = list->head;
+    list->head = block;
+    list->len++;
+}
+
+static inline _block_t *_pop(_list_t *list)
+{
+    _block_t *block = list->head;
+
+    list->head = block->next;
+    list->len--;
+    return block;
+}
+
+/* must be called with _lock held */
+static bool _carve_slab(unsigned cls)
+{
+    if (_slabs_used == SLAB_NUMOF) {
+        return false;
+    }
+    uint8_t *slab = &_arena[_slabs_used * CONFIG_MALLOC_THREAD_CACHE_SLAB_SIZE];
+    size_t size = _class_size(cls);
+
+    _slab_class[_slabs_used++] = cls;
+    _class_slabs[cls]++;
+    /* push in reverse, so blocks are handed out in address order */
+    for (size_t off = CONFIG_MALLOC_THREAD_CACHE_SLAB_SIZE; off >= size; off -= size) {
+        _push(&_global[cls], (_block_t *)&slab[off - size]);
+    }
+    return true;
+}
+
+static bool _refill(_cache_t *cache, unsigned cls)
+{
+    mutex_lock(&_lock);
+    if ((_global[cls].len == 0) && !_carve_slab(cls)) {
+        mutex_unlock(&_lock);
+        return false;
+    }
+    for (unsigned i = 0; (i < CONFIG_MALLOC_THREAD_CACHE_BATCH) && _global[cls].len; i++) {
+        _push(&cache->free[cls], _pop(&_global[cls]));
+    }
+    mutex_unlock(&_lock);
+    cache->stats.refills++;
+    return true;
+}
+
+static void _flush(_cache_t *cache, unsigned cls)
+{
+    mutex_lock(&_lock);
+    for (unsigned i = 0; i < CONFIG_MALLOC_THREAD_CACHE_BATCH; i++) {
+        _push(&_global[cls], _pop(&cache->free[cls]));
+    }
+    mutex_unlock(&_lock);
+    cache->stats.flushes++;
+}
+
+void *thread_cache_alloc(size_t size)
+{
+    _cache_t *cache = _cache_get();
+
+    if (cache == NULL) {
+        return NULL;
+    }
+    cache->stats.allocs++;
+    if ((size == 0) || (size > MALLOC_THREAD_CACHE_MAX_SIZE)) {
+        cache->stats.fallbacks++;
+        return NULL;
+    }
+
+    unsigned cls = _class_of(size);
+
+    if (cache->free[cls].len) {
+        cache->stats.cache_hits++;
+    }
+    else if (!_refill(cache, cls)) {
+        cache->stats.fallbacks++;
+        return NULL;
+    }
+    return _pop(&cache->free[cls]);
+}
+
+bool thread_cache_free(void *ptr)
+{
+    _cache_t *cache = _cache_get();
+
+    if (cache && ptr) {
+        cache->stats.frees++;
+    }
+    if (!_in_arena(ptr)) {
+        return false;
+    }
+
+    unsigned cls = _class_of_block(ptr);
+
+    if (cache == NULL) {
+        mutex_lock(&_lock);
+        _push(&_global[cls], ptr);
+        mutex_unlock(&_lock);
+        return true;
+    }
+    _push(&cache->free[cls], ptr);
+    if (cache->free[cls].len > CONFIG_MALLOC_THREAD_CACHE_LIMIT) {
+        _flush(cache, cls);
+    }
+    return true;
+}
+
+void thread_cache_exit(void)
+{
+    _cache_t *cache = _cache_get();
+
+    if (cache == NULL) {
+        return;
+    }
+    mutex_lock(&_lock);
+    for (unsigned cls = 0; cls < CONFIG_MALLOC_THREAD_CACHE_CLASSES; cls++) {
+        while (cache->free[cls].len) {
+            _push(&_global[cls], _pop(&cache->free[cls]));
+        }
+    }
+    mutex_unlock(&_lock);
+    /* the next thread with this PID starts with fresh counters */
+    memset(&cache->stats, 0, sizeof(cache->stats));
+}
+
+size_t thread_cache_block_size(const void *ptr)
+{
+    if (!_in_arena(ptr)) {
+        return 0;
+    }
+    return _class_size(_class_of_block(ptr));
+}
+
+int malloc_thread_cache_thread_stats(kernel_pid_t pid,
+                                     malloc_thread_cache_thread_stats_t *stats)
+{
+    if (!pid_is_valid(pid)) {
+        return -EINVAL;
+    }
+
+    const _cache_t *cache = &_caches[pid - KERNEL_PID_FIRST];
+
+    *stats = cache->stats;
+    stats->cached = 0;
+    for (unsigned cls = 0; cls < CONFIG_MALLOC_THREAD_CACHE_CLASSES; cls++) {
+        stats->cached += cache->free[cls].len;
+    }
+    return 0;
+}
+
+int malloc_thread_cache_class_stats(unsigned idx,
+                                    malloc_thread_cache_class_stats_t *stats)
+{
+    if (idx >= CONFIG_MALLOC_THREAD_CACHE_CLASSES) {
+        return -EINVAL;
+    }
+    stats->size = _class_size(idx);
+    stats->slabs = _class_slabs[idx];
+    stats->blocks = stats->slabs * (CONFIG_MALLOC_THREAD_CACHE_SLAB_SIZE / stats->size);
+    stats->free_global = _global[idx].len;
+    stats->free_cached = 0;
+    for (unsigned i = 0; i < MAXTHREADS; i++) {
+        stats->free_cached += _caches[i].free[idx].len;
+    }
+    return 0;
+}
+
+unsigned malloc_thread_cache_free_slabs(void)
+{
+    return SLAB_NUMOF - _slabs_used;
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_malloc_thread_cache
+ * @{
+ *
+ * @file
+ * @internal
+ * @brief       Interface between the malloc wrappers and the thread caches
+ */
+
+#ifndef THREAD_CACHE_H
+#define THREAD_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "modules.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_USED(MODULE_MALLOC_THREAD_CACHE) || DOXYGEN
+/**
+ * @brief   Allocates a small block from the cache of the calling thread
+ *
+ * @param[in] size  Requested size in bytes
+ *
+ * @return  The block
+ * @return  NULL if the allocation has to be served by the C library
+ */
+void *thread_cache_alloc(size_t size);
+
+/**
+ * @brief   Returns a block to the cache of the calling thread
+ *
+ * @param[in] ptr   The block
+ *
+ * @return  true if @p ptr was allocated by @ref thread_cache_alloc
+ * @return  false if @p ptr has to be freed by the C library
+ */
+bool thread_cache_free(void *ptr);
+
+/**
+ * @brief   Returns all blocks cached by the calling thread to the global free
+ *          lists
+ *
+ * Called by the scheduler when a thread exits.
+ */
+void thread_cache_exit(void);
+
+/**
+ * @brief   Gets the usable size of a block
+ *
+ * @param[in] ptr   The block
+ *
+ * @return  Size of the block in bytes
+ * @return  0 if @p ptr was not allocated by @ref thread_cache_alloc
+ */
+size_t thread_cache_block_size(const void *ptr);
+#else
+static inline void *thread_cache_alloc(size_t size)
+{
+    (void)size;
+    return NULL;
+}
+
+static inline bool thread_cache_free(void *ptr)
+{
+    (void)ptr;
+    return false;
+}
+
+static inline void thread_cache_exit(void)
+{
+}
+
+static inline size_t thread_cache_block_size(const void *ptr)
+{
+    (void)ptr;
+    return 0;
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* THREAD_CACHE_H */
+/** @} */
@@ -15,7 +15,8 @@
  * @}
  */
 
-#include "bitfield.h"
+#include <errno.h>
+
 #include "checksum/fletcher32.h"
 #include "mutex.h"
 #include "net/af.h"
@@ -28,6 +29,13 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+#define CACHE_PROBES    ((CONFIG_DNS_CACHE_PROBES < CONFIG_DNS_CACHE_SIZE) \
+                         ? CONFIG_DNS_CACHE_PROBES : CONFIG_DNS_CACHE_SIZE)
+
+#define FLAG_USED       (0x1)   /**< entry is in use */
+#define FLAG_NEGATIVE   (0x2)   /**< entry caches a negative response */
+#define FLAG_PREFETCH   (0x4)   /**< a client was asked to refresh the entry */
+
 static struct dns_cache_entry {
     uint32_t hash;
     uint32_t expires;
@@ -39,60 +47,27 @@ static struct dns_cache_entry {
         ipv6_addr_t v6;
 #endif
     } addr;
+    /* length of the address, for negative entries the length of the
+     * addresses that do not exist (0 for both families) */
+    uint8_t len;
+    uint8_t flags;
 } cache[CONFIG_DNS_CACHE_SIZE];
+static dns_cache_stats_t stats;
 static mutex_t cache_mutex = MUTEX_INIT;
 
-#if IS_ACTIVE(CONFIG_DNS_CACHE_A) && IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
-BITFIELD(cache_is_v6, CONFIG_DNS_CACHE_SIZE);
-
-static inline uint8_t _get_len(unsigned idx)
-{
-    return bf_isset(cache_is_v6, idx) ? 16 : 4;
-}
-#elif IS_ACTIVE(CONFIG_DNS_CACHE_A)
-static inline uint8_t _get_len(unsigned idx)
-{
-    (void)idx;
-    return 4;
-}
-#elif IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
-static inline uint8_t _get_len(unsigned idx)
+static inline bool _is_empty(unsigned idx)
 {
-    (void)idx;
-    return 16;
+    return !(cache[idx].flags & FLAG_USED);
 }
-#endif
 
-static void _set_len(unsigned idx, uint8_t len)
+static inline bool _is_negative(unsigned idx)
 {
-#if IS_ACTIVE(CONFIG_DNS_CACHE_A) && IS_ACTIVE(CONFIG_DNS_CACHE_AAAA)
-    if (len == 16) {
-        bf_set(cache_is_v6, idx);
-    } else {
-        bf_unset(cache_is_v6, idx);
-    }
-#else
-    (void)idx;
-    (void)len;
-#endif
-}
-
-static bool _is_empty(unsigned idx)
-{
-    const uint8_t len = _get_len(idx);
-    const uint8_t *addr = (void *)&cache[idx].addr;
-    for (unsigned i = 0; i < len; ++i) {
-        if (addr[i]) {
-            return false;
-        }
-    }
-
-    return true;
+    return cache[idx].flags & FLAG_NEGATIVE;
 }
 
 static void _set_empty(unsigned idx)
 {
-    memset(&cache[idx].addr, 0, _get_len(idx));
+    cache[idx].flags = 0;
 }
 
 static uint8_t _addr_len(int family)
@@ -118,78 +93,154 @@ static uint32_t _hash(const void *data, size_t len)
     return fletcher32(data, (len + 1) / 2);
 }
 
-int dns_cache_query(const char *domain_name, void *addr_out, int family)
+/* first slot of the probe sequence of a hash */
+static inline unsigned _slot(uint32_t hash)
+{
+    /* fold the two fletcher sums, the upper one spreads short names better */
+    return (hash ^ (hash >> 16)) % CONFIG_DNS_CACHE_SIZE;
+}
+
+static inline unsigned _probe(unsigned slot, unsigned i)
+{
+    slot += i;
+    return (slot < CONFIG_DNS_CACHE_SIZE) ? slot : slot - CONFIG_DNS_CACHE_SIZE;
+}
+
+/* invalidates the entry if its TTL expired, must be called with cache_mutex */
+static bool _expire(unsigned idx, uint32_t now)
+{
+    if (_is_empty(idx)) {
+        return true;
+    }
+    if (now > cache[idx].expires) {
+        DEBUG("dns_cache[%u] expired\n", idx);
+        _set_empty(idx);
+        return true;
+    }
+    return false;
+}
+
+int dns_cache_query_prefetch(const char *domain_name, void *addr_out, int family,
+                             bool *prefetch)
 {
     int res = 0;
     uint32_t now = ztimer_now(ZTIMER_MSEC) / MS_PER_SEC;
     uint32_t hash = _hash(domain_name, strlen(domain_name));
     uint8_t addr_len = _addr_len(family);
+    unsigned slot = _slot(hash);
+
+    if (prefetch) {
+        *prefetch = false;
+    }
 
     mutex_lock(&cache_mutex);
-    for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE; ++i) {
-        /* empty slot */
-        if (_is_empty(i)) {
+    for (unsigned n = 0; n < CACHE_PROBES; ++n) {
+        unsigned i = _probe(slot, n);
+
+        /* empty slot or TTL expired */
+        if (_expire(i, now) || (cache[i].hash != hash)) {
             continue;
         }
-        /* TTL expired - invalidate slot */
-        if (now > cache[i].expires) {
-            DEBUG("dns_cache[%u] expired\n", i);
-            _set_empty(i);
+        if (_is_negative(i)) {
+            /* the name has no address of the requested family */
+            if ((cache[i].len == 0) || (cache[i].len == addr_len)) {
+                DEBUG("dns_cache[%u] negative hit\n", i);
+                stats.negative_hits++;
+                res = -ENOENT;
+                break;
+            }
             continue;
         }
-        /* check if hash and length match */
-        if (cache[i].hash == hash && (!addr_len || addr_len == _get_len(i))) {
+        /* check if length matches */
+        if (!addr_len || addr_len == cache[i].len) {
             DEBUG("dns_cache[%u] hit\n", i);
-            memcpy(addr_out, &cache[i].addr, _get_len(i));
-            res = _get_len(i);
+            memcpy(addr_out, &cache[i].addr, cache[i].len);
+            res = cache[i].len;
+            stats.hits++;
+            if (prefetch && !(cache[i].flags & FLAG_PREFETCH) &&
+                ((cache[i].expires - now) <= CONFIG_DNS_CACHE_PREFETCH_THRESHOLD)) {
+                DEBUG("dns_cache[%u] prefetch\n", i);
+                cache[i].flags |= FLAG_PREFETCH;
+                stats.prefetches++;
+                *prefetch = true;
+            }
             break;
         }
     }
     if (res == 0) {
         DEBUG("dns_cache miss\n");
+        stats.misses++;
     }
     mutex_unlock(&cache_mutex);
     return res;
 }
 
-static void _add_entry(uint8_t i, uint32_t hash, const void *addr_out,
-                       int addr_len, uint32_t expires)
+int dns_cache_query(const char *domain_name, void *addr_out, int family)
+{
+    return dns_cache_query_prefetch(domain_name, addr_out, family, NULL);
+}
+
+static void _add_entry(unsigned i, uint32_t hash, const void *addr_out,
+                       int addr_len, uint32_t expires, uint8_t flags)
 {
     DEBUG("dns_cache[%u] add cache entry\n", i);
     cache[i].hash = hash;
     cache[i].expires = expires;
-    memcpy(&cache[i].addr, addr_out, addr_len);
-    _set_len(i, addr_len);
+    if (!(flags & FLAG_NEGATIVE)) {
+        memcpy(&cache[i].addr, addr_out, addr_len);
+    }
+    cache[i].len = addr_len;
+    cache[i].flags = flags;
 }
 
-void dns_cache_add(const char *domain_name, const void *addr_out,
-                        int addr_len, uint32_t ttl)
+/*
+ * Adds or refreshes an entry. Entries of the same name that contradict the new
+ * one, i.e. negative entries for a new address or addresses of a new negative
+ * entry, are removed.
+ */
+static void _add(const char *domain_name, const void *addr_out, int addr_len,
+                 uint32_t ttl, uint8_t flags)
 {
     uint32_t now = ztimer_now(ZTIMER_MSEC) / MS_PER_SEC;
     uint32_t hash = _hash(domain_name, strlen(domain_name));
     uint32_t oldest = ttl;
+    unsigned slot = _slot(hash);
     int idx = -1;
-
-    assert(addr_len == 4 || addr_len == 16);
-    DEBUG("dns_cache: lifetime of %s is %"PRIu32" s\n", domain_name, ttl);
+    int free_idx = -1;
 
     mutex_lock(&cache_mutex);
     /* iterate even if TTL = 0 just in case we need to expire */
-    for (unsigned i = 0; i < CONFIG_DNS_CACHE_SIZE; ++i) {
-        if (ttl && (now > cache[i].expires || _is_empty(i))) {
-            _add_entry(i, hash, addr_out, addr_len, now + ttl);
-            goto exit;
+    for (unsigned n = 0; n < CACHE_PROBES; ++n) {
+        unsigned i = _probe(slot, n);
+
+        if (_expire(i, now)) {
+            if (free_idx < 0) {
+                free_idx = i;
+            }
+            continue;
         }
-        if (cache[i].hash == hash && _get_len(i) == addr_len) {
-            DEBUG("dns_cache[%u] update ttl\n", i);
-            if (ttl) {
-                cache[i].expires = now + ttl;
+        if (cache[i].hash == hash) {
+            bool negative = _is_negative(i);
+
+            if ((negative == !!(flags & FLAG_NEGATIVE)) && (cache[i].len == addr_len)) {
+                DEBUG("dns_cache[%u] update ttl\n", i);
+                if (ttl) {
+                    _add_entry(i, hash, addr_out, addr_len, now + ttl, flags);
+                }
+                else {
+                    _set_empty(i);
+                }
+                goto exit;
             }
-            else {
-                /* put one second into past so that it is immediately expired */
-                cache[i].expires = now - 1;
+            if ((negative && ((cache[i].len == 0) || (cache[i].len == addr_len))) ||
+                (!negative && ((addr_len == 0) || (cache[i].len == addr_len)))) {
+                DEBUG("dns_cache[%u] contradicted\n", i);
+                _set_empty(i);
+                if (free_idx < 0) {
+                    free_idx = i;
+                }
+                continue;
             }
-            goto exit;
         }
         uint32_t _ttl = cache[i].expires - now;
         if (_ttl < oldest) {
@@ -198,10 +249,48 @@ void dns_cache_add(const char *domain_name, const void *addr_out,
         }
     }
 
-    if (ttl && idx >= 0) {
+    if (ttl == 0) {
+        goto exit;
+    }
+    if (free_idx >= 0) {
+        _add_entry(free_idx, hash, addr_out, addr_len, now + ttl, flags);
+    }
+    else if (idx >= 0) {
         DEBUG("dns_cache: evict first entry to expire\n");
-        _add_entry(idx, hash, addr_out, addr_len, now + ttl);
+        stats.evictions++;
+        _add_entry(idx, hash, addr_out, addr_len, now + ttl, flags);
     }
 exit:
     mutex_unlock(&cache_mutex);
 }
+
+void dns_cache_add(const char *domain_name, const void *addr_out,
+                        int addr_len, uint32_t ttl)
+{
+    assert(addr_len == 4 || addr_len == 16);
+    DEBUG("dns_cache: lifetime of %s is %"PRIu32" s\n", domain_name, ttl);
+
+    _add(domain_name, addr_out, addr_len, ttl, FLAG_USED);
+}
+
+void dns_cache_add_negative(const char *domain_name, int family, uint32_t ttl)
+{
+    uint8_t addr_len = _addr_len(family);
+
+    if (addr_len == 255) {
+        return;
+    }
+    if (ttl > CONFIG_DNS_CACHE_NEGATIVE_TTL_MAX) {
+        ttl = CONFIG_DNS_CACHE_NEGATIVE_TTL_MAX;
+    }
+    DEBUG("dns_cache: %s does not exist for %"PRIu32" s\n", domain_name, ttl);
+
+    _add(domain_name, NULL, addr_len, ttl, FLAG_USED | FLAG_NEGATIVE);
+}
+
+void dns_cache_get_stats(dns_cache_stats_t *out)
+{
+    mutex_lock(&cache_mutex);
+    *out = stats;
+    mutex_unlock(&cache_mutex);
+}
@@ -26,6 +26,12 @@
 
 #include "net/dns/msg.h"
 
+#define DNS_RCODE_MASK          (0x000f)
+#define DNS_RCODE_NOERROR       (0)
+#define DNS_RCODE_NXDOMAIN      (3)
+/* length of the MINIMUM field of a SOA record */
+#define DNS_SOA_MINIMUM_LENGTH  (4U)
+
 static ssize_t _enc_domain_name(uint8_t *out, const char *domain_name)
 {
     /*
@@ -87,6 +93,13 @@ static ssize_t _skip_hostname(const uint8_t *buf, size_t len,
     }
 
     while (bufpos[res]) {
+        /* name ends with a pointer to a previous name */
+        if (bufpos[res] >= 192) {
+            if ((&bufpos[res + 2]) >= buflim) {
+                return -EBADMSG;
+            }
+            return res + 2;
+        }
         res += bufpos[res] + 1;
         if ((&bufpos[res]) >= buflim) {
             /* out-of-bound */
@@ -96,6 +109,47 @@ static ssize_t _skip_hostname(const uint8_t *buf, size_t len,
     return res + 1;
 }
 
+/*
+ * Gets the negative caching TTL from the SOA record in the authority section
+ * of a negative response, see RFC 2308, section 5.
+ *
+ * return 0 if there is no SOA record
+ */
+static uint32_t _get_negative_ttl(const uint8_t *buf, size_t len,
+                                  const uint8_t *bufpos, unsigned nscount)
+{
+    const uint8_t *buflim = buf + len;
+
+    for (unsigned n = 0; n < nscount; n++) {
+        ssize_t tmp = _skip_hostname(buf, len, bufpos);
+        if (tmp < 0) {
+            return 0;
+        }
+        bufpos += tmp;
+        if ((bufpos + RR_TYPE_LENGTH + RR_CLASS_LENGTH +
+             RR_TTL_LENGTH + RR_RDLENGTH_LENGTH) > buflim) {
+            return 0;
+        }
+        uint16_t _type = ntohs(_get_short(bufpos));
+        bufpos += RR_TYPE_LENGTH + RR_CLASS_LENGTH;
+        uint32_t ttl = byteorder_bebuftohl(bufpos);
+        bufpos += RR_TTL_LENGTH;
+        unsigned rdlen = ntohs(_get_short(bufpos));
+        bufpos += RR_RDLENGTH_LENGTH;
+        if ((rdlen > len) || ((bufpos + rdlen) > buflim)) {
+            return 0;
+        }
+        if ((_type != DNS_TYPE_SOA) || (rdlen < DNS_SOA_MINIMUM_LENGTH)) {
+            bufpos += rdlen;
+            continue;
+        }
+        /* MINIMUM is the last field of the SOA record */
+        uint32_t minimum = byteorder_bebuftohl(bufpos + rdlen - DNS_SOA_MINIMUM_LENGTH);
+        return (minimum < ttl) ? minimum : ttl;
+    }
+    return 0;
+}
+
 size_t dns_msg_compose_query(void *dns_buf, const char *domain_name,
                              uint16_t id, int family)
 {
@@ -198,6 +252,21 @@ int dns_msg_parse_reply(const uint8_t *buf, size_t len, int family,
         return addrlen;
     }
 
+    /* no matching address: check for a negative response (RFC 2308) */
+    unsigned rcode = ntohs(hdr->flags) & DNS_RCODE_MASK;
+    if ((rcode == DNS_RCODE_NXDOMAIN) || (rcode == DNS_RCODE_NOERROR)) {
+        uint32_t neg_ttl = _get_negative_ttl(buf, len, bufpos, ntohs(hdr->nscount));
+
+        /* a NODATA response without SOA record is indistinguishable from a
+         * referral, RFC 2308, section 2.2 */
+        if ((rcode == DNS_RCODE_NXDOMAIN) || (neg_ttl > 0)) {
+            if (ttl) {
+                *ttl = neg_ttl;
+            }
+            return -ENOENT;
+        }
+    }
+
     return -EBADMSG;
 }
 
@@ -123,9 +123,11 @@ static ssize_t _send(const void *buf, size_t len, const sock_udp_ep_t *remote,
 int gcoap_dns_query(const char *domain_name, void *addr_out, int family)
 {
     int res;
+    bool prefetch;
+    int cached = dns_cache_query_prefetch(domain_name, addr_out, family, &prefetch);
 
-    if ((res = dns_cache_query(domain_name, addr_out, family)) > 0) {
-        return res;
+    if (cached && !prefetch) {
+        return cached;
     }
 
     static uint8_t coap_buf[CONFIG_GCOAP_DNS_PDU_BUF_SIZE];
@@ -148,6 +150,10 @@ int gcoap_dns_query(const char *domain_name, void *addr_out, int family)
         res = req_ctx.res;
     }
     mutex_unlock(&_client_mutex);
+    /* the cached address is still valid if refreshing it failed */
+    if ((res <= 0) && (res != -ENOENT) && (cached > 0)) {
+        return cached;
+    }
     return res;
 }
 
@@ -745,6 +751,9 @@ static void _resp_handler(const gcoap_request_memo_t *memo, coap_pkt_t *pdu,
                 ttl += max_age;
                 dns_cache_add(_domain_name_from_ctx(context), context->addr_out, context->res, ttl);
             }
+            else if (IS_USED(MODULE_DNS_CACHE) && (context->res == -ENOENT)) {
+                dns_cache_add_negative(_domain_name_from_ctx(context), family, ttl);
+            }
             else if (ENABLE_DEBUG && (context->res < 0)) {
                 DEBUG("gcoap_dns: Unable to parse DNS reply: %d\n",
                       context->res);
@@ -60,6 +60,8 @@ static void _process_coap_pdu(gcoap_socket_t *sock, sock_udp_ep_t *remote, sock_
 static int _tl_init_coap_socket(gcoap_socket_t *sock, gcoap_socket_type_t type);
 static ssize_t _tl_send(gcoap_socket_t *sock, const void *data, size_t len,
                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux);
+static ssize_t _tl_sendv(gcoap_socket_t *sock, const iolist_t *snips,
+                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux);
 static ssize_t _tl_authenticate(gcoap_socket_t *sock, const sock_udp_ep_t *remote,
                                 uint32_t timeout);
 static ssize_t _well_known_core_handler(coap_pkt_t* pdu, uint8_t *buf, size_t len,
@@ -79,6 +81,11 @@ static int _find_obs_memo(gcoap_observe_memo_t **memo, sock_udp_ep_t *remote,
                                                        coap_pkt_t *pdu);
 static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
                                    const coap_resource_t *resource);
+static gcoap_observe_memo_t *_find_obs_memo_resource_remote(const coap_resource_t *resource,
+                                                            gcoap_socket_type_t type,
+                                                            const sock_udp_ep_t *remote);
+static unsigned _obs_count(const coap_resource_t *resource);
+static void _obs_index_set(gcoap_observe_memo_t *memo, const coap_resource_t *resource);
 static nanocoap_cache_entry_t *_cache_lookup_memo(gcoap_request_memo_t *cache_key);
 static void _cache_process(gcoap_request_memo_t *memo,
                            coap_pkt_t *pdu);
@@ -123,6 +130,11 @@ typedef struct {
                                            observe memos */
     gcoap_observe_memo_t observe_memos[CONFIG_GCOAP_OBS_REGISTRATIONS_MAX];
                                         /* Observed resource registrations */
+    gcoap_observe_memo_t *obs_index[CONFIG_GCOAP_OBS_INDEX_BUCKETS];
+                                        /* Registrations by resource */
+    gcoap_obs_stats_t obs_stats;        /* Observe notification statistics */
+    uint32_t obs_rate_start;            /* Start of current rate interval */
+    uint32_t obs_rate_count;            /* Notifications in current interval */
     uint8_t resend_bufs[CONFIG_GCOAP_RESEND_BUFS_MAX][CONFIG_GCOAP_PDU_BUF_SIZE];
                                         /* Buffers for PDU for request resends;
                                            if first byte of an entry is zero,
@@ -627,7 +639,6 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
     gcoap_listener_t *listener          = NULL;
     sock_udp_ep_t *observer             = NULL;
     gcoap_observe_memo_t *memo          = NULL;
-    gcoap_observe_memo_t *resource_memo = NULL;
 
     switch (_find_resource(sock->type, pdu, &resource, &listener)) {
         case GCOAP_RESOURCE_WRONG_METHOD:
@@ -635,8 +646,6 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         case GCOAP_RESOURCE_NO_PATH:
             return gcoap_response(pdu, buf, len, COAP_CODE_PATH_NOT_FOUND);
         case GCOAP_RESOURCE_FOUND:
-            /* find observe registration for resource */
-            _find_obs_memo_resource(&resource_memo, resource);
             break;
         case GCOAP_RESOURCE_ERROR:
         default:
@@ -647,27 +656,26 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
     if (coap_get_observe(pdu) == COAP_OBS_REGISTER) {
         /* lookup remote+token */
         int empty_slot = _find_obs_memo(&memo, remote, pdu);
+        unsigned observers = _obs_count(resource);
         /* validate re-registration request */
-        if (resource_memo != NULL) {
-            if (memo != NULL) {
-                if (memo != resource_memo) {
-                    /* reject token already used for a different resource */
-                    memo = NULL;
-                    coap_clear_observe(pdu);
-                    DEBUG("gcoap: can't change resource for token\n");
-                }
-                /* otherwise OK to re-register resource with the same token */
-            }
-            else if ((sock->type == resource_memo->socket.type) &&
-                     sock_udp_ep_equal(remote, resource_memo->observer)) {
-                /* accept new token for resource */
-                memo = resource_memo;
+        if (memo != NULL) {
+            if ((memo->resource != resource) &&
+                (observers >= CONFIG_GCOAP_OBS_RESOURCE_OBSERVERS_MAX)) {
+                /* reject token already used for a different resource */
+                memo = NULL;
+                coap_clear_observe(pdu);
+                DEBUG("gcoap: can't change resource for token\n");
             }
+            /* otherwise OK to re-register resource with the same token */
+        }
+        else {
+            /* accept new token for resource */
+            memo = _find_obs_memo_resource_remote(resource, sock->type, remote);
         }
         /* initialize new registration request */
         if ((memo == NULL) && coap_has_observe(pdu)) {
-            /* verify resource not already registered (for another endpoint) */
-            if ((empty_slot >= 0) && (resource_memo == NULL)) {
+            /* verify resource not already registered (for too many endpoints) */
+            if ((empty_slot >= 0) && (observers < CONFIG_GCOAP_OBS_RESOURCE_OBSERVERS_MAX)) {
                 int obs_slot = _find_observer(&observer, remote);
                 /* cache new observer */
                 if (observer == NULL) {
@@ -691,7 +699,7 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         /* finish registration */
         if (memo != NULL) {
             /* resource may be assigned here if it is not already registered */
-            memo->resource = resource;
+            _obs_index_set(memo, resource);
             memo->token_len = coap_get_token_len(pdu);
             memo->socket = *sock;
             if (memo->token_len) {
@@ -705,6 +713,7 @@ static size_t _handle_req(gcoap_socket_t *sock, coap_pkt_t *pdu, uint8_t *buf,
         /* clear memo, and clear observer if no other memos */
         if (memo != NULL) {
             DEBUG("gcoap: Deregistering observer for: %s\n", memo->resource->path);
+            _obs_index_set(memo, NULL);
             memo->observer = NULL;
             memo           = NULL;
             _find_obs_memo(&memo, remote, NULL);
@@ -1003,6 +1012,50 @@ static int _find_obs_memo(gcoap_observe_memo_t **memo, sock_udp_ep_t *remote,
     return empty_slot;
 }
 
+/*
+ * Find registered observe memo for a resource.
+ *
+ * memo[out] -- Registered observe memo, or NULL if not found
+ * resource[in] -- Resource to match
+ */
+static gcoap_observe_memo_t **_obs_index_bucket(const coap_resource_t *resource)
+{
+    uintptr_t idx = (uintptr_t)resource / sizeof(coap_resource_t);
+
+    return &_coap_state.obs_index[idx % CONFIG_GCOAP_OBS_INDEX_BUCKETS];
+}
+
+/*
+ * Moves an observe memo to the index entry for a resource.
+ *
+ * memo[in] -- Observe memo, in the index if its resource is not NULL
+ * resource[in] -- Resource the memo is registered for, or NULL to remove the
+ *                 memo from the index
+ */
+static void _obs_index_set(gcoap_observe_memo_t *memo,
+                           const coap_resource_t *resource)
+{
+    if (memo->resource == resource) {
+        return;
+    }
+    if (memo->resource != NULL) {
+        gcoap_observe_memo_t **prev = _obs_index_bucket(memo->resource);
+
+        while (*prev != memo) {
+            prev = &(*prev)->next;
+        }
+        *prev = memo->next;
+    }
+    memo->resource = resource;
+    memo->next = NULL;
+    if (resource != NULL) {
+        gcoap_observe_memo_t **bucket = _obs_index_bucket(resource);
+
+        memo->next = *bucket;
+        *bucket = memo;
+    }
+}
+
 /*
  * Find registered observe memo for a resource.
  *
@@ -1012,14 +1065,43 @@ static int _find_obs_memo(gcoap_observe_memo_t **memo, sock_udp_ep_t *remote,
 static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
                                    const coap_resource_t *resource)
 {
-    *memo = NULL;
-    for (int i = 0; i < CONFIG_GCOAP_OBS_REGISTRATIONS_MAX; i++) {
-        if (_coap_state.observe_memos[i].observer != NULL
-                && _coap_state.observe_memos[i].resource == resource) {
-            *memo = &_coap_state.observe_memos[i];
-            break;
+    *memo = *_obs_index_bucket(resource);
+    while ((*memo != NULL) && ((*memo)->resource != resource)) {
+        *memo = (*memo)->next;
+    }
+}
+
+/*
+ * Find registered observe memo for a resource and a remote endpoint.
+ *
+ * return Registered observe memo, or NULL if not found
+ */
+static gcoap_observe_memo_t *_find_obs_memo_resource_remote(const coap_resource_t *resource,
+                                                            gcoap_socket_type_t type,
+                                                            const sock_udp_ep_t *remote)
+{
+    for (gcoap_observe_memo_t *memo = *_obs_index_bucket(resource); memo; memo = memo->next) {
+        if ((memo->resource == resource) && (memo->socket.type == type) &&
+            sock_udp_ep_equal(remote, memo->observer)) {
+            return memo;
         }
     }
+    return NULL;
+}
+
+/*
+ * Count registered observe memos for a resource.
+ */
+static unsigned _obs_count(const coap_resource_t *resource)
+{
+    unsigned count = 0;
+
+    for (gcoap_observe_memo_t *memo = *_obs_index_bucket(resource); memo; memo = memo->next) {
+        if (memo->resource == resource) {
+            count++;
+        }
+    }
+    return count;
 }
 
 /*
@@ -1052,11 +1134,22 @@ static int _tl_init_coap_socket(gcoap_socket_t *sock, gcoap_socket_type_t type)
 
 static ssize_t _tl_send(gcoap_socket_t *sock, const void *data, size_t len,
                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
+{
+    const iolist_t snip = {
+        .iol_base = (void *)data,
+        .iol_len  = len,
+    };
+
+    return _tl_sendv(sock, &snip, remote, aux);
+}
+
+static ssize_t _tl_sendv(gcoap_socket_t *sock, const iolist_t *snips,
+                         const sock_udp_ep_t *remote, sock_udp_aux_tx_t *aux)
 {
     ssize_t res = -1;
     switch (sock->type) {
         case GCOAP_SOCKET_TYPE_UDP:
-            res = sock_udp_send_aux(sock->socket.udp, data, len, remote, aux);
+            res = sock_udp_sendv_aux(sock->socket.udp, snips, remote, aux);
             break;
 #if IS_USED(MODULE_GCOAP_DTLS)
         case GCOAP_SOCKET_TYPE_DTLS:
@@ -1071,8 +1164,9 @@ static ssize_t _tl_send(gcoap_socket_t *sock, const void *data, size_t len,
             }
 
             /* send application data */
-            res = sock_dtls_send(sock->socket.dtls, &sock->ctx_dtls_session, data, len,
-                                    SOCK_NO_TIMEOUT);
+            (void)aux;
+            res = sock_dtls_sendv(sock->socket.dtls, &sock->ctx_dtls_session, snips,
+                                  SOCK_NO_TIMEOUT);
             switch (res) {
             case -EHOSTUNREACH:
             case -ENOTCONN:
@@ -1378,6 +1472,7 @@ kernel_pid_t gcoap_init(void)
     memset(&_coap_state.open_reqs[0], 0, sizeof(_coap_state.open_reqs));
     memset(&_coap_state.observers[0], 0, sizeof(_coap_state.observers));
     memset(&_coap_state.observe_memos[0], 0, sizeof(_coap_state.observe_memos));
+    memset(&_coap_state.obs_index[0], 0, sizeof(_coap_state.obs_index));
     memset(&_coap_state.resend_bufs[0], 0, sizeof(_coap_state.resend_bufs));
     /* randomize initial value */
     atomic_init(&_coap_state.next_message_id, (unsigned)random_uint32());
@@ -1687,6 +1782,66 @@ size_t gcoap_obs_send(const uint8_t *buf, size_t len,
     }
 }
 
+size_t gcoap_obs_notify_all(const uint8_t *buf, size_t len,
+                            const coap_resource_t *resource)
+{
+    coap_pkt_t pdu = { .hdr = (coap_hdr_t *)buf };
+    uint8_t hdr_buf[GCOAP_HEADER_MAXLEN + 2];
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    uint32_t encode_usec = 0;
+    size_t count = 0;
+
+    /* options and payload are shared by all notifications */
+    const uint8_t *body = coap_hdr_data_ptr(pdu.hdr) + coap_get_token_len(&pdu);
+    iolist_t body_snip = {
+        .iol_base = (void *)body,
+        .iol_len  = len - (body - buf),
+    };
+    iolist_t hdr_snip = {
+        .iol_next = &body_snip,
+        .iol_base = hdr_buf,
+    };
+
+    for (gcoap_observe_memo_t *memo = *_obs_index_bucket(resource); memo; memo = memo->next) {
+        if (memo->resource != resource) {
+            continue;
+        }
+
+        uint32_t encode_start = ztimer_now(ZTIMER_USEC);
+        ssize_t hdr_len = coap_build_hdr((coap_hdr_t *)hdr_buf, coap_get_type(&pdu),
+                                         memo->token, memo->token_len,
+                                         coap_get_code_raw(&pdu), gcoap_next_msg_id());
+        encode_usec += ztimer_now(ZTIMER_USEC) - encode_start;
+        if (hdr_len <= 0) {
+            continue;
+        }
+        hdr_snip.iol_len = hdr_len;
+        if (_tl_sendv(&memo->socket, &hdr_snip, memo->observer, NULL) > 0) {
+            count++;
+        }
+    }
+
+    uint32_t now = ztimer_now(ZTIMER_USEC);
+    gcoap_obs_stats_t *stats = &_coap_state.obs_stats;
+
+    stats->notifications += count;
+    stats->bursts++;
+    stats->encode_usec += encode_usec;
+    stats->send_usec += (now - start) - encode_usec;
+    if ((now - _coap_state.obs_rate_start) >= US_PER_SEC) {
+        stats->rate = _coap_state.obs_rate_count;
+        _coap_state.obs_rate_start = now;
+        _coap_state.obs_rate_count = 0;
+    }
+    _coap_state.obs_rate_count += count;
+    return count;
+}
+
+void gcoap_obs_get_stats(gcoap_obs_stats_t *stats)
+{
+    *stats = _coap_state.obs_stats;
+}
+
 uint8_t gcoap_op_state(void)
 {
     uint8_t count = 0;
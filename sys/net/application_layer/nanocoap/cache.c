@@ -27,45 +27,202 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
-static int _cache_replacement_lru(void);
-static int _cache_update_lru(clist_node_t *node);
+static_assert(CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE <= CONFIG_NANOCOAP_CACHE_SIZE,
+              "CONFIG_NANOCOAP_CACHE_SIZE must hold at least one response");
 
-static clist_node_t _cache_list_head = { NULL };
 static clist_node_t _empty_list_head = { NULL };
+static nanocoap_cache_entry_t *_buckets[CONFIG_NANOCOAP_CACHE_BUCKETS];
+/* least recently used entry at the head, most recently used at the tail */
+static nanocoap_cache_entry_t *_lru_head;
+static nanocoap_cache_entry_t *_lru_tail;
+static nanocoap_cache_entry_t *_wheel[CONFIG_NANOCOAP_CACHE_WHEEL_SIZE];
+static uint32_t _wheel_now;
+static size_t _used;
 
 static nanocoap_cache_entry_t _cache_entries[CONFIG_NANOCOAP_CACHE_ENTRIES];
+static uint8_t _response_bufs[CONFIG_NANOCOAP_CACHE_SIZE];
+static size_t _response_bufs_used;
+static nanocoap_cache_stats_t _stats;
 
-static const nanocoap_cache_replacement_strategy_t _replacement_strategy = _cache_replacement_lru;
-static const nanocoap_cache_update_strategy_t _update_strategy = _cache_update_lru;
+static void _remove(nanocoap_cache_entry_t *ce);
 
-static int _cache_replacement_lru(void)
+static nanocoap_cache_entry_t **_bucket(const uint8_t *cache_key)
 {
-    clist_node_t *lru_node = clist_lpeek(&_cache_list_head);
+    /* the cache key is a hash already, so its first bytes will do */
+    uint32_t hash = 0;
 
-    /* no element in the list */
-    if (!lru_node) {
-        return -1;
+    for (unsigned i = 0; (i < CONFIG_NANOCOAP_CACHE_KEY_LENGTH) && (i < sizeof(hash)); i++) {
+        hash = (hash << 8) | cache_key[i];
+    }
+    return &_buckets[hash % CONFIG_NANOCOAP_CACHE_BUCKETS];
+}
+
+static void _lru_unlink(nanocoap_cache_entry_t *ce)
+{
+    if (ce->lru_prev) {
+        ce->lru_prev->lru_next = ce->lru_next;
+    }
+    else {
+        _lru_head = ce->lru_next;
+    }
+    if (ce->lru_next) {
+        ce->lru_next->lru_prev = ce->lru_prev;
+    }
+    else {
+        _lru_tail = ce->lru_prev;
+    }
+    ce->lru_prev = NULL;
+    ce->lru_next = NULL;
+}
+
+static void _lru_append(nanocoap_cache_entry_t *ce)
+{
+    ce->lru_prev = _lru_tail;
+    ce->lru_next = NULL;
+    if (_lru_tail) {
+        _lru_tail->lru_next = ce;
+    }
+    else {
+        _lru_head = ce;
+    }
+    _lru_tail = ce;
+}
+
+static void _lru_touch(nanocoap_cache_entry_t *ce)
+{
+    if (ce != _lru_tail) {
+        _lru_unlink(ce);
+        _lru_append(ce);
+    }
+}
+
+static inline uint32_t _evict_time(const nanocoap_cache_entry_t *ce)
+{
+    return ce->max_age + CONFIG_NANOCOAP_CACHE_STALE_TIMEOUT;
+}
+
+static void _wheel_insert(nanocoap_cache_entry_t *ce)
+{
+    nanocoap_cache_entry_t **slot;
+
+    ce->evict_at = _evict_time(ce);
+    slot = &_wheel[ce->evict_at % CONFIG_NANOCOAP_CACHE_WHEEL_SIZE];
+    ce->wheel_next = *slot;
+    *slot = ce;
+}
+
+static void _wheel_remove(nanocoap_cache_entry_t *ce)
+{
+    nanocoap_cache_entry_t **prev = &_wheel[ce->evict_at % CONFIG_NANOCOAP_CACHE_WHEEL_SIZE];
+
+    while (*prev != ce) {
+        prev = &(*prev)->wheel_next;
+    }
+    *prev = ce->wheel_next;
+}
+
+/* evicts all entries that were stale for CONFIG_NANOCOAP_CACHE_STALE_TIMEOUT
+ * seconds, visiting every wheel slot that passed since the last call once */
+static void _expire(void)
+{
+    uint32_t now = ztimer_now(ZTIMER_SEC);
+    uint32_t slots = now - _wheel_now;
+
+    if (_used == 0) {
+        _wheel_now = now;
+        return;
+    }
+    if (slots > CONFIG_NANOCOAP_CACHE_WHEEL_SIZE) {
+        slots = CONFIG_NANOCOAP_CACHE_WHEEL_SIZE;
+    }
+    for (uint32_t i = 1; i <= slots; i++) {
+        nanocoap_cache_entry_t *ce = _wheel[(_wheel_now + i) % CONFIG_NANOCOAP_CACHE_WHEEL_SIZE];
+
+        while (ce) {
+            nanocoap_cache_entry_t *next = ce->wheel_next;
+
+            /* max_age may have been refreshed since the entry was filed */
+            if ((int)(now - _evict_time(ce)) >= 0) {
+                _remove(ce);
+                _stats.expirations++;
+            }
+            else if (_evict_time(ce) != ce->evict_at) {
+                _wheel_remove(ce);
+                _wheel_insert(ce);
+            }
+            ce = next;
+        }
+    }
+    _wheel_now = now;
+}
+
+static uint8_t *_response_buf_alloc(size_t len)
+{
+    uint8_t *buf;
+
+    if ((CONFIG_NANOCOAP_CACHE_SIZE - _response_bufs_used) < len) {
+        return NULL;
+    }
+    buf = &_response_bufs[_response_bufs_used];
+    _response_bufs_used += len;
+    return buf;
+}
+
+/* responses are kept back to back, so close the gap a removed one leaves */
+static void _response_buf_free(uint8_t *buf, size_t len)
+{
+    uint8_t *end = buf + len;
+
+    memmove(buf, end, &_response_bufs[_response_bufs_used] - end);
+    _response_bufs_used -= len;
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
+        nanocoap_cache_entry_t *ce = &_cache_entries[i];
+
+        if (ce->response_buf >= end) {
+            ce->response_buf -= len;
+            ce->response_pkt.hdr = (coap_hdr_t *)ce->response_buf;
+            ce->response_pkt.payload -= len;
+        }
     }
+}
+
+static nanocoap_cache_entry_t *_find(const uint8_t *cache_key)
+{
+    nanocoap_cache_entry_t *ce = *_bucket(cache_key);
 
-    nanocoap_cache_entry_t *lru_ce = container_of(lru_node, nanocoap_cache_entry_t, node);
-    return nanocoap_cache_del(lru_ce);
+    while (ce && memcmp(ce->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
+        ce = ce->bucket_next;
+    }
+    return ce;
 }
 
-static int _cache_update_lru(clist_node_t *node)
+static void _remove(nanocoap_cache_entry_t *ce)
 {
-    if (clist_remove(&_cache_list_head, node)) {
-        /* Move an accessed node to the end of the list. Least
-         * recently used nodes are at the beginning of this list */
-        clist_rpush(&_cache_list_head, node);
-        return 0;
+    nanocoap_cache_entry_t **prev = _bucket(ce->cache_key);
+
+    while (*prev != ce) {
+        prev = &(*prev)->bucket_next;
     }
-    return -1;
+    *prev = ce->bucket_next;
+    _lru_unlink(ce);
+    _wheel_remove(ce);
+    _response_buf_free(ce->response_buf, ce->response_len);
+    memset(ce, 0, sizeof(nanocoap_cache_entry_t));
+    clist_rpush(&_empty_list_head, &ce->node);
+    _used--;
 }
 
 void nanocoap_cache_init(void)
 {
-    _cache_list_head.next = NULL;
     _empty_list_head.next = NULL;
+    memset(_buckets, 0, sizeof(_buckets));
+    memset(_wheel, 0, sizeof(_wheel));
+    memset(&_stats, 0, sizeof(_stats));
+    _lru_head = NULL;
+    _lru_tail = NULL;
+    _used = 0;
+    _response_bufs_used = 0;
+    _wheel_now = ztimer_now(ZTIMER_SEC);
     memset(_cache_entries, 0, sizeof(_cache_entries));
     /* construct list of empty entries */
     for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_ENTRIES; i++) {
@@ -75,12 +232,22 @@ void nanocoap_cache_init(void)
 
 size_t nanocoap_cache_used_count(void)
 {
-    return clist_count(&_cache_list_head);
+    return _used;
 }
 
 size_t nanocoap_cache_free_count(void)
 {
-    return clist_count(&_empty_list_head);
+    return CONFIG_NANOCOAP_CACHE_ENTRIES - _used;
+}
+
+size_t nanocoap_cache_bytes_used(void)
+{
+    return _response_bufs_used;
+}
+
+void nanocoap_cache_get_stats(nanocoap_cache_stats_t *stats)
+{
+    *stats = _stats;
 }
 
 void nanocoap_cache_key_generate(const coap_pkt_t *req, uint8_t *cache_key)
@@ -122,31 +289,20 @@ ssize_t nanocoap_cache_key_compare(uint8_t *cache_key1, uint8_t *cache_key2)
     return memcmp(cache_key1, cache_key2, CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
 }
 
-static int _compare_cache_keys(clist_node_t *ce, void *arg)
+nanocoap_cache_entry_t *nanocoap_cache_key_lookup(const uint8_t *cache_key)
 {
-    nanocoap_cache_entry_t *iterator = container_of(ce, nanocoap_cache_entry_t, node);
-    uint8_t *cache_key = (uint8_t *) arg;
+    nanocoap_cache_entry_t *ce;
 
-    if (!memcmp(iterator->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH)) {
-        return 1;
+    _expire();
+    ce = _find(cache_key);
+    if (ce) {
+        _lru_touch(ce);
+        _stats.hits++;
     }
-    return 0;
-}
-
-static clist_node_t *_nanocoap_cache_foreach(const uint8_t *key)
-{
-    return clist_foreach(&_cache_list_head, _compare_cache_keys, (uint8_t *)key);
-}
-
-nanocoap_cache_entry_t *nanocoap_cache_key_lookup(const uint8_t *key)
-{
-    clist_node_t *node = _nanocoap_cache_foreach(key);
-
-    if (node) {
-        _update_strategy(node);
+    else {
+        _stats.misses++;
     }
-
-    return container_of(node, nanocoap_cache_entry_t, node);
+    return ce;
 }
 
 nanocoap_cache_entry_t *nanocoap_cache_request_lookup(const coap_pkt_t *req)
@@ -167,7 +323,9 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
                                                const coap_pkt_t *resp, size_t resp_len)
 {
     nanocoap_cache_entry_t *ce;
-    ce = nanocoap_cache_key_lookup(cache_key);
+
+    _expire();
+    ce = _find(cache_key);
 
     /* This response is not cacheable. */
     if (resp->hdr->code == COAP_CODE_CREATED) {
@@ -227,26 +385,15 @@ nanocoap_cache_entry_t *nanocoap_cache_process(const uint8_t *cache_key, unsigne
 
     return ce;
 }
-static nanocoap_cache_entry_t *_nanocoap_cache_pop(void)
-{
-    clist_node_t *node;
-
-    node = clist_lpop(&_empty_list_head);
-    if (node != NULL) {
-        return container_of(node, nanocoap_cache_entry_t, node);
-    }
-    else {
-        return NULL;
-    }
-}
-
 nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
                                                   unsigned request_method,
                                                   const coap_pkt_t *resp,
                                                   size_t resp_len)
 {
-    nanocoap_cache_entry_t *ce = nanocoap_cache_key_lookup(cache_key);
-    bool add_to_cache = false;
+    nanocoap_cache_entry_t *ce;
+    nanocoap_cache_entry_t **bucket;
+    clist_node_t *node;
+    uint8_t *buf;
 
     if (resp_len > CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE) {
         DEBUG("nanocoap_cache: response too large to cache (%lu > %d)\n",
@@ -254,32 +401,29 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
         return NULL;
     }
 
-    if (!ce) {
-        /* did not find .. get an empty cache container */
-        ce = _nanocoap_cache_pop();
-        add_to_cache = true;
+    _expire();
+    /* replace an existing entry, its response may have a different size */
+    if ((ce = _find(cache_key))) {
+        _remove(ce);
     }
 
-    /* no space left */
-    if (!ce) {
-        /* could not remove any entry */
-        if (_replacement_strategy()) {
-            return NULL;
-        }
-        /* could remove an entry */
-        ce = _nanocoap_cache_pop();
-        add_to_cache = true;
-        if (!ce) {
-            /* still no free space ? stop trying now */
-            return NULL;
-        }
+    /* make room by replacing the least recently used entries */
+    while ((_empty_list_head.next == NULL) ||
+           ((CONFIG_NANOCOAP_CACHE_SIZE - _response_bufs_used) < resp_len)) {
+        _remove(_lru_head);
+        _stats.evictions++;
     }
+    node = clist_lpop(&_empty_list_head);
+    ce = container_of(node, nanocoap_cache_entry_t, node);
+    buf = _response_buf_alloc(resp_len);
+    assert(buf);
 
     memcpy(ce->cache_key, cache_key, CONFIG_NANOCOAP_CACHE_KEY_LENGTH);
     memcpy(&ce->response_pkt, resp, sizeof(coap_pkt_t));
-    memcpy(&ce->response_buf, resp->hdr, resp_len);
-    ce->response_pkt.hdr = (coap_hdr_t *) ce->response_buf;
-    ce->response_pkt.payload = ce->response_buf + (resp->payload - ((uint8_t *)resp->hdr));
+    memcpy(buf, resp->hdr, resp_len);
+    ce->response_buf = buf;
+    ce->response_pkt.hdr = (coap_hdr_t *)buf;
+    ce->response_pkt.payload = buf + (resp->payload - ((uint8_t *)resp->hdr));
     ce->response_len = resp_len;
     ce->request_method = request_method;
 
@@ -288,9 +432,12 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_key(const uint8_t *cache_key,
     coap_opt_get_uint((coap_pkt_t *)resp, COAP_OPT_MAX_AGE, &max_age);
     ce->max_age = ztimer_now(ZTIMER_SEC) + max_age;
 
-    if (add_to_cache) {
-        clist_rpush(&_cache_list_head, &ce->node);
-    }
+    bucket = _bucket(cache_key);
+    ce->bucket_next = *bucket;
+    *bucket = ce;
+    _lru_append(ce);
+    _wheel_insert(ce);
+    _used++;
 
     return ce;
 }
@@ -312,14 +459,12 @@ nanocoap_cache_entry_t *nanocoap_cache_add_by_req(const coap_pkt_t *req,
 
 int nanocoap_cache_del(const nanocoap_cache_entry_t *ce)
 {
-    clist_node_t *entry = clist_find(&_cache_list_head, &ce->node);
-
-    if (entry) {
-        clist_remove(&_cache_list_head, entry);
-        memset(entry, 0, sizeof(nanocoap_cache_entry_t));
-        clist_rpush(&_empty_list_head, entry);
-        return 0;
+    /* only entries in use have a response */
+    if ((ce < &_cache_entries[0]) ||
+        (ce >= &_cache_entries[CONFIG_NANOCOAP_CACHE_ENTRIES]) ||
+        (ce->response_buf == NULL)) {
+        return -1;
     }
-
-    return -1;
+    _remove((nanocoap_cache_entry_t *)ce);
+    return 0;
 }
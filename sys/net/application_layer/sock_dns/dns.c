@@ -69,6 +69,8 @@ void auto_init_sock_dns(void)
 int sock_dns_query(const char *domain_name, void *addr_out, int family)
 {
     ssize_t res;
+    int cached;
+    bool prefetch;
     sock_udp_t sock_dns;
     static uint8_t dns_buf[CONFIG_DNS_MSG_LEN];
 
@@ -80,9 +82,9 @@ int sock_dns_query(const char *domain_name, void *addr_out, int family)
         return -ENOSPC;
     }
 
-    res = dns_cache_query(domain_name, addr_out, family);
-    if (res) {
-        return res;
+    cached = dns_cache_query_prefetch(domain_name, addr_out, family, &prefetch);
+    if (cached && !prefetch) {
+        return cached;
     }
 
     res = sock_udp_create(&sock_dns, NULL, &sock_dns_server, 0);
@@ -107,6 +109,11 @@ int sock_dns_query(const char *domain_name, void *addr_out, int family)
                     dns_cache_add(domain_name, addr_out, res, ttl);
                     goto out;
                 }
+                if (res == -ENOENT) {
+                    /* asking again will not change the answer */
+                    dns_cache_add_negative(domain_name, family, ttl);
+                    goto out;
+                }
             }
             else {
                 res = -EBADMSG;
@@ -116,5 +123,9 @@ int sock_dns_query(const char *domain_name, void *addr_out, int family)
 
 out:
     sock_udp_close(&sock_dns);
+    /* the cached address is still valid if refreshing it failed */
+    if ((res <= 0) && (res != -ENOENT) && (cached > 0)) {
+        return cached;
+    }
     return res;
 }
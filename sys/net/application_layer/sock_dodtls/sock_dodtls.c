@@ -66,17 +66,19 @@ static void _sleep_ms(uint32_t delay);
 int sock_dodtls_query(const char *domain_name, void *addr_out, int family)
 {
     int res;
+    int cached;
+    bool prefetch;
     uint16_t id;
 
     if (strlen(domain_name) > SOCK_DODTLS_MAX_NAME_LEN) {
         return -ENOSPC;
     }
-    res = dns_cache_query(domain_name, addr_out, family);
-    if (res) {
-        return res;
+    cached = dns_cache_query_prefetch(domain_name, addr_out, family, &prefetch);
+    if (cached && !prefetch) {
+        return cached;
     }
     if (!_server_set()) {
-        return -ECONNREFUSED;
+        return (cached > 0) ? cached : -ECONNREFUSED;
     }
 
     mutex_lock(&_server_mutex);
@@ -92,7 +94,8 @@ int sock_dodtls_query(const char *domain_name, void *addr_out, int family)
                              _dns_buf, buflen, timeout);
         send_duration = _now_ms() - start;
         if (send_duration > CONFIG_SOCK_DODTLS_TIMEOUT_MS) {
-            return -ETIMEDOUT;
+            res = -ETIMEDOUT;
+            goto out;
         }
         timeout -= send_duration;
         if (res <= 0) {
@@ -110,6 +113,11 @@ int sock_dodtls_query(const char *domain_name, void *addr_out, int family)
                     dns_cache_add(domain_name, addr_out, res, ttl);
                     goto out;
                 }
+                if (res == -ENOENT) {
+                    /* asking again will not change the answer */
+                    dns_cache_add_negative(domain_name, family, ttl);
+                    goto out;
+                }
             }
             else {
                 res = -EBADMSG;
@@ -120,6 +128,10 @@ int sock_dodtls_query(const char *domain_name, void *addr_out, int family)
 out:
     memset(_dns_buf, 0, sizeof(_dns_buf));  /* flush-out unencrypted data */
     mutex_unlock(&_server_mutex);
+    /* the cached address is still valid if refreshing it failed */
+    if ((res <= 0) && (res != -ENOENT) && (cached > 0)) {
+        return cached;
+    }
     return res;
 }
 
@@ -13,15 +13,97 @@
  */
 
 #include <inttypes.h>
+#include <stdint.h>
 #include <stdio.h>
 
+#include "byteorder.h"
 #include "modules.h"
 #include "od.h"
 #include "net/inet_csum.h"
+#include "unaligned.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* The one's complement sum is independent of byte order (RFC 1071, 2.(B)),
+ * so the buffer is summed as native 32-bit words into a 64-bit accumulator,
+ * which cannot overflow for any buffer up to 64 KiB. The result is folded
+ * to 16 bits and converted to network byte order once at the end. */
+
+/* the buffer may be accessed as any type by the caller, so word loads must be
+ * allowed to alias it */
+typedef uint16_t __attribute__((__may_alias__)) _alias_u16_t;
+typedef uint32_t __attribute__((__may_alias__)) _alias_u32_t;
+
+static inline uint64_t _sum_aligned(uint64_t acc, const _alias_u32_t *words, size_t num)
+{
+    for (; num >= 4; num -= 4, words += 4) {
+        acc += words[0];
+        acc += words[1];
+        acc += words[2];
+        acc += words[3];
+    }
+    while (num--) {
+        acc += *words++;
+    }
+    return acc;
+}
+
+static inline uint64_t _sum_unaligned(uint64_t acc, const uint8_t *buf, size_t num)
+{
+    for (; num >= 4; num -= 4, buf += 16) {
+        acc += unaligned_get_u32(buf);
+        acc += unaligned_get_u32(buf + 4);
+        acc += unaligned_get_u32(buf + 8);
+        acc += unaligned_get_u32(buf + 12);
+    }
+    for (; num; num--, buf += 4) {
+        acc += unaligned_get_u32(buf);
+    }
+    return acc;
+}
+
+static inline uint32_t _fold(uint64_t acc)
+{
+    acc = (acc & 0xffffffff) + (acc >> 32);
+    acc = (acc & 0xffffffff) + (acc >> 32);
+    uint32_t csum = (acc & 0xffff) + (acc >> 16);
+
+    return (csum & 0xffff) + (csum >> 16);
+}
+
+/* sums @p len bytes starting at an even offset of the checksum domain */
+static uint16_t _sum(const uint8_t *buf, size_t len)
+{
+    uint64_t acc = 0;
+
+    if ((uintptr_t)buf & 1) {
+        acc = _sum_unaligned(acc, buf, len >> 2);
+    }
+    else {
+        /* align to a word boundary, so the main loop can use word loads */
+        if (((uintptr_t)buf & 2) && (len >= 2)) {
+            acc += *(const _alias_u16_t *)buf;
+            buf += 2;
+            len -= 2;
+        }
+        acc = _sum_aligned(acc, (const _alias_u32_t *)buf, len >> 2);
+    }
+    buf += len & ~3;
+    if (len & 2) {
+        acc += unaligned_get_u16(buf);
+        buf += 2;
+    }
+    if (len & 1) {
+        /* last byte is the top half of a 16-bit word in network byte order */
+        uint8_t last[2] = { *buf, 0 };
+
+        acc += unaligned_get_u16(last);
+    }
+
+    return ntohs(_fold(acc));
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -44,25 +126,29 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         csum += *buf;         /* add first byte as bottom half of 16-byte word */
         buf++;
         len--;
-        accum_len++;
     }
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
-    }
-
-    if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
-
-    while (csum >> 16) {
-        uint16_t carry = csum >> 16;
-        csum = (csum & 0xffff) + carry;
-    }
+    csum += _sum(buf, len);
+    csum = (csum & 0xffff) + (csum >> 16);
+    csum = (csum & 0xffff) + (csum >> 16);
 
     DEBUG("inet_sum: new sum = 0x%04" PRIx32 "\n", csum);
 
     return csum;
 }
 
+uint16_t inet_csum_update_buf(uint16_t csum, const uint8_t *from,
+                              const uint8_t *to, uint16_t len)
+{
+    /* RFC 1624, eqn. 3: HC' = ~(~HC + ~m + m') */
+    uint32_t sum = (uint16_t)~csum;
+
+    sum += (uint16_t)~_sum(from, len);
+    sum += _sum(to, len);
+    sum = (sum & 0xffff) + (sum >> 16);
+    sum = (sum & 0xffff) + (sum >> 16);
+
+    return ~sum;
+}
+
 /** @} */
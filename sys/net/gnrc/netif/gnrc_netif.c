@@ -2042,6 +2042,15 @@ static void *_gnrc_netif_thread(void *args)
 
 static void _pass_on_packet(gnrc_pktsnip_t *pkt)
 {
+#if IS_USED(MODULE_GNRC_UDP_FASTPATH)
+    /* runs the UDP receive path and the socket callbacks on this thread's
+     * stack: only GNRC_NETIF_STACKSIZE_DEFAULT accounts for that, interfaces
+     * created with a custom stack size need GNRC_UDP_FASTPATH_EXTRA_STACKSIZE
+     * added by their driver */
+    if ((pkt->type == GNRC_NETTYPE_IPV6) && gnrc_ipv6_fastpath_recv(pkt)) {
+        return;
+    }
+#endif
     /* throw away packet if no one is interested */
     if (!gnrc_netapi_dispatch_receive(pkt->type, GNRC_NETREG_DEMUX_CTX_ALL,
                                       pkt)) {
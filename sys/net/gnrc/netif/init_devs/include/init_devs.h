@@ -21,7 +21,8 @@
 
 #include "thread.h"
 #include "msg.h"
-#include "net/gnrc/netif/conf.h"    /* <- GNRC_NETIF_MSG_QUEUE_SIZE */
+#include "net/gnrc/netif/conf.h"    /* <- GNRC_NETIF_MSG_QUEUE_SIZE,
+                                     *    GNRC_UDP_FASTPATH_EXTRA_STACKSIZE */
 #include "macros/utils.h"
 
 #ifdef __cplusplus
@@ -35,7 +36,8 @@ extern "C" {
  *          stack size by default msg queue size to keep the RAM use the same
  */
 #ifndef GNRC_NETIF_STACKSIZE_DEFAULT
-#define GNRC_NETIF_STACKSIZE_DEFAULT    (THREAD_STACKSIZE_DEFAULT - 128)
+#define GNRC_NETIF_STACKSIZE_DEFAULT    (THREAD_STACKSIZE_DEFAULT - 128 + \
+                                         GNRC_UDP_FASTPATH_EXTRA_STACKSIZE)
 #endif
 
 /**
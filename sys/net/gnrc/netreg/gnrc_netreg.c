@@ -31,9 +31,60 @@
 
 #define _INVALID_TYPE(type) (((type) < GNRC_NETTYPE_UNDEF) || ((type) >= GNRC_NETTYPE_NUMOF))
 
+#ifdef MODULE_GNRC_NETREG_HASH
+static_assert((CONFIG_GNRC_NETREG_HASH_NUMOF &
+               (CONFIG_GNRC_NETREG_HASH_NUMOF - 1)) == 0,
+              "CONFIG_GNRC_NETREG_HASH_NUMOF must be a power of 2");
+
+/* The registry as hash table by gnrc_nettype_t and demux context */
+static gnrc_netreg_entry_t *netreg[CONFIG_GNRC_NETREG_HASH_NUMOF];
+
+static inline gnrc_netreg_entry_t **_bucket(gnrc_nettype_t type,
+                                            uint32_t demux_ctx)
+{
+    /* multiplicative hashing, the upper half of the product depends on all
+     * bits of the key, so take the bucket index from there */
+    uint32_t hash = (demux_ctx ^ ((uint32_t)type << 24)) * 2654435761U;
+
+    return &netreg[(hash >> 16) & (CONFIG_GNRC_NETREG_HASH_NUMOF - 1)];
+}
+
+static inline bool _matches(const gnrc_netreg_entry_t *entry,
+                            gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    return (entry->demux_ctx == demux_ctx) && (entry->nettype == type);
+}
+
+static inline gnrc_nettype_t _type(const gnrc_netreg_entry_t *entry)
+{
+    return entry->nettype;
+}
+#else
 /* The registry as lookup table by gnrc_nettype_t */
 static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
 
+static inline gnrc_netreg_entry_t **_bucket(gnrc_nettype_t type,
+                                            uint32_t demux_ctx)
+{
+    (void)demux_ctx;
+    return &netreg[type];
+}
+
+static inline bool _matches(const gnrc_netreg_entry_t *entry,
+                            gnrc_nettype_t type, uint32_t demux_ctx)
+{
+    /* all entries in a list share the same type */
+    (void)type;
+    return entry->demux_ctx == demux_ctx;
+}
+
+static inline gnrc_nettype_t _type(const gnrc_netreg_entry_t *entry)
+{
+    (void)entry;
+    return GNRC_NETTYPE_UNDEF;
+}
+#endif
+
 /** Held while accessing _lock_counter, and also while the exclusive lock is held */
 static mutex_t _lock_for_counter = MUTEX_INIT;
 /** Number of shared locks on netreg. Saturating arithmetic is used; if this
@@ -63,7 +114,7 @@ static mutex_t _lock_wait_exclusive = MUTEX_INIT;
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
-    memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(netreg, 0, sizeof(netreg));
 }
 
 void gnrc_netreg_acquire_shared(void) {
@@ -151,15 +202,21 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return -EINVAL;
     }
 
+#ifdef MODULE_GNRC_NETREG_HASH
+    entry->nettype = type;
+#endif
+
     _gnrc_netreg_acquire_exclusive();
 
+    gnrc_netreg_entry_t **head = _bucket(type, entry->demux_ctx);
+
     /* don't add the same entry twice */
     gnrc_netreg_entry_t *e;
-    LL_FOREACH(netreg[type], e) {
+    LL_FOREACH(*head, e) {
         assert(entry != e);
     }
 
-    LL_PREPEND(netreg[type], entry);
+    LL_PREPEND(*head, entry);
     _gnrc_netreg_release_exclusive();
 
     return 0;
@@ -172,7 +229,7 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
     }
 
     _gnrc_netreg_acquire_exclusive();
-    LL_DELETE(netreg[type], entry);
+    LL_DELETE(*_bucket(type, entry->demux_ctx), entry);
     /* We can release now already: No new references to this entry can be made
      * any more, and the caller is only allowed to reuse the entry and the mbox
      * target referenced by it after *this* function returned, not when the
@@ -211,11 +268,21 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
 {
     _gnrc_netreg_assert_shared();
 
-    gnrc_netreg_entry_t *res = NULL;
+    gnrc_netreg_entry_t *res;
 
-    if (from || !_INVALID_TYPE(type)) {
-        gnrc_netreg_entry_t *head = (from) ? from->next : netreg[type];
-        LL_SEARCH_SCALAR(head, res, demux_ctx, demux_ctx);
+    if (from) {
+        /* entries with the same type and demux context are in the same list */
+        res = from->next;
+        type = _type(from);
+    }
+    else if (!_INVALID_TYPE(type)) {
+        res = *_bucket(type, demux_ctx);
+    }
+    else {
+        return NULL;
+    }
+    while ((res != NULL) && !_matches(res, type, demux_ctx)) {
+        res = res->next;
     }
 
     return res;
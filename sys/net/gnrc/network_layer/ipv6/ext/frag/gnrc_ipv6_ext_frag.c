@@ -18,6 +18,7 @@
 #include <stdbool.h>
 
 #include "byteorder.h"
+#include "macros/utils.h"
 #include "net/ipv6/ext/frag.h"
 #include "net/ipv6/addr.h"
 #include "net/ipv6/hdr.h"
@@ -50,10 +51,20 @@ static gnrc_ipv6_ext_frag_stats_t _stats;
  */
 static uint32_t _last_id;
 
+/**
+ * @brief   Result of _overlaps()
+ *
+ * Touching and overlapping limits are merged into a single range, so the
+ * limits of the individual fragments are not kept. A fragment that lies
+ * completely within an already received range is thus reported as
+ * FRAG_LIMITS_DUPLICATE, even if it does not match the limits of a received
+ * fragment, and a fragment that partially overlaps is reported as
+ * FRAG_LIMITS_NEW, as before the ranges were merged.
+ */
 typedef enum {
-    FRAG_LIMITS_NEW = 0,        /**< limits are not present and do not overlap */
-    FRAG_LIMITS_DUPLICATE,      /**< fragment limits are already present */
-    FRAG_LIMITS_OVERLAP,        /**< limits overlap */
+    FRAG_LIMITS_NEW = 0,        /**< limits are not completely covered yet */
+    FRAG_LIMITS_DUPLICATE,      /**< limits are covered by received fragments */
+    FRAG_LIMITS_OVERLAP,        /**< limits overlap (currently not reported) */
     FRAG_LIMITS_FULL,           /**< no free gnrc_ipv6_ext_frag_limits_t object */
 } _limits_res_t;
 
@@ -61,6 +72,9 @@ void gnrc_ipv6_ext_frag_init(void)
 {
 #ifdef TEST_SUITES
     memset(_rbuf, 0, sizeof(_rbuf));
+    /* the garbage collection message targets the thread that received the
+     * last fragment, don't let it arrive in a later test */
+    xtimer_remove(&_gc_xtimer);
 #endif
     _last_id = random_uint32();
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_EXT_FRAG_LIMITS_POOL_SIZE; i++) {
@@ -111,6 +125,28 @@ static void _snd_buf_del(gnrc_ipv6_ext_frag_send_t *snd_buf);
  */
 static gnrc_pktsnip_t *_determine_last_per_frag(gnrc_pktsnip_t *pkt);
 
+/**
+ * @brief   Determines how many fragments to send in one go
+ *
+ * Every fragment is a message to gnrc_ipv6, so the burst is bounded by the
+ * free space in its message queue. One slot is kept for the
+ * @ref GNRC_IPV6_EXT_FRAG_CONTINUE message.
+ *
+ * @return  Number of fragments to send, at least 1.
+ */
+static unsigned _burst_size(void);
+
+/**
+ * @brief   Prepares the next fragment of a datagram and passes it to gnrc_ipv6
+ *
+ * @param[in,out] snd_buf   A fragmentation send buffer entry
+ *
+ * @return  true, if fragments of the datagram are left to send.
+ * @return  false, if the last fragment was sent or fragmentation was canceled.
+ *          @p snd_buf is released in both cases.
+ */
+static bool _send_frag(gnrc_ipv6_ext_frag_send_t *snd_buf);
+
 void gnrc_ipv6_ext_frag_send_pkt(gnrc_pktsnip_t *pkt, unsigned path_mtu)
 {
     gnrc_ipv6_ext_frag_send_t *snd_buf = _snd_buf_alloc();
@@ -134,9 +170,8 @@ void gnrc_ipv6_ext_frag_send_pkt(gnrc_pktsnip_t *pkt, unsigned path_mtu)
     gnrc_ipv6_ext_frag_send(snd_buf);
 }
 
-void gnrc_ipv6_ext_frag_send(gnrc_ipv6_ext_frag_send_t *snd_buf)
+static bool _send_frag(gnrc_ipv6_ext_frag_send_t *snd_buf)
 {
-    assert(snd_buf != NULL);
     gnrc_pktsnip_t *last = NULL, *ptr, *to_send = NULL;
     ipv6_ext_frag_t *frag_hdr;
     uint8_t *nh = NULL;
@@ -178,7 +213,7 @@ void gnrc_ipv6_ext_frag_send(gnrc_ipv6_ext_frag_send_t *snd_buf)
                 }
             }
             _snd_buf_free(snd_buf, ENOSPC);
-            return;
+            return false;
         }
         ptr = tmp;
         if (to_send == NULL) {
@@ -215,7 +250,7 @@ void gnrc_ipv6_ext_frag_send(gnrc_ipv6_ext_frag_send_t *snd_buf)
         DEBUG("ipv6_ext_frag: unable to create fragmentation header\n");
         gnrc_pktbuf_release(to_send);
         _snd_buf_free(snd_buf, ENOSPC);
-        return;
+        return false;
     }
     remaining -= sizeof(ipv6_ext_frag_t);
     frag_hdr = ptr->data;
@@ -240,7 +275,7 @@ void gnrc_ipv6_ext_frag_send(gnrc_ipv6_ext_frag_send_t *snd_buf)
                 DEBUG("ipv6_ext_frag: packet buffer full, canceling fragmentation\n");
                 gnrc_pktbuf_release(to_send);
                 _snd_buf_free(snd_buf, ENOSPC);
-                return;
+                return false;
             }
             assert(snd_buf->pkt->next == ptr);  /* we just created it with mark */
             snd_buf->pkt->next = snd_buf->pkt->next->next;
@@ -261,19 +296,42 @@ void gnrc_ipv6_ext_frag_send(gnrc_ipv6_ext_frag_send_t *snd_buf)
         DEBUG("ipv6_ext_frag: Unable to send fragment, canceling fragmentation\n");
         gnrc_pktbuf_release(to_send);
         _snd_buf_free(snd_buf, ENOMEM);
-        return;
+        return false;
+    }
+    if (IS_USED(MODULE_GNRC_IPV6_EXT_FRAG_STATS)) {
+        _stats.sent_fragments++;
     }
     if (last_fragment) {
         /* last fragment => we don't need the send buffer anymore.
          * But as we just sent it to gnrc_ipv6 we still need the packet
          * allocated, so not _snd_buf_free()! */
         _snd_buf_del(snd_buf);
+        if (IS_USED(MODULE_GNRC_IPV6_EXT_FRAG_STATS)) {
+            _stats.sent_datagrams++;
+        }
+        return false;
     }
-    else {
+    return true;
+}
+
+void gnrc_ipv6_ext_frag_send(gnrc_ipv6_ext_frag_send_t *snd_buf)
+{
+    assert(snd_buf != NULL);
+    unsigned burst = _burst_size();
+    bool more;
+
+    if (IS_USED(MODULE_GNRC_IPV6_EXT_FRAG_STATS)) {
+        _stats.bursts++;
+    }
+    do {
+        more = _send_frag(snd_buf);
+    } while (more && --burst);
+    if (more) {
         /* tell gnrc_ipv6 to continue fragmenting the datagram in snd_buf
          * later */
-        msg.type = GNRC_IPV6_EXT_FRAG_CONTINUE;
-        msg.content.ptr = snd_buf;
+        msg_t msg = { .type = GNRC_IPV6_EXT_FRAG_CONTINUE,
+                      .content = { .ptr = snd_buf } };
+
         if (msg_try_send(&msg, gnrc_ipv6_pid) <= 0) {
             DEBUG("ipv6_ext_frag: Unable to continue fragmentation, canceling\n");
             _snd_buf_free(snd_buf, ENOMEM);
@@ -281,6 +339,17 @@ void gnrc_ipv6_ext_frag_send(gnrc_ipv6_ext_frag_send_t *snd_buf)
     }
 }
 
+static unsigned _burst_size(void)
+{
+    unsigned room = msg_queue_capacity(gnrc_ipv6_pid) -
+                    msg_avail_thread(gnrc_ipv6_pid);
+
+    if (room <= 2) {
+        return 1;
+    }
+    return MIN(room - 1, CONFIG_GNRC_IPV6_EXT_FRAG_SEND_BURST);
+}
+
 static gnrc_ipv6_ext_frag_send_t *_snd_buf_alloc(void)
 {
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_EXT_FRAG_SEND_SIZE; i++) {
@@ -377,7 +446,8 @@ static inline void _init_rbuf(gnrc_ipv6_ext_frag_rbuf_t *rbuf, ipv6_hdr_t *ipv6,
  * @brief   Checks if given fragment limits overlap with fragment limits already
  *          in a given reassembly buffer entry
  *
- * If no overlap exists the new limits are added to @p rbuf.
+ * If the new limits are not already covered they are added to @p rbuf,
+ * merged with all limits they overlap or touch.
  *
  * @param[in, out] rbuf A reassembly buffer entry.
  * @param[in] offset    A fragment offset.
@@ -618,69 +688,99 @@ gnrc_ipv6_ext_frag_stats_t *gnrc_ipv6_ext_frag_stats(void)
     return (IS_USED(MODULE_GNRC_IPV6_EXT_FRAG_STATS)) ? &_stats : NULL;
 }
 
-typedef struct {
-    uint16_t start;
-    uint16_t end;
-} _check_limits_t;
-
 static inline void _init_rbuf(gnrc_ipv6_ext_frag_rbuf_t *rbuf, ipv6_hdr_t *ipv6,
                               uint32_t id)
 {
     rbuf->ipv6 = ipv6;
     rbuf->id = id;
     rbuf->pkt_len = 0;
+    rbuf->frags = 0;
     rbuf->last = 0;
 }
 
-static int _check_overlap(clist_node_t *node, void *arg)
-{
-    _check_limits_t *limits = arg;
-    gnrc_ipv6_ext_frag_limits_t *cur = (gnrc_ipv6_ext_frag_limits_t *)node;
-
-    return ((cur->start < limits->end) && (limits->start < cur->end));
-}
-
-static int _limits_cmp(clist_node_t *a, clist_node_t *b)
+/**
+ * @brief   Removes @p node from the limits of @p rbuf and returns it to the
+ *          pool
+ *
+ * @param[in,out] rbuf  A reassembly buffer entry.
+ * @param[in] prev      The predecessor of @p node in the sorted limits, NULL if
+ *                      @p node is the first element.
+ * @param[in] node      The limits to remove.
+ */
+static void _limits_remove(gnrc_ipv6_ext_frag_rbuf_t *rbuf, clist_node_t *prev,
+                           clist_node_t *node)
 {
-    gnrc_ipv6_ext_frag_limits_t *al = (gnrc_ipv6_ext_frag_limits_t *)a;
-    gnrc_ipv6_ext_frag_limits_t *bl = (gnrc_ipv6_ext_frag_limits_t *)b;
-
-    return (int)al->start - (int)bl->start;
+    if (node->next == node) {
+        /* node is the only element */
+        rbuf->limits.next = NULL;
+    }
+    else {
+        if (prev == NULL) {
+            /* clist: the predecessor of the first element is the last */
+            prev = rbuf->limits.next;
+        }
+        prev->next = node->next;
+        if (rbuf->limits.next == node) {
+            rbuf->limits.next = prev;
+        }
+    }
+    clist_rpush(&_free_limits, node);
 }
 
 static _limits_res_t _overlaps(gnrc_ipv6_ext_frag_rbuf_t *rbuf,
                                unsigned offset, unsigned pkt_len)
 {
-    _check_limits_t limits = { .start = offset >> 3U,
-                               .end = (offset + pkt_len) >> 3U };
+    uint16_t start = offset >> 3U;
+    uint16_t end = (offset + pkt_len) >> 3U;
+    clist_node_t *prev = NULL;
+    clist_node_t *node = (rbuf->limits.next) ? rbuf->limits.next->next : NULL;
     gnrc_ipv6_ext_frag_limits_t *res;
 
-    if (limits.start == limits.end) {
+    if (start == end) {
         /* might happen with last fragment */
-        limits.end++;
+        end++;
     }
-    res = (gnrc_ipv6_ext_frag_limits_t *)clist_foreach(&rbuf->limits,
-                                                       _check_overlap,
-                                                       &limits);
-    if (res == NULL) {
-        res = (gnrc_ipv6_ext_frag_limits_t *)clist_lpop(&_free_limits);
-        if (res != NULL) {
-            res->start = limits.start;
-            res->end = limits.end;
-            clist_rpush(&rbuf->limits, (clist_node_t *)res);
-            clist_sort(&rbuf->limits, _limits_cmp);
-            return FRAG_LIMITS_NEW;
+    /* the limits are kept sorted and disjoint; merge every range that
+     * overlaps or touches the new one, so in-order reception keeps only a
+     * single range per datagram */
+    while (node != NULL) {
+        gnrc_ipv6_ext_frag_limits_t *cur = (gnrc_ipv6_ext_frag_limits_t *)node;
+        clist_node_t *next = (node == rbuf->limits.next) ? NULL : node->next;
+
+        if (cur->end < start) {
+            prev = node;
+        }
+        else if (cur->start > end) {
+            break;
+        }
+        else if ((cur->start <= start) && (end <= cur->end)) {
+            return FRAG_LIMITS_DUPLICATE;
         }
         else {
-            return FRAG_LIMITS_FULL;
+            start = MIN(start, cur->start);
+            end = MAX(end, cur->end);
+            _limits_remove(rbuf, prev, node);
         }
+        node = next;
     }
-    else if ((res->start == limits.start) && (res->end == limits.end)) {
-        return FRAG_LIMITS_DUPLICATE;
+    res = (gnrc_ipv6_ext_frag_limits_t *)clist_lpop(&_free_limits);
+    if (res == NULL) {
+        return FRAG_LIMITS_FULL;
+    }
+    res->start = start;
+    res->end = end;
+    if (prev == NULL) {
+        clist_lpush(&rbuf->limits, (clist_node_t *)res);
     }
     else {
-        return FRAG_LIMITS_NEW;
+        res->next = (gnrc_ipv6_ext_frag_limits_t *)prev->next;
+        prev->next = (clist_node_t *)res;
+        if (rbuf->limits.next == prev) {
+            rbuf->limits.next = (clist_node_t *)res;
+        }
     }
+    rbuf->frags++;
+    return FRAG_LIMITS_NEW;
 }
 
 static inline void _set_nh(gnrc_pktsnip_t *hdr_snip, uint8_t nh)
@@ -711,24 +811,17 @@ static gnrc_pktsnip_t *_completed(gnrc_ipv6_ext_frag_rbuf_t *rbuf)
     /* clist: first element is second element ;-) (from next of head) */
     gnrc_ipv6_ext_frag_limits_t *ptr =
             (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next->next;
-    if (rbuf->last && (ptr->start == 0)) {
+    /* adjacent limits are merged, so without gaps there is only one left */
+    if (rbuf->last && (ptr->start == 0) &&
+        (((clist_node_t *)ptr) == rbuf->limits.next)) {
         gnrc_pktsnip_t *res = NULL;
 
-        /* last and first fragment were received, so check if everything
-         * in-between is there */
-        do {
-            gnrc_ipv6_ext_frag_limits_t *next = ptr->next;
-            if (ptr->end < next->start) {
-                return NULL;
-            }
-            ptr = next;
-        } while (((clist_node_t *)ptr) != rbuf->limits.next);
         res = rbuf->pkt;
         /* rewrite length */
         rbuf->ipv6->len = byteorder_htons(rbuf->pkt_len);
         rbuf->pkt = NULL;
         if (IS_USED(MODULE_GNRC_IPV6_EXT_FRAG_STATS)) {
-            _stats.fragments += clist_count(&rbuf->limits);
+            _stats.fragments += rbuf->frags;
             _stats.datagrams++;
         }
         gnrc_ipv6_ext_frag_rbuf_free(rbuf);
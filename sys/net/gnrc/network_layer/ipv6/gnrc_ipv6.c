@@ -32,6 +32,7 @@
 #include "net/gnrc/netif/internal.h"
 #include "net/gnrc/ipv6/whitelist.h"
 #include "net/gnrc/ipv6/blacklist.h"
+#include "net/gnrc/udp.h"
 
 #ifdef MODULE_GNRC_IPV6_EXT_FRAG
 #include "net/gnrc/ipv6/ext/frag.h"
@@ -740,6 +741,25 @@ static inline bool _pkt_not_for_me(gnrc_netif_t **netif, ipv6_hdr_t *hdr)
     }
 }
 
+static inline void _count_rx(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt,
+                             gnrc_pktsnip_t *netif_hdr)
+{
+#ifdef MODULE_NETSTATS_IPV6
+    assert(netif != NULL);
+    /* This is read from the netif thread. To prevent data corruptions, we
+     * have to guarantee mutually exclusive access */
+    unsigned irq_state = irq_disable();
+    netstats_t *stats = &netif->ipv6.stats;
+    stats->rx_count++;
+    stats->rx_bytes += (gnrc_pkt_len(pkt) - netif_hdr->size);
+    irq_restore(irq_state);
+#else
+    (void)netif;
+    (void)pkt;
+    (void)netif_hdr;
+#endif
+}
+
 static void _receive(gnrc_pktsnip_t *pkt)
 {
     gnrc_netif_t *netif = NULL;
@@ -753,16 +773,7 @@ static void _receive(gnrc_pktsnip_t *pkt)
 
     if (netif_hdr != NULL) {
         netif = gnrc_netif_hdr_get_netif(netif_hdr->data);
-#ifdef MODULE_NETSTATS_IPV6
-        assert(netif != NULL);
-        /* This is read from the netif thread. To prevent data corruptions, we
-         * have to guarantee mutually exclusive access */
-        unsigned irq_state = irq_disable();
-        netstats_t *stats = &netif->ipv6.stats;
-        stats->rx_count++;
-        stats->rx_bytes += (gnrc_pkt_len(pkt) - netif_hdr->size);
-        irq_restore(irq_state);
-#endif
+        _count_rx(netif, pkt, netif_hdr);
     }
 
     if ((pkt->data == NULL) || (pkt->size < sizeof(ipv6_hdr_t)) ||
@@ -920,4 +931,98 @@ static void _receive(gnrc_pktsnip_t *pkt)
     _demux(netif, pkt, first_nh);
 }
 
+#if IS_USED(MODULE_GNRC_UDP_FASTPATH)
+/* Checks without side effects whether _receive() would hand @p pkt to the
+ * UDP thread and nobody else, i.e. whether it can skip the IPv6 thread.
+ * The stack of the calling thread is not checked: only the default netif
+ * stack and the 6LoWPAN stack include GNRC_UDP_FASTPATH_EXTRA_STACKSIZE,
+ * netifs with a driver-provided stack size must reserve it themselves. */
+static bool _fastpath_applicable(gnrc_pktsnip_t *pkt, gnrc_netif_t **netif)
+{
+    ipv6_hdr_t *hdr = pkt->data;
+
+    if ((hdr == NULL) ||
+        (pkt->size < (sizeof(ipv6_hdr_t) + sizeof(udp_hdr_t))) ||
+        !ipv6_hdr_is(hdr) || (hdr->hl == 0) || (hdr->nh != PROTNUM_UDP)) {
+        /* errors and extension headers (e.g. fragments) are handled by the
+         * IPv6 thread */
+        return false;
+    }
+
+    uint16_t ipv6_len = byteorder_ntohs(hdr->len);
+
+    if ((ipv6_len < sizeof(udp_hdr_t)) ||
+        (ipv6_len > (pkt->size - sizeof(ipv6_hdr_t)))) {
+        return false;
+    }
+#ifdef MODULE_GNRC_IPV6_WHITELIST
+    if (!gnrc_ipv6_whitelisted(&hdr->src)) {
+        return false;
+    }
+#endif
+#ifdef MODULE_GNRC_IPV6_BLACKLIST
+    if (gnrc_ipv6_blacklisted(&hdr->src)) {
+        return false;
+    }
+#endif
+    if (_pkt_not_for_me(netif, hdr)) {
+        return false;
+    }
+
+    udp_hdr_t *udp = (udp_hdr_t *)(hdr + 1);
+
+    /* Other subscribers (e.g. gnrc_pktdump) would miss the packet and
+     * unreachable ports need an ICMPv6 error, leave both to the threads */
+    return (gnrc_netreg_num(GNRC_NETTYPE_IPV6, GNRC_NETREG_DEMUX_CTX_ALL) == 1) &&
+           (gnrc_netreg_num(GNRC_NETTYPE_IPV6, PROTNUM_UDP) == 0) &&
+           (gnrc_netreg_num(GNRC_NETTYPE_UDP, GNRC_NETREG_DEMUX_CTX_ALL) == 1) &&
+           (gnrc_netreg_num(GNRC_NETTYPE_UDP, byteorder_ntohs(udp->dst_port)) > 0);
+}
+
+bool gnrc_ipv6_fastpath_recv(gnrc_pktsnip_t *pkt)
+{
+    gnrc_netif_t *netif = NULL;
+    gnrc_pktsnip_t *ipv6, *netif_hdr;
+
+    assert(pkt != NULL);
+
+    netif_hdr = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_NETIF);
+    if (netif_hdr != NULL) {
+        netif = gnrc_netif_hdr_get_netif(netif_hdr->data);
+    }
+    if (!_fastpath_applicable(pkt, &netif)) {
+        return false;
+    }
+    if (netif_hdr != NULL) {
+        _count_rx(gnrc_netif_hdr_get_netif(netif_hdr->data), pkt, netif_hdr);
+    }
+    DEBUG("ipv6: fast path for UDP packet\n");
+
+    /* same as in _receive() */
+    ipv6 = gnrc_pktbuf_start_write(pkt);
+    if (ipv6 == NULL) {
+        DEBUG("ipv6: unable to get write access to packet, drop it\n");
+        gnrc_pktbuf_release(pkt);
+        return true;
+    }
+    pkt = ipv6;
+    ipv6 = gnrc_pktbuf_mark(pkt, sizeof(ipv6_hdr_t), GNRC_NETTYPE_IPV6);
+    if (ipv6 == NULL) {
+        DEBUG("ipv6: error marking IPv6 header, dropping packet\n");
+        gnrc_pktbuf_release(pkt);
+        return true;
+    }
+
+    uint16_t ipv6_len = byteorder_ntohs(((ipv6_hdr_t *)ipv6->data)->len);
+
+    /* remove padding of lower layers */
+    if (ipv6_len < pkt->size) {
+        gnrc_pktbuf_realloc_data(pkt, ipv6_len);
+    }
+    pkt->type = GNRC_NETTYPE_UDP;
+    gnrc_udp_fastpath_recv(pkt);
+    return true;
+}
+#endif /* IS_USED(MODULE_GNRC_UDP_FASTPATH) */
+
 /** @} */
@@ -29,6 +29,7 @@
 
 #include "_nib-internal.h"
 #include "_nib-router.h"
+#include "_nib-trie.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -44,6 +45,22 @@ static _nib_dr_entry_t _def_routers[CONFIG_GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
 static _nib_abr_entry_t _abrs[CONFIG_GNRC_IPV6_NIB_ABR_NUMOF];
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+#define _NC_HASH_SIZE   (2 * CONFIG_GNRC_IPV6_NIB_NUMOF)
+
+#if CONFIG_GNRC_IPV6_NIB_NUMOF < UINT8_MAX
+typedef uint8_t _nc_hash_slot_t;
+#else
+typedef uint16_t _nc_hash_slot_t;
+#endif
+
+/* open-addressing (linear probing) hash index over _nodes by IPv6 address:
+ * each slot holds the index into _nodes + 1, 0 marks a free slot. An entry is
+ * in the index, iff its address is not the unspecified address */
+static _nc_hash_slot_t _nc_hash[_NC_HASH_SIZE];
+static gnrc_ipv6_nib_nc_hash_stats_t _nc_hash_stats;
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
 static rmutex_t _nib_mutex = RMUTEX_INIT;
 
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
@@ -65,7 +82,12 @@ void _nib_init(void)
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C)
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* CONFIG_GNRC_IPV6_NIB_MULTIHOP_P6C */
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    memset(_nc_hash, 0, sizeof(_nc_hash));
+    memset(&_nc_hash_stats, 0, sizeof(_nc_hash_stats));
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
 #endif  /* TEST_SUITES */
+    _nib_trie_init();
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
 }
@@ -87,6 +109,130 @@ static inline bool _addr_equals(const ipv6_addr_t *addr,
            (ipv6_addr_equal(addr, &node->ipv6));
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+static unsigned _nc_hash_home(const ipv6_addr_t *addr)
+{
+    uint32_t h = 0;
+
+    /* multiplicative hashing, so all bytes of the address affect the slot */
+    for (unsigned i = 0; i < ARRAY_SIZE(addr->u32); i++) {
+        h = (h ^ addr->u32[i].u32) * 0x9e3779b1U;
+    }
+    return (h ^ (h >> 16)) % _NC_HASH_SIZE;
+}
+
+static inline unsigned _nc_hash_next(unsigned slot)
+{
+    return ((slot + 1) < _NC_HASH_SIZE) ? (slot + 1) : 0;
+}
+
+static inline unsigned _idx_nodes(const _nib_onl_entry_t *node)
+{
+    return (node - _nodes);
+}
+
+static void _nc_hash_add(const _nib_onl_entry_t *node)
+{
+    unsigned slot;
+
+    if (ipv6_addr_is_unspecified(&node->ipv6)) {
+        return;
+    }
+    /* there are always free slots, as there are more slots than _nodes */
+    for (slot = _nc_hash_home(&node->ipv6); _nc_hash[slot] != 0;
+         slot = _nc_hash_next(slot)) {
+        if (_nc_hash[slot] == (_idx_nodes(node) + 1)) {
+            /* already in index */
+            return;
+        }
+    }
+    _nc_hash[slot] = _idx_nodes(node) + 1;
+    _nc_hash_stats.entries++;
+}
+
+void _nib_onl_hash_remove(const _nib_onl_entry_t *node)
+{
+    unsigned slot;
+
+    if (ipv6_addr_is_unspecified(&node->ipv6)) {
+        return;
+    }
+    for (slot = _nc_hash_home(&node->ipv6);
+         _nc_hash[slot] != (_idx_nodes(node) + 1);
+         slot = _nc_hash_next(slot)) {
+        if (_nc_hash[slot] == 0) {
+            /* not in index */
+            return;
+        }
+    }
+    _nc_hash_stats.entries--;
+    /* backward shift deletion: move up entries of the following cluster that
+     * would otherwise not be reachable from their home slot anymore */
+    for (unsigned next = _nc_hash_next(slot); _nc_hash[next] != 0;
+         next = _nc_hash_next(next)) {
+        unsigned home = _nc_hash_home(&_nodes[_nc_hash[next] - 1].ipv6);
+
+        if ((slot < next) ? ((home <= slot) || (home > next))
+                          : ((home <= slot) && (home > next))) {
+            _nc_hash[slot] = _nc_hash[next];
+            slot = next;
+        }
+    }
+    _nc_hash[slot] = 0;
+}
+
+void _nib_onl_hash_stats(gnrc_ipv6_nib_nc_hash_stats_t *stats, bool reset)
+{
+    *stats = _nc_hash_stats;
+    if (reset) {
+        _nc_hash_stats.lookups = 0;
+        _nc_hash_stats.probes = 0;
+        _nc_hash_stats.max_probes = 0;
+    }
+}
+
+/* returns the first entry in the index with address addr for which match
+ * returns true */
+static _nib_onl_entry_t *_nc_hash_get(const ipv6_addr_t *addr, unsigned iface,
+                                      bool (*match)(const _nib_onl_entry_t *,
+                                                    unsigned))
+{
+    _nib_onl_entry_t *res = NULL;
+    unsigned probes = 0;
+
+    for (unsigned slot = _nc_hash_home(addr); _nc_hash[slot] != 0;
+         slot = _nc_hash_next(slot)) {
+        _nib_onl_entry_t *node = &_nodes[_nc_hash[slot] - 1];
+
+        probes++;
+        if (ipv6_addr_equal(&node->ipv6, addr) && match(node, iface)) {
+            res = node;
+            break;
+        }
+    }
+    _nc_hash_stats.lookups++;
+    _nc_hash_stats.probes += probes;
+    if (probes > _nc_hash_stats.max_probes) {
+        _nc_hash_stats.max_probes = probes;
+    }
+    return res;
+}
+
+static bool _nc_hash_match_alloc(const _nib_onl_entry_t *node, unsigned iface)
+{
+    return (_nib_onl_get_if(node) == iface);
+}
+
+static bool _nc_hash_match_get(const _nib_onl_entry_t *node, unsigned iface)
+{
+    return (node->mode != _EMPTY) &&
+           ((_nib_onl_get_if(node) == 0) || (iface == 0) ||
+            (_nib_onl_get_if(node) == iface));
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+#define _nc_hash_add(node)  (void)node
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
 {
     _nib_onl_entry_t *node = NULL;
@@ -94,6 +240,15 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
     DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
           (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
                                                      sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    if ((addr != NULL) && !ipv6_addr_is_unspecified(addr) &&
+        (node = _nc_hash_get(addr, iface, _nc_hash_match_alloc)) != NULL) {
+        /* exact match */
+        DEBUG("  %p is an exact match\n", (void *)node);
+        _override_node(addr, iface, node);
+        return node;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
@@ -219,6 +374,14 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    if (!ipv6_addr_is_unspecified(addr)) {
+        _nib_onl_entry_t *node = _nc_hash_get(addr, iface, _nc_hash_match_get);
+
+        DEBUG("  %s\n", (node) ? "Found" : "No suitable entry found");
+        return node;
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
     for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
 
@@ -492,8 +655,10 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
             (ipv6_addr_match_prefix(&tmp->pfx, pfx) >= pfx_len)) {  /* the prefix matches */
             /* exact match (or next hop address was previously unset) */
             DEBUG("  %p is an exact match\n", (void *)tmp);
-            if (next_hop != NULL) {
+            if ((next_hop != NULL) && !ipv6_addr_equal(next_hop, &tmp_node->ipv6)) {
+                _nib_onl_hash_remove(tmp_node);
                 memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+                _nc_hash_add(tmp_node);
             }
             tmp->next_hop->mode |= _DST;
             return tmp;
@@ -514,6 +679,7 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+        _nib_trie_add(dst);
     }
     return dst;
 }
@@ -550,6 +716,7 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+        _nib_trie_remove(dst);
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
 }
@@ -573,10 +740,40 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
     return (entry >= _dsts) && _in_dsts(entry);
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+_nib_offl_entry_t *_nib_offl_get_same_pfx(const _nib_offl_entry_t *dst)
+{
+    for (_nib_offl_entry_t *ptr = _dsts; _in_dsts(ptr); ptr++) {
+        if ((ptr != dst) && (ptr->next_hop != NULL) &&
+            (ptr->pfx_len == dst->pfx_len) &&
+            (ipv6_addr_match_prefix(&ptr->pfx, &dst->pfx) >= dst->pfx_len)) {
+            return ptr;
+        }
+    }
+    return NULL;
+}
+
+_nib_offl_entry_t *_nib_offl_get_used_same_pfx(const _nib_offl_entry_t *dst)
+{
+    for (_nib_offl_entry_t *ptr = _dsts; _in_dsts(ptr); ptr++) {
+        if ((ptr->mode != _EMPTY) && (ptr->next_hop != NULL) &&
+            (ptr->pfx_len == dst->pfx_len) &&
+            (ipv6_addr_match_prefix(&ptr->pfx, &dst->pfx) >= dst->pfx_len)) {
+            return ptr;
+        }
+    }
+    return NULL;
+}
+
+static inline _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
+{
+    return _nib_trie_get_match(dst);
+}
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
 static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
 {
     _nib_offl_entry_t *res = NULL;
-    uint8_t best_match = 0;
+    uint8_t best_len = 0;
 
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
@@ -592,15 +789,19 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
                   ipv6_addr_to_str(addr_str, &entry->next_hop->ipv6,
                                    sizeof(addr_str)),
                   _nib_onl_get_if(entry->next_hop), match);
-            if ((match > best_match) && (match >= entry->pfx_len)) {
-                DEBUG("nib: best match (%u bits)\n", match);
+            /* the longest matching prefix wins, not the longest match:
+             * an address can match several nested prefixes completely */
+            if ((match > 0) && (match >= entry->pfx_len) &&
+                ((res == NULL) || (entry->pfx_len > best_len))) {
+                DEBUG("nib: best match (%u bits)\n", entry->pfx_len);
                 res = entry;
-                best_match = match;
+                best_len = entry->pfx_len;
             }
         }
     }
     return res;
 }
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
 {
@@ -857,8 +1058,10 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node)
 {
     _nib_onl_clear(node);
-    if (addr != NULL) {
+    if ((addr != NULL) && !ipv6_addr_equal(addr, &node->ipv6)) {
+        _nib_onl_hash_remove(node);
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
+        _nc_hash_add(node);
     }
     _nib_onl_set_if(node, iface);
 }
@@ -311,6 +311,32 @@ static inline void _nib_onl_set_if(_nib_onl_entry_t *node, unsigned iface)
  */
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH) || defined(DOXYGEN)
+/**
+ * @brief   Removes an on-link entry from the neighbor cache hash index
+ *
+ * Must be called before _nib_onl_entry_t::ipv6 of @p node is overwritten.
+ * Nothing happens if @p node is not in the index.
+ *
+ * @param[in] node  An on-link entry.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_NC_HASH.
+ */
+void _nib_onl_hash_remove(const _nib_onl_entry_t *node);
+
+/**
+ * @brief   Gets the probe length statistics of the neighbor cache hash index
+ *
+ * @param[out] stats    The statistics.
+ * @param[in] reset     Reset the look-up statistics after reading them.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_NC_HASH.
+ */
+void _nib_onl_hash_stats(gnrc_ipv6_nib_nc_hash_stats_t *stats, bool reset);
+#else   /* CONFIG_GNRC_IPV6_NIB_NC_HASH || defined(DOXYGEN) */
+#define _nib_onl_hash_remove(node)  (void)node
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH || defined(DOXYGEN) */
+
 /**
  * @brief   Clears out a NIB entry (on-link version)
  *
@@ -322,6 +348,7 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
     if (node->mode == _EMPTY) {
+        _nib_onl_hash_remove(node);
         memset(node, 0, sizeof(_nib_onl_entry_t));
         return true;
     }
@@ -565,6 +592,38 @@ _nib_offl_entry_t *_nib_offl_iter(const _nib_offl_entry_t *last);
  */
 bool _nib_offl_is_entry(const _nib_offl_entry_t *entry);
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE) || defined(DOXYGEN)
+/**
+ * @brief   Gets the first other allocated off-link entry with the same prefix
+ *          as @p dst
+ *
+ * @param[in] dst   An off-link entry.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE.
+ *
+ * @return  The first off-link entry (other than @p dst) with
+ *          _nib_offl_entry_t::pfx and _nib_offl_entry_t::pfx_len equal to
+ *          those of @p dst.
+ * @return  NULL, if there is no such entry.
+ */
+_nib_offl_entry_t *_nib_offl_get_same_pfx(const _nib_offl_entry_t *dst);
+
+/**
+ * @brief   Gets the first off-link entry in use with the same prefix as @p dst
+ *
+ * @param[in] dst   An off-link entry.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE.
+ *
+ * @return  The first off-link entry (possibly @p dst itself) with
+ *          _nib_offl_entry_t::mode not @ref _EMPTY and
+ *          _nib_offl_entry_t::pfx and _nib_offl_entry_t::pfx_len equal to
+ *          those of @p dst.
+ * @return  NULL, if there is no such entry.
+ */
+_nib_offl_entry_t *_nib_offl_get_used_same_pfx(const _nib_offl_entry_t *dst);
+#endif
+
 /**
  * @brief   Helper function for view-level add-functions below
  *
@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+
+#include <assert.h>
+#include <string.h>
+#include <kernel_defines.h>
+
+#include "_nib-trie.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE)
+
+/**
+ * @brief   Node of the longest-prefix-match trie
+ */
+typedef struct _trie_node {
+    struct _trie_node *child[2];    /**< children, indexed by bit _trie_node::len */
+    _nib_offl_entry_t *entry;       /**< first off-link entry with this prefix,
+                                     *   NULL for branching nodes */
+    uint16_t entries;               /**< number of off-link entries with this
+                                     *   prefix */
+    uint8_t len;                    /**< prefix length of this node */
+} _trie_node_t;
+
+/* n prefixes need at most n - 1 branching nodes */
+static _trie_node_t _trie_nodes[2 * CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF];
+static _trie_node_t *_trie_root;
+static _trie_node_t *_trie_free;
+
+static char addr_str[IPV6_ADDR_MAX_STR_LEN];
+
+static inline unsigned _bit(const ipv6_addr_t *addr, unsigned pos)
+{
+    return (addr->u8[pos >> 3] >> (7 - (pos & 0x7))) & 0x1;
+}
+
+static _trie_node_t *_node_alloc(uint8_t len, _nib_offl_entry_t *entry)
+{
+    _trie_node_t *node = _trie_free;
+
+    /* pool is sized so that it can never run dry */
+    assert(node != NULL);
+    _trie_free = node->child[0];
+    node->child[0] = NULL;
+    node->child[1] = NULL;
+    node->entry = entry;
+    node->entries = (entry != NULL);
+    node->len = len;
+    return node;
+}
+
+static void _node_free(_trie_node_t *node)
+{
+    node->child[0] = _trie_free;
+    _trie_free = node;
+}
+
+void _nib_trie_init(void)
+{
+    _trie_root = NULL;
+    _trie_free = NULL;
+    for (unsigned i = 0; i < ARRAY_SIZE(_trie_nodes); i++) {
+        _node_free(&_trie_nodes[i]);
+    }
+}
+
+void _nib_trie_add(_nib_offl_entry_t *dst)
+{
+    const ipv6_addr_t *pfx = &dst->pfx;
+    const uint8_t pfx_len = dst->pfx_len;
+    _trie_node_t **ptr = &_trie_root;
+    _trie_node_t *node = _trie_root;
+    uint8_t common;
+
+    assert((pfx_len > 0) && (pfx_len <= IPV6_ADDR_BIT_LEN));
+    DEBUG("nib: Adding %s/%u to off-link trie\n",
+          ipv6_addr_to_str(addr_str, pfx, sizeof(addr_str)), pfx_len);
+    if (node == NULL) {
+        _trie_root = _node_alloc(pfx_len, dst);
+        return;
+    }
+    /* find an entry sharing the longest possible prefix with pfx */
+    while (node->len < pfx_len) {
+        _trie_node_t *next = node->child[_bit(pfx, node->len)];
+
+        if (next == NULL) {
+            break;
+        }
+        node = next;
+    }
+    while (node->entry == NULL) {
+        /* branching nodes always have two children */
+        node = node->child[0];
+    }
+    common = ipv6_addr_match_prefix(pfx, &node->entry->pfx);
+    if (common > pfx_len) {
+        common = pfx_len;
+    }
+    /* find position of new node */
+    while (((node = *ptr) != NULL) &&
+           ((node->len < common) || ((node->len == common) && (common < pfx_len)))) {
+        ptr = &node->child[_bit(pfx, node->len)];
+    }
+    if (node == NULL) {
+        *ptr = _node_alloc(pfx_len, dst);
+    }
+    else if (node->len == common) {
+        /* node has the same prefix (common == pfx_len, see loop above) */
+        if (node->entry == NULL) {
+            node->entry = dst;
+        }
+        else if (dst < node->entry) {
+            /* keep first entry in array for stable results */
+            node->entry = dst;
+        }
+        node->entries++;
+    }
+    else {
+        /* node->len > common: the new prefix diverges from (or is a prefix
+         * of) node's prefix at bit common */
+        _trie_node_t *node_key = node;
+        unsigned node_bit;
+
+        while (node_key->entry == NULL) {
+            node_key = node_key->child[0];
+        }
+        node_bit = _bit(&node_key->entry->pfx, common);
+        if (common == pfx_len) {
+            *ptr = _node_alloc(pfx_len, dst);
+        }
+        else {
+            *ptr = _node_alloc(common, NULL);
+            (*ptr)->child[!node_bit] = _node_alloc(pfx_len, dst);
+        }
+        (*ptr)->child[node_bit] = node;
+    }
+}
+
+void _nib_trie_remove(_nib_offl_entry_t *dst)
+{
+    const ipv6_addr_t *pfx = &dst->pfx;
+    _trie_node_t **parent = NULL;
+    _trie_node_t **ptr = &_trie_root;
+    _trie_node_t *node;
+
+    DEBUG("nib: Removing %s/%u from off-link trie\n",
+          ipv6_addr_to_str(addr_str, pfx, sizeof(addr_str)), dst->pfx_len);
+    while (((node = *ptr) != NULL) && (node->len < dst->pfx_len)) {
+        parent = ptr;
+        ptr = &node->child[_bit(pfx, node->len)];
+    }
+    if ((node == NULL) || (node->len != dst->pfx_len) || (node->entry == NULL) ||
+        (ipv6_addr_match_prefix(&node->entry->pfx, pfx) < node->len)) {
+        DEBUG("nib: %p not in off-link trie\n", (void *)dst);
+        return;
+    }
+    if (--node->entries > 0) {
+        if (node->entry == dst) {
+            node->entry = _nib_offl_get_same_pfx(dst);
+            assert(node->entry != NULL);
+        }
+        return;
+    }
+    assert(node->entry == dst);
+    node->entry = NULL;
+    if ((node->child[0] != NULL) && (node->child[1] != NULL)) {
+        /* node becomes a branching node */
+        return;
+    }
+    *ptr = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+    _node_free(node);
+    if ((*ptr == NULL) && (parent != NULL) && ((*parent)->entry == NULL)) {
+        /* parent is a branching node with only one child left => merge */
+        node = *parent;
+        *parent = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+        _node_free(node);
+    }
+}
+
+_nib_offl_entry_t *_nib_trie_get_match(const ipv6_addr_t *dst)
+{
+    _nib_offl_entry_t *res = NULL;
+    _trie_node_t *node = _trie_root;
+
+    DEBUG("nib: get match for destination %s from off-link trie\n",
+          ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+    while (node != NULL) {
+        if (node->entry != NULL) {
+            if (ipv6_addr_match_prefix(&node->entry->pfx, dst) < node->len) {
+                /* all prefixes further down extend this one */
+                break;
+            }
+            if (node->entry->mode != _EMPTY) {
+                res = node->entry;
+            }
+            else if (node->entries > 1) {
+                /* the representative entry was cleared without being
+                 * removed from the trie (yet), but another entry with the
+                 * same prefix may still be in use. If none is, stay with the
+                 * last valid ancestor */
+                _nib_offl_entry_t *entry = _nib_offl_get_used_same_pfx(node->entry);
+
+                if (entry != NULL) {
+                    res = entry;
+                }
+            }
+        }
+        if (node->len >= IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+        node = node->child[_bit(dst, node->len)];
+    }
+    DEBUG("nib: best match %s/%u\n",
+          (res == NULL) ? "(nil)" : ipv6_addr_to_str(addr_str, &res->pfx,
+                                                     sizeof(addr_str)),
+          (res == NULL) ? 0 : res->pfx_len);
+    return res;
+}
+
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+typedef int dont_be_pedantic;
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE */
+
+/** @} */
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_ipv6_nib
+ * @{
+ *
+ * @file
+ * @brief   Longest-prefix-match index for the off-link entries of the NIB
+ * @see     @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE
+ *
+ * The index is a path-compressed binary trie (PATRICIA trie) over the
+ * prefixes of the off-link entries. Only nodes that carry an entry need to be
+ * compared to the destination address during look-up, so branching nodes
+ * just store the bit position they branch on.
+ */
+#ifndef PRIV_NIB_TRIE_H
+#define PRIV_NIB_TRIE_H
+
+#include <kernel_defines.h>
+
+#include "net/gnrc/ipv6/nib/conf.h"
+#include "net/ipv6/addr.h"
+
+#include "_nib-internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE) || defined(DOXYGEN)
+/**
+ * @brief   Resets the longest-prefix-match index
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE.
+ */
+void _nib_trie_init(void);
+
+/**
+ * @brief   Adds an off-link entry to the longest-prefix-match index
+ *
+ * @pre     `(dst != NULL) && (dst->pfx_len > 0)`
+ * @pre     @p dst is not already in the index.
+ *
+ * @param[in] dst   An off-link entry with _nib_offl_entry_t::pfx and
+ *                  _nib_offl_entry_t::pfx_len set.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE.
+ */
+void _nib_trie_add(_nib_offl_entry_t *dst);
+
+/**
+ * @brief   Removes an off-link entry from the longest-prefix-match index
+ *
+ * @pre     @p dst was added with @ref _nib_trie_add() and its prefix was not
+ *          changed since.
+ *
+ * @param[in] dst   An off-link entry.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE.
+ */
+void _nib_trie_remove(_nib_offl_entry_t *dst);
+
+/**
+ * @brief   Gets the off-link entry with the longest prefix matching @p dst
+ *
+ * If multiple entries share the longest matching prefix, the one first in
+ * the off-link entry array is returned.
+ *
+ * @param[in] dst   A destination address.
+ *
+ * @note    Only available if @ref CONFIG_GNRC_IPV6_NIB_OFFL_TRIE.
+ *
+ * @return  The best matching off-link entry.
+ * @return  NULL, if no prefix in the index matches @p dst.
+ */
+_nib_offl_entry_t *_nib_trie_get_match(const ipv6_addr_t *dst);
+#else   /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE || defined(DOXYGEN) */
+#define _nib_trie_init()            (void)0
+#define _nib_trie_add(dst)          (void)dst
+#define _nib_trie_remove(dst)       (void)dst
+#endif  /* CONFIG_GNRC_IPV6_NIB_OFFL_TRIE || defined(DOXYGEN) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PRIV_NIB_TRIE_H */
+/** @} */
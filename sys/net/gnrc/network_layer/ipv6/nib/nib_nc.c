@@ -109,6 +109,17 @@ bool gnrc_ipv6_nib_nc_iter(unsigned iface, void **state,
     return (*state != NULL);
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+void gnrc_ipv6_nib_nc_get_hash_stats(gnrc_ipv6_nib_nc_hash_stats_t *stats,
+                                     bool reset)
+{
+    assert(stats != NULL);
+    _nib_acquire();
+    _nib_onl_hash_stats(stats, reset);
+    _nib_release();
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+
 #if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_ARSM)
 static const char *_nud_str[] = {
     [GNRC_IPV6_NIB_NC_INFO_NUD_STATE_UNMANAGED]     = "-",
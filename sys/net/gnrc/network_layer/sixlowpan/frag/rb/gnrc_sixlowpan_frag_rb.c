@@ -59,10 +59,37 @@
 #endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_MINFWD) */
 #endif
 
+#ifndef RBUF_HASH_SIZE
+#define RBUF_HASH_SIZE (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE)
+#endif
+
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE < UINT8_MAX,
+              "CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE too large");
+
 static gnrc_sixlowpan_frag_rb_int_t rbuf_int[RBUF_INT_SIZE];
 
 static gnrc_sixlowpan_frag_rb_t rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
 
+/* The index and the expiry list below store the position in rbuf + 1, so 0
+ * marks the end of a list. The index hashes entries in use by (source,
+ * destination, tag), the expiry list keeps them sorted by arrival, which,
+ * with a fixed timeout, is the order in which they expire. */
+static uint8_t _hash_head[RBUF_HASH_SIZE];
+static uint8_t _hash_next[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+static uint8_t _exp_head;
+static uint8_t _exp_tail;
+static uint8_t _exp_prev[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+static uint8_t _exp_next[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+/* Entries released after use are kept in a free list that is chained by
+ * _exp_next, as they are not in the expiry list. Entries at and behind
+ * _free_unused were never used, so the free list needs no initialization. */
+static uint8_t _free_head;
+static uint8_t _free_unused;
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+/* arrival of the first fragment, to determine the reassembly latency */
+static uint32_t _first_arrival[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE];
+#endif
+
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
 static xtimer_t _gc_timer;
@@ -87,6 +114,19 @@ static int _rbuf_get(const void *src, size_t src_len,
 /* gets an entry only by link-layer information and tag */
 static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_hdr,
                                                   uint16_t tag);
+/* gets an entry in use from the hash index, size < 0 matches any size */
+static gnrc_sixlowpan_frag_rb_t *_rbuf_lookup(const uint8_t *src, size_t src_len,
+                                              const uint8_t *dst, size_t dst_len,
+                                              uint16_t tag, int size);
+/* adds an entry to the hash index and the expiry list */
+static void _rbuf_link(unsigned idx);
+/* removes an entry from the hash index and the expiry list */
+static void _rbuf_unlink(unsigned idx);
+/* moves an entry to its position in the expiry list after its arrival
+ * changed */
+static void _expiry_update(unsigned idx);
+/* releases the packet of an entry */
+static void _gc_pkt(gnrc_sixlowpan_frag_rb_t *rbuf);
 /* internal add to repeat add when fragments overlapped */
 static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                      size_t offset, unsigned page);
@@ -184,25 +224,179 @@ static gnrc_sixlowpan_frag_rb_t *_rbuf_get_by_tag(const gnrc_netif_hdr_t *netif_
                                                   uint16_t tag)
 {
     assert(netif_hdr != NULL);
-    const uint8_t *src = gnrc_netif_hdr_get_src_addr(netif_hdr);
-    const uint8_t *dst = gnrc_netif_hdr_get_dst_addr(netif_hdr);
-    const uint8_t src_len = netif_hdr->src_l2addr_len;
-    const uint8_t dst_len = netif_hdr->dst_l2addr_len;
+    return _rbuf_lookup(gnrc_netif_hdr_get_src_addr(netif_hdr),
+                        netif_hdr->src_l2addr_len,
+                        gnrc_netif_hdr_get_dst_addr(netif_hdr),
+                        netif_hdr->dst_l2addr_len, tag, -1);
+}
+
+static unsigned _hash(const uint8_t *src, size_t src_len,
+                      const uint8_t *dst, size_t dst_len, uint16_t tag)
+{
+    /* FNV-1a */
+    uint32_t hash = 2166136261U;
 
-    for (unsigned i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        gnrc_sixlowpan_frag_rb_t *e = &rbuf[i];
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash ^ src[i]) * 16777619U;
+    }
+    for (unsigned i = 0; i < dst_len; i++) {
+        hash = (hash ^ dst[i]) * 16777619U;
+    }
+    hash = (hash ^ (tag & 0xff)) * 16777619U;
+    hash = (hash ^ (tag >> 8)) * 16777619U;
+    return hash % RBUF_HASH_SIZE;
+}
+
+static inline uint8_t *_hash_bucket(unsigned idx)
+{
+    const gnrc_sixlowpan_frag_rb_base_t *e = &rbuf[idx].super;
+
+    return &_hash_head[_hash(e->src, e->src_len, e->dst, e->dst_len, e->tag)];
+}
+
+static gnrc_sixlowpan_frag_rb_t *_rbuf_lookup(const uint8_t *src, size_t src_len,
+                                              const uint8_t *dst, size_t dst_len,
+                                              uint16_t tag, int size)
+{
+    unsigned pos = _hash_head[_hash(src, src_len, dst, dst_len, tag)];
+
+    while (pos) {
+        gnrc_sixlowpan_frag_rb_t *e = &rbuf[pos - 1];
 
         if ((e->pkt != NULL) && (e->super.tag == tag) &&
+            ((size < 0) || (e->super.datagram_size == size)) &&
             (e->super.src_len == src_len) &&
             (e->super.dst_len == dst_len) &&
             (memcmp(e->super.src, src, src_len) == 0) &&
             (memcmp(e->super.dst, dst, dst_len) == 0)) {
             return e;
         }
+        pos = _hash_next[pos - 1];
     }
     return NULL;
 }
 
+static void _expiry_insert(unsigned idx)
+{
+    unsigned pos = _exp_tail;
+
+    /* arrival is usually now, so search from the tail */
+    while (pos && ((int32_t)(rbuf[pos - 1].super.arrival -
+                             rbuf[idx].super.arrival) > 0)) {
+        pos = _exp_prev[pos - 1];
+    }
+    /* insert after pos */
+    _exp_prev[idx] = pos;
+    if (pos) {
+        _exp_next[idx] = _exp_next[pos - 1];
+        _exp_next[pos - 1] = idx + 1;
+    }
+    else {
+        _exp_next[idx] = _exp_head;
+        _exp_head = idx + 1;
+    }
+    if (_exp_next[idx]) {
+        _exp_prev[_exp_next[idx] - 1] = idx + 1;
+    }
+    else {
+        _exp_tail = idx + 1;
+    }
+}
+
+static bool _expiry_remove(unsigned idx)
+{
+    if ((_exp_head != idx + 1) && (_exp_prev[idx] == 0)) {
+        /* not in the list */
+        return false;
+    }
+    if (_exp_prev[idx]) {
+        _exp_next[_exp_prev[idx] - 1] = _exp_next[idx];
+    }
+    else {
+        _exp_head = _exp_next[idx];
+    }
+    if (_exp_next[idx]) {
+        _exp_prev[_exp_next[idx] - 1] = _exp_prev[idx];
+    }
+    else {
+        _exp_tail = _exp_prev[idx];
+    }
+    _exp_prev[idx] = 0;
+    _exp_next[idx] = 0;
+    return true;
+}
+
+static void _expiry_update(unsigned idx)
+{
+    if (_expiry_remove(idx)) {
+        _expiry_insert(idx);
+    }
+}
+
+static void _free_push(unsigned idx)
+{
+    _exp_next[idx] = _free_head;
+    _free_head = idx + 1;
+}
+
+/* returns CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE if there is no free entry */
+static unsigned _free_pop(void)
+{
+    unsigned idx;
+
+    if (_free_head) {
+        idx = _free_head - 1;
+        _free_head = _exp_next[idx];
+        _exp_next[idx] = 0;
+    }
+    else if (_free_unused < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE) {
+        idx = _free_unused++;
+    }
+    else {
+        return CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE;
+    }
+    assert(gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[idx]));
+    return idx;
+}
+
+static void _rbuf_link(unsigned idx)
+{
+    uint8_t *bucket = _hash_bucket(idx);
+
+    _hash_next[idx] = *bucket;
+    *bucket = idx + 1;
+    _expiry_insert(idx);
+}
+
+static void _rbuf_unlink(unsigned idx)
+{
+    if (!_expiry_remove(idx)) {
+        /* not linked */
+        return;
+    }
+    for (uint8_t *pos = _hash_bucket(idx); *pos; pos = &_hash_next[*pos - 1]) {
+        if (*pos == idx + 1) {
+            *pos = _hash_next[idx];
+            break;
+        }
+    }
+    _hash_next[idx] = 0;
+    _free_push(idx);
+}
+
+/* returns the position of entry in rbuf or CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE
+ * if entry is not from rbuf (i.e. a VRB entry) */
+static unsigned _rbuf_idx(const gnrc_sixlowpan_frag_rb_base_t *entry)
+{
+    uintptr_t first = (uintptr_t)&rbuf[0].super;
+    uintptr_t last = (uintptr_t)&rbuf[CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE - 1].super;
+
+    if (((uintptr_t)entry < first) || ((uintptr_t)entry > last)) {
+        return CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE;
+    }
+    return ((uintptr_t)entry - first) / sizeof(rbuf[0]);
+}
+
 #ifndef NDEBUG
 static bool _valid_offset(gnrc_pktsnip_t *pkt, size_t offset)
 {
@@ -535,6 +729,23 @@ bool gnrc_sixlowpan_frag_rb_ints_empty(void)
 }
 #endif  /* TEST_SUITES */
 
+/* frees the intervals of the oldest reassembly that is not entry */
+static gnrc_sixlowpan_frag_rb_int_t *_rbuf_int_reclaim(
+        const gnrc_sixlowpan_frag_rb_base_t *entry)
+{
+    for (unsigned pos = _exp_head; pos; pos = _exp_next[pos - 1]) {
+        gnrc_sixlowpan_frag_rb_t *oldest = &rbuf[pos - 1];
+
+        if ((&oldest->super != entry) && (oldest->super.ints != NULL)) {
+            DEBUG("6lo rfrag: interval buffer full, remove oldest entry\n");
+            _gc_pkt(oldest);
+            gnrc_sixlowpan_frag_rb_remove(oldest);
+            return _rbuf_int_get_free();
+        }
+    }
+    return NULL;
+}
+
 static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
                               uint16_t offset, size_t frag_size)
 {
@@ -542,6 +753,12 @@ static bool _rbuf_update_ints(gnrc_sixlowpan_frag_rb_base_t *entry,
     uint16_t end = (uint16_t)(offset + frag_size - 1);
 
     new = _rbuf_int_get_free();
+    if ((new == NULL) &&
+        !IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DO_NOT_OVERRIDE)) {
+        /* rather let the oldest reassembly fail than every reassembly that
+         * receives a fragment while the interval buffer is full */
+        new = _rbuf_int_reclaim(entry);
+    }
 
     if (new == NULL) {
         DEBUG("6lo rfrag: no space left in rbuf interval buffer.\n");
@@ -580,26 +797,26 @@ static void _gc_pkt(gnrc_sixlowpan_frag_rb_t *rbuf)
 void gnrc_sixlowpan_frag_rb_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
-    unsigned int i;
-
-    for (i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* since pkt occupies pktbuf, aggressivly collect garbage */
-        if (!gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i]) &&
-              ((now_usec - rbuf[i].super.arrival) >
-               CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)) {
-            DEBUG("6lo rfrag: entry (%s, ",
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) timed out\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
 
-            _gc_pkt(&rbuf[i]);
-            gnrc_sixlowpan_frag_rb_remove(&(rbuf[i]));
+    /* since pkt occupies pktbuf, aggressivly collect garbage. The expiry list
+     * is sorted by arrival, so stop at the first entry that did not time out */
+    while (_exp_head) {
+        gnrc_sixlowpan_frag_rb_t *e = &rbuf[_exp_head - 1];
+
+        if ((now_usec - e->super.arrival) <=
+            CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US) {
+            break;
         }
+        DEBUG("6lo rfrag: entry (%s, ",
+              gnrc_netif_addr_to_str(e->super.src, e->super.src_len,
+                                     l2addr_str));
+        DEBUG("%s, %u, %u) timed out\n",
+              gnrc_netif_addr_to_str(e->super.dst, e->super.dst_len,
+                                     l2addr_str),
+              (unsigned)e->super.datagram_size, e->super.tag);
+
+        _gc_pkt(e);
+        gnrc_sixlowpan_frag_rb_remove(e);
     }
 #ifdef MODULE_GNRC_SIXLOWPAN_FRAG_VRB
     gnrc_sixlowpan_frag_vrb_gc();
@@ -617,70 +834,51 @@ static int _rbuf_get(const void *src, size_t src_len,
                      size_t size, uint16_t tag,
                      unsigned page)
 {
-    gnrc_sixlowpan_frag_rb_t *res = NULL, *oldest = NULL;
+    gnrc_sixlowpan_frag_rb_t *res = NULL;
     uint32_t now_usec = xtimer_now_usec();
 
-    for (unsigned int i = 0; i < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE; i++) {
-        /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.tag == tag) &&
-            ((IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              /* not all SFR fragments carry the datagram size, so make 0 a
-               * legal value to not compare datagram size */
-              ((size == 0) || (rbuf[i].super.datagram_size == size))) ||
-             (!IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) &&
-              (rbuf[i].super.datagram_size == size))) &&
-            (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+    /* check first if entry already available. Not all SFR fragments carry the
+     * datagram size, so make 0 a legal value to not compare datagram size */
+    res = _rbuf_lookup(src, src_len, dst, dst_len, tag,
+                       (IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) && (size == 0))
+                       ? -1 : (int)size);
+    if (res != NULL) {
+        DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
+              gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
+                                     l2addr_str));
+        DEBUG("%s, %u, %u) found\n",
+              gnrc_netif_addr_to_str(res->super.dst, res->super.dst_len,
+                                     l2addr_str),
+              (unsigned)res->super.datagram_size, res->super.tag);
 #if CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER > 0
-            if (rbuf[i].super.current_size == 0) {
-                /* ensure that only empty reassembly buffer entries and entries
-                 * scheduled for deletion have `current_size == 0` */
-                DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
-                return -1;
-            }
-#endif
-            rbuf[i].super.arrival = now_usec;
-            _set_rbuf_timeout();
-            return i;
-        }
-
-        /* if there is a free spot: remember it */
-        if ((res == NULL) && gnrc_sixlowpan_frag_rb_entry_empty(&rbuf[i])) {
-            res = &(rbuf[i]);
-        }
-
-        /* remember oldest slot */
-        /* note that xtimer_now will overflow in ~1.2 hours */
-        if ((oldest == NULL) ||
-            (oldest->super.arrival - rbuf[i].super.arrival < UINT32_MAX / 2)) {
-            oldest = &(rbuf[i]);
+        if (res->super.current_size == 0) {
+            /* ensure that only empty reassembly buffer entries and entries
+             * scheduled for deletion have `current_size == 0` */
+            DEBUG("6lo rfrag: scheduled for deletion, don't add fragment\n");
+            return -1;
         }
+#endif
+        res->super.arrival = now_usec;
+        _expiry_update(res - &(rbuf[0]));
+        _set_rbuf_timeout();
+        return res - &(rbuf[0]);
     }
 
-    /* entry not in buffer and no empty spot found */
-    if (res == NULL) {
-        assert(oldest != NULL);
-        /* if oldest is not empty, res must not be NULL (because otherwise
-         * oldest could have been picked as res) */
-        assert(!gnrc_sixlowpan_frag_rb_entry_empty(oldest));
+    /* entry not in buffer and no empty spot available */
+    if ((_free_head == 0) &&
+        (_free_unused >= CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE)) {
+        /* all entries are in use, so the expiry list is not empty and its
+         * head is the oldest entry */
+        assert(_exp_head != 0);
+        gnrc_sixlowpan_frag_rb_t *oldest = &rbuf[_exp_head - 1];
+
         if (!IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DO_NOT_OVERRIDE) ||
             ((now_usec - oldest->super.arrival) >
             CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)) {
             DEBUG("6lo rfrag: reassembly buffer full, remove oldest entry\n");
-            gnrc_pktbuf_release(oldest->pkt);
+            _gc_pkt(oldest);
+            /* puts oldest into the free list */
             gnrc_sixlowpan_frag_rb_remove(oldest);
-            res = oldest;
 #if !IS_ACTIVE(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DO_NOT_OVERRIDE) && \
     IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
             gnrc_sixlowpan_frag_stats_get()->rbuf_full++;
@@ -695,6 +893,10 @@ static int _rbuf_get(const void *src, size_t src_len,
     }
 
     /* now we have an empty spot */
+    unsigned idx = _free_pop();
+
+    assert(idx < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE);
+    res = &rbuf[idx];
 
     gnrc_nettype_t reass_type;
     switch (page) {
@@ -727,6 +929,7 @@ static int _rbuf_get(const void *src, size_t src_len,
     }
     if (res->pkt == NULL) {
         DEBUG("6lo rfrag: can not allocate reassembly buffer space.\n");
+        _free_push(idx);
         return -1;
     }
 
@@ -746,6 +949,10 @@ static int _rbuf_get(const void *src, size_t src_len,
     res->offset_diff = 0U;
     memset(res->received, 0U, sizeof(res->received));
 #endif  /* IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_SFR) */
+#if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
+    _first_arrival[res - &(rbuf[0])] = now_usec;
+#endif
+    _rbuf_link(res - &(rbuf[0]));
 
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
@@ -772,6 +979,14 @@ void gnrc_sixlowpan_frag_rb_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+    memset(_hash_head, 0, sizeof(_hash_head));
+    memset(_hash_next, 0, sizeof(_hash_next));
+    memset(_exp_prev, 0, sizeof(_exp_prev));
+    memset(_exp_next, 0, sizeof(_exp_next));
+    _exp_head = 0;
+    _exp_tail = 0;
+    _free_head = 0;
+    _free_unused = 0;
 }
 
 const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
@@ -782,6 +997,11 @@ const gnrc_sixlowpan_frag_rb_t *gnrc_sixlowpan_frag_rb_array(void)
 
 void gnrc_sixlowpan_frag_rb_base_rm(gnrc_sixlowpan_frag_rb_base_t *entry)
 {
+    unsigned idx = _rbuf_idx(entry);
+
+    if (idx < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE) {
+        _rbuf_unlink(idx);
+    }
     while (entry->ints != NULL) {
         gnrc_sixlowpan_frag_rb_int_t *next = entry->ints->next;
 
@@ -804,6 +1024,7 @@ static void _tmp_rm(gnrc_sixlowpan_frag_rb_t *rbuf)
         rbuf->super.arrival = xtimer_now_usec() -
                               (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US -
                                CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_DEL_TIMER);
+        _expiry_update(_rbuf_idx(&rbuf->super));
         /* reset current size to prevent late duplicates to trigger another
          * dispatch */
         rbuf->super.current_size = 0;
@@ -857,8 +1078,16 @@ int gnrc_sixlowpan_frag_rb_dispatch_when_complete(gnrc_sixlowpan_frag_rb_t *rbuf
         new_netif_hdr->rssi = netif_hdr->rssi;
         rbuf->pkt = gnrc_pkt_append(rbuf->pkt, netif);
 #if IS_USED(MODULE_GNRC_SIXLOWPAN_FRAG_STATS)
-        gnrc_sixlowpan_frag_stats_get()->fragments += _count_frags(rbuf);
-        gnrc_sixlowpan_frag_stats_get()->datagrams++;
+        gnrc_sixlowpan_frag_stats_t *stats = gnrc_sixlowpan_frag_stats_get();
+        uint32_t latency = xtimer_now_usec() -
+                           _first_arrival[_rbuf_idx(&rbuf->super)];
+
+        stats->fragments += _count_frags(rbuf);
+        stats->datagrams++;
+        stats->latency_sum += latency;
+        if (latency > stats->latency_max) {
+            stats->latency_max = latency;
+        }
 #endif
         gnrc_sixlowpan_dispatch_recv(rbuf->pkt, NULL, 0);
         _tmp_rm(rbuf);
@@ -20,6 +20,9 @@
 #include "utlist.h"
 
 #include "net/gnrc/ipv6/hdr.h"
+#ifdef MODULE_GNRC_UDP_FASTPATH
+#include "net/gnrc/ipv6.h"
+#endif
 #include "net/gnrc/sixlowpan.h"
 #include "net/gnrc/sixlowpan/frag.h"
 #include "net/gnrc/sixlowpan/frag/rb.h"
@@ -35,7 +38,8 @@
 
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 
-static char _stack[GNRC_SIXLOWPAN_STACK_SIZE + DEBUG_EXTRA_STACKSIZE];
+static char _stack[GNRC_SIXLOWPAN_STACK_SIZE + GNRC_UDP_FASTPATH_EXTRA_STACKSIZE +
+                   DEBUG_EXTRA_STACKSIZE];
 
 /* handles GNRC_NETAPI_MSG_TYPE_RCV commands */
 static void _receive(gnrc_pktsnip_t *pkt);
@@ -80,6 +84,11 @@ void gnrc_sixlowpan_dispatch_recv(gnrc_pktsnip_t *pkt, void *context,
 #else   /* MODULE_GNRC_IPV6 */
     /* just assume normal IPv6 traffic */
     type = GNRC_NETTYPE_IPV6;
+#if IS_USED(MODULE_GNRC_UDP_FASTPATH)
+    if (gnrc_ipv6_fastpath_recv(pkt)) {
+        return;
+    }
+#endif
 #endif  /* MODULE_GNRC_IPV6 */
     if (!gnrc_netapi_dispatch_receive(type,
                                       GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
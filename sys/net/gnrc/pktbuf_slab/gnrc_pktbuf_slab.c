@@ -0,0 +1,488 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Size-class segregated (slab) implementation of the packet buffer
+ *
+ * Packet snip descriptors and data are served from fixed-size blocks of a
+ * small number of size classes, each with its own free list. So allocation
+ * and release are O(1) and a burst of small snips can not fragment the space
+ * needed for large datagrams.
+ *
+ * Since @ref gnrc_pktbuf_mark() and @ref gnrc_pktbuf_realloc_data() hand
+ * out or release parts of a block, each block counts the bytes still in use.
+ * It is put back into the free list once that count drops to zero.
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include "kernel_defines.h"
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#include "pktbuf_internal.h"
+
+#define ENABLE_DEBUG 0
+#include "debug.h"
+
+/**
+ * @brief   Alignment of all blocks and of data moved by gnrc_pktbuf_mark()
+ */
+#define SLAB_ALIGN          (8U)
+
+#define SLAB_ALIGNED(size)  (((size) + (SLAB_ALIGN - 1)) & ~(SLAB_ALIGN - 1))
+
+#define SNIP_SIZE           SLAB_ALIGNED(sizeof(gnrc_pktsnip_t))
+
+static_assert((CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE % SLAB_ALIGN) == 0,
+              "CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE has to be a multiple of 8");
+static_assert((CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE % SLAB_ALIGN) == 0,
+              "CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE has to be a multiple of 8");
+static_assert((CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE % SLAB_ALIGN) == 0,
+              "CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE has to be a multiple of 8");
+static_assert((SNIP_SIZE <= CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE) &&
+              (CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE < CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE) &&
+              (CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE < CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE),
+              "slab sizes have to be ascending");
+static_assert(CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE <= UINT16_MAX,
+              "CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE must fit into 16 bit");
+
+/**
+ * @brief   Marks a free block
+ */
+typedef struct _slab_free {
+    struct _slab_free *next;    /**< next free block of the same class */
+} _slab_free_t;
+
+/**
+ * @brief   A size class
+ */
+typedef struct {
+    uint8_t *buf;           /**< first block */
+    uint16_t *used;         /**< number of bytes in use per block */
+    _slab_free_t *free;     /**< free blocks */
+    uint16_t size;          /**< size of a block */
+    uint16_t numof;         /**< number of blocks */
+    uint16_t in_use;        /**< number of blocks currently in use */
+    uint16_t max_in_use;    /**< maximum of _slab_t::in_use since init */
+    uint16_t exhausted;     /**< allocations that did not fit since init */
+} _slab_t;
+
+#define SLAB_DEFINE(name, block_size, blocks) \
+    static alignas(SLAB_ALIGN) uint8_t _ ## name ## _buf[(block_size) * (blocks)]; \
+    static uint16_t _ ## name ## _used[blocks]
+
+#define SLAB_INIT(name, block_size, blocks) \
+    { .buf = _ ## name ## _buf, .used = _ ## name ## _used, \
+      .size = (block_size), .numof = (blocks) }
+
+SLAB_DEFINE(snip, SNIP_SIZE, CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF);
+SLAB_DEFINE(small, CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE,
+            CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF);
+SLAB_DEFINE(medium, CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE,
+            CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF);
+SLAB_DEFINE(large, CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE,
+            CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF);
+
+/* ordered by ascending block size */
+static _slab_t _slabs[] = {
+    SLAB_INIT(snip, SNIP_SIZE, CONFIG_GNRC_PKTBUF_SLAB_SNIP_NUMOF),
+    SLAB_INIT(small, CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE,
+              CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF),
+    SLAB_INIT(medium, CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE,
+              CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_NUMOF),
+    SLAB_INIT(large, CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE,
+              CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF),
+};
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+static void *_pktbuf_alloc(size_t size);
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+static inline bool _slab_contains(const _slab_t *slab, const void *ptr)
+{
+    const uintptr_t start = (uintptr_t)slab->buf;
+    const uintptr_t end = start + (slab->size * slab->numof);
+    uintptr_t pos = (uintptr_t)ptr;
+    return ((pos >= start) && (pos < end));
+}
+
+/* returns the class of the block ptr points into and its index in *idx */
+static _slab_t *_slab_find(const void *ptr, unsigned *idx)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        _slab_t *slab = &_slabs[i];
+
+        if (_slab_contains(slab, ptr)) {
+            *idx = ((uintptr_t)ptr - (uintptr_t)slab->buf) / slab->size;
+            return slab;
+        }
+    }
+    return NULL;
+}
+
+static inline void *_slab_block(const _slab_t *slab, unsigned idx)
+{
+    return slab->buf + (idx * slab->size);
+}
+
+void gnrc_pktbuf_init(void)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        _slab_t *slab = &_slabs[i];
+
+        slab->free = NULL;
+        /* push in reverse, so blocks are handed out in ascending order */
+        for (unsigned j = slab->numof; j > 0; j--) {
+            /* Silence false -Wcast-align: blocks are aligned to SLAB_ALIGN */
+            _slab_free_t *block = (_slab_free_t *)(uintptr_t)_slab_block(slab, j - 1);
+
+            block->next = slab->free;
+            slab->free = block;
+            slab->used[j - 1] = 0;
+        }
+        slab->in_use = 0;
+        slab->max_in_use = 0;
+        slab->exhausted = 0;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE) {
+        DEBUG("pktbuf: size (%u) > CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE (%u)\n",
+              (unsigned)size, CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE);
+        return NULL;
+    }
+    mutex_lock(&gnrc_pktbuf_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+    void *new_data_marked;
+
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
+              "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
+              (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    new_data_marked = pkt->data;
+    /* the marked section stays in place and keeps its part of the block, the
+     * remainder is moved if it would not be aligned otherwise */
+    if ((pkt->size != size) && ((size % SLAB_ALIGN) != 0)) {
+        void *new_data_rest = _pktbuf_alloc(pkt->size - size);
+
+        if (new_data_rest == NULL) {
+            DEBUG("pktbuf: could not reallocate remaining section.\n");
+            gnrc_pktbuf_free_internal(marked_snip, sizeof(gnrc_pktsnip_t));
+            mutex_unlock(&gnrc_pktbuf_mutex);
+            return NULL;
+        }
+        memcpy(new_data_rest, ((uint8_t *)pkt->data) + size, pkt->size - size);
+        gnrc_pktbuf_free_internal(((uint8_t *)pkt->data) + size, pkt->size - size);
+        pkt->data = new_data_rest;
+    }
+    else {
+        /* if (pkt->size - size) != 0 take remainder of data, otherwise set NULL */
+        pkt->data = (pkt->size != size) ? (((uint8_t *)pkt->data) + size) :
+                                          NULL;
+    }
+    pkt->size -= size;
+    _set_pktsnip(marked_snip, pkt->next, new_data_marked, size, type);
+    pkt->next = marked_snip;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return marked_snip;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && gnrc_pktbuf_contains(pkt->data)));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+        pkt->data = NULL;
+    }
+    /* if new size is bigger than old size */
+    else if (size > pkt->size) {
+        unsigned idx;
+        _slab_t *slab = (pkt->data) ? _slab_find(pkt->data, &idx) : NULL;
+
+        /* grow in place, if pkt is the only user of the block and the block
+         * is large enough */
+        if ((slab != NULL) && (slab->used[idx] == pkt->size) &&
+            (((uint8_t *)pkt->data + size) <=
+             ((uint8_t *)_slab_block(slab, idx) + slab->size))) {
+            slab->used[idx] = size;
+        }
+        else {
+            void *new_data = _pktbuf_alloc(size);
+
+            if (new_data == NULL) {
+                DEBUG("pktbuf: error allocating new data section\n");
+                mutex_unlock(&gnrc_pktbuf_mutex);
+                return ENOMEM;
+            }
+            if (pkt->data != NULL) {            /* if old data exist */
+                memcpy(new_data, pkt->data, pkt->size);
+            }
+            gnrc_pktbuf_free_internal(pkt->data, pkt->size);
+            pkt->data = new_data;
+        }
+    }
+    else {
+        gnrc_pktbuf_free_internal(((uint8_t *)pkt->data) + size,
+                                  pkt->size - size);
+    }
+    pkt->size = size;
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    while (pkt) {
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return NULL;
+    }
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&gnrc_pktbuf_mutex);
+        return new;
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+    return pkt;
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    mutex_lock(&gnrc_pktbuf_mutex);
+    puts("packet buffer (slab):");
+    puts("  block size | blocks | in use | max. in use | exhausted");
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        const _slab_t *slab = &_slabs[i];
+
+        printf("  %10u | %6u | %6u | %11u | %9u\n", slab->size, slab->numof,
+               slab->in_use, slab->max_in_use, slab->exhausted);
+    }
+    mutex_unlock(&gnrc_pktbuf_mutex);
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        if (_slabs[i].in_use > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    /* Invariants of this implementation:
+     *  - forall blocks in the free list of a class: the block is a block of
+     *    that class and has no bytes in use
+     *  - forall classes: length of free list == numof - in_use
+     *  - forall blocks not in the free list: bytes in use > 0 and
+     *    bytes in use <= block size
+     */
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        const _slab_t *slab = &_slabs[i];
+        unsigned free_blocks = 0, used_blocks = 0;
+
+        for (_slab_free_t *ptr = slab->free; ptr != NULL; ptr = ptr->next) {
+            uintptr_t offset = (uintptr_t)ptr - (uintptr_t)slab->buf;
+
+            if (!_slab_contains(slab, ptr) || ((offset % slab->size) != 0) ||
+                (slab->used[offset / slab->size] != 0) ||
+                (++free_blocks > slab->numof)) {
+                return false;
+            }
+        }
+        for (unsigned j = 0; j < slab->numof; j++) {
+            if (slab->used[j] > slab->size) {
+                return false;
+            }
+            used_blocks += (slab->used[j] > 0);
+        }
+        if (((free_blocks + slab->in_use) != slab->numof) ||
+            (used_blocks != slab->in_use)) {
+            return false;
+        }
+    }
+    return true;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _pktbuf_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            gnrc_pktbuf_free_internal(pkt, sizeof(gnrc_pktsnip_t));
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+static void *_pktbuf_alloc(size_t size)
+{
+    _slab_t *fit = NULL;
+
+    assert(size > 0);
+    /* take the smallest class that fits size and still has a free block */
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        _slab_t *slab = &_slabs[i];
+
+        if (slab->size < size) {
+            continue;
+        }
+        if (fit == NULL) {
+            fit = slab;
+        }
+        if (slab->free != NULL) {
+            _slab_free_t *block = slab->free;
+
+            if (slab != fit) {
+                /* falling back to a larger class */
+                fit->exhausted++;
+            }
+            slab->free = block->next;
+            slab->used[((uintptr_t)block - (uintptr_t)slab->buf) / slab->size] = size;
+            if (++slab->in_use > slab->max_in_use) {
+                slab->max_in_use = slab->in_use;
+            }
+            return block;
+        }
+    }
+    if (fit != NULL) {
+        fit->exhausted++;
+    }
+    DEBUG("pktbuf: no space left in packet buffer\n");
+    return NULL;
+}
+
+void gnrc_pktbuf_free_internal(void *data, size_t size)
+{
+    unsigned idx;
+    _slab_t *slab;
+
+    if ((data == NULL) || (size == 0) || ((slab = _slab_find(data, &idx)) == NULL)) {
+        return;
+    }
+    assert(slab->used[idx] >= size);
+    slab->used[idx] -= size;
+    if (slab->used[idx] == 0) {
+        _slab_free_t *block = _slab_block(slab, idx);
+
+        block->next = slab->free;
+        slab->free = block;
+        slab->in_use--;
+    }
+}
+
+bool gnrc_pktbuf_contains(void *ptr)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_slabs); i++) {
+        if (_slab_contains(&_slabs[i], ptr)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** @} */
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       QUIC congestion control backend for GNRC TCP
+ */
+
+#include "kernel_defines.h"
+#include "congure/quic.h"
+#include "net/gnrc/tcp/config.h"
+
+#include "net/gnrc/tcp/congure.h"
+
+static congure_quic_snd_t _tcp_congures_quic[CONFIG_GNRC_TCP_RCV_BUFFERS];
+static const congure_quic_snd_consts_t _tcp_congure_quic_consts = {
+    /* cong_event_cb to resend a segment is not needed since GNRC TCP resends
+     * the oldest segment itself when reporting it lost or timed out */
+    /* see https://tools.ietf.org/html/rfc9002#section-7.2 */
+    .init_wnd = (CONFIG_GNRC_TCP_MSS < 1472U) ? (CONFIG_GNRC_TCP_MSS * 10U)
+                                              : 14720U,
+    .min_wnd = CONFIG_GNRC_TCP_MSS * 2U,
+    .init_rtt = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS / 3U,
+    .max_msg_size = CONFIG_GNRC_TCP_MSS,
+    .pc_thresh = 3000U,
+    .granularity = CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+    .loss_reduction_numerator = 1U,
+    .loss_reduction_denominator = 2U,
+    .inter_msg_interval_numerator = 5U,
+    .inter_msg_interval_denominator = 4U,
+};
+
+congure_snd_t *gnrc_tcp_congure_snd_get(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_tcp_congures_quic); i++) {
+        if (_tcp_congures_quic[i].super.driver == NULL) {
+            congure_quic_snd_setup(&_tcp_congures_quic[i],
+                                   &_tcp_congure_quic_consts);
+            return &_tcp_congures_quic[i].super;
+        }
+    }
+    return NULL;
+}
+
+/** @} */
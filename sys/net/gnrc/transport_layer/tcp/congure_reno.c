@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @brief       TCP Reno congestion control backend for GNRC TCP
+ */
+
+#include "kernel_defines.h"
+#include "congure/reno.h"
+#include "net/gnrc/tcp/config.h"
+#include "net/gnrc/tcp/tcb.h"
+
+#include "net/gnrc/tcp/congure.h"
+
+static void _fr(congure_reno_snd_t *c);
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack);
+
+static congure_reno_snd_t _tcp_congures[CONFIG_GNRC_TCP_RCV_BUFFERS];
+static const congure_reno_snd_consts_t _tcp_congure_reno_consts = {
+    .fr = _fr,
+    .same_wnd_adv = _same_wnd_adv,
+    .init_mss = CONFIG_GNRC_TCP_MSS,
+    /* see https://tools.ietf.org/html/rfc3390 */
+    .cwnd_upper = 2190U,
+    .cwnd_lower = 1095U,
+    .init_ssthresh = CONGURE_WND_SIZE_MAX,
+    .frthresh = CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD,
+};
+
+congure_snd_t *gnrc_tcp_congure_snd_get(void)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_tcp_congures); i++) {
+        if (_tcp_congures[i].super.driver == NULL) {
+            congure_reno_snd_setup(&_tcp_congures[i],
+                                   &_tcp_congure_reno_consts);
+            return &_tcp_congures[i].super;
+        }
+    }
+    return NULL;
+}
+
+static void _fr(congure_reno_snd_t *c)
+{
+    (void)c;
+    /* GNRC TCP detects duplicate ACKs itself and already resent the segment
+     * when reporting it as lost, so do nothing */
+}
+
+static bool _same_wnd_adv(congure_reno_snd_t *c, congure_snd_ack_t *ack)
+{
+    gnrc_tcp_tcb_t *tcb = c->super.ctx;
+
+    return tcb->snd_wnd == ack->wnd;
+}
+
+/** @} */
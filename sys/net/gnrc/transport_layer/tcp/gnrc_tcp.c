@@ -671,8 +671,11 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     evtimer_mbox_event_t event_user_timeout;
     evtimer_mbox_event_t event_probe_timeout;
     uint32_t probe_timeout_duration_ms = 0;
+    uint32_t snd_una_start = 0;
+    ssize_t acked = 0;
     ssize_t ret = 0;
     bool probing_mode = false;
+    bool done = false;
     _gnrc_tcp_fsm_state_t state = 0;
 
     /* Lock the TCB for this function call */
@@ -705,8 +708,11 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                     MSG_TYPE_USER_SPEC_TIMEOUT, &mbox);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Remember where this call starts in sequence space to count acknowledged bytes */
+    snd_una_start = tcb->snd_una;
+
+    /* Loop until all data was sent and acked */
+    while (ret >= 0 && !done && ((size_t)ret < len || !_gnrc_tcp_pkt_rexmit_empty(tcb))) {
         state = _gnrc_tcp_fsm_get_state(tcb);
 
         /* Check if the connections state is closed. If so, a reset was received */
@@ -729,9 +735,10 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                         MSG_TYPE_PROBE_TIMEOUT, &mbox);
         }
 
-        /* Try to send data in case there nothing has been sent and we are not probing */
-        if (ret == 0 && !probing_mode) {
-            ret = _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+        /* Try to send remaining data in case we are not probing */
+        if ((size_t)ret < len && !probing_mode) {
+            ret += _gnrc_tcp_fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (uint8_t *) data + ret,
+                                 len - ret);
         }
 
         /* Wait for responses */
@@ -739,13 +746,27 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         switch (msg.type) {
             case MSG_TYPE_CONNECTION_TIMEOUT:
                 TCP_DEBUG_INFO("Received MSG_TYPE_CONNECTION_TIMEOUT.");
+                /* Only data acknowledged by the peer was transmitted,
+                 * the connection drops everything else */
+                acked = (uint32_t)(tcb->snd_una - snd_una_start);
                 _gnrc_tcp_fsm(tcb, FSM_EVENT_TIMEOUT_CONNECTION, NULL, NULL, 0);
+                if (acked > 0) {
+                    ret = acked;
+                    done = true;
+                    break;
+                }
                 TCP_DEBUG_ERROR("-ECONNABORTED: Connection timed out.");
                 ret = -ECONNABORTED;
                 break;
 
             case MSG_TYPE_USER_SPEC_TIMEOUT:
                 TCP_DEBUG_INFO("Received MSG_TYPE_USER_SPEC_TIMEOUT.");
+                /* Queued data stays in the retransmission queue and is
+                 * delivered after returning, report it as transmitted */
+                if (ret > 0) {
+                    done = true;
+                    break;
+                }
                 _gnrc_tcp_fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
                 TCP_DEBUG_ERROR("-ETIMEDOUT: User specified timeout expired.");
                 ret = -ETIMEDOUT;
@@ -24,6 +24,7 @@
 #include "net/gnrc.h"
 #include "evtimer.h"
 #include "evtimer_msg.h"
+#include "net/gnrc/tcp/congure.h"
 #include "include/gnrc_tcp_common.h"
 #include "include/gnrc_tcp_eventloop.h"
 #include "include/gnrc_tcp_pkt.h"
@@ -92,15 +93,69 @@ static uint16_t _get_random_local_port(void)
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
-    }
+    _gnrc_tcp_pkt_clear_retransmit(tcb);
     TCP_DEBUG_LEAVE;
     return 0;
 }
 
+/**
+ * @brief Sets up congestion control for an established connection.
+ *
+ * @param[in,out] tcb   TCB to set up congestion control for.
+ */
+static void _congure_setup(gnrc_tcp_tcb_t *tcb)
+{
+#ifdef MODULE_GNRC_TCP_CONGURE
+    if (tcb->congure == NULL) {
+        tcb->congure = gnrc_tcp_congure_snd_get();
+        if (tcb->congure != NULL) {
+            tcb->congure->driver->init(tcb->congure, tcb);
+        }
+        else {
+            TCP_DEBUG_INFO("No congestion control state available.");
+        }
+    }
+#else
+    (void)tcb;
+#endif
+}
+
+/**
+ * @brief Releases congestion control state of a connection.
+ *
+ * @param[in,out] tcb   TCB to release the congestion control state of.
+ */
+static void _congure_release(gnrc_tcp_tcb_t *tcb)
+{
+#ifdef MODULE_GNRC_TCP_CONGURE
+    if (tcb->congure != NULL) {
+        gnrc_tcp_congure_snd_free(tcb->congure);
+        tcb->congure = NULL;
+    }
+#else
+    (void)tcb;
+#endif
+}
+
+/**
+ * @brief Returns the usable window, the minimum of the peers window and the
+ *        congestion window.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Number of bytes that may be in flight.
+ */
+static uint32_t _snd_wnd(const gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t wnd = tcb->snd_wnd;
+#ifdef MODULE_GNRC_TCP_CONGURE
+    if ((tcb->congure != NULL) && (tcb->congure->cwnd < wnd)) {
+        wnd = tcb->congure->cwnd;
+    }
+#endif
+    return wnd;
+}
+
 /**
  * @brief Restarts timewait timer.
  *
@@ -150,6 +205,8 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
         case FSM_STATE_CLOSED:
             /* Clear retransmit queue */
             _clear_retransmit(tcb);
+            _gnrc_tcp_rcvbuf_clear_ooo(tcb);
+            _congure_release(tcb);
 
             /* Close connection if not listenng */
             if (!(tcb->status & STATUS_LISTENING))
@@ -232,6 +289,8 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, _gnrc_tcp_fsm_state_t state)
             break;
 
         case FSM_STATE_ESTABLISHED:
+            _congure_setup(tcb);
+            /* Falls through */
         case FSM_STATE_CLOSE_WAIT:
             /* Stop timeout for listening TCBs */
             if (tcb->status & STATUS_LISTENING) {
@@ -284,6 +343,7 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
         tcb->iss = random_uint32();
         tcb->snd_nxt = tcb->iss;
         tcb->snd_una = tcb->iss;
+        tcb->snd_recover = tcb->iss;
 
         /* Transition FSM to SYN_SENT */
         ret = _transition_to(tcb, FSM_STATE_SYN_SENT);
@@ -298,7 +358,7 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
         uint16_t seq_con = 0;
         _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN, tcb->iss, 0,
                             NULL, 0);
-        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
     }
     TCP_DEBUG_LEAVE;
@@ -308,6 +368,9 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 /**
  * @brief FSM Handling function for sending data.
  *
+ * Sends segments as long as the usable window is open and the retransmission
+ * queue has room.
+ *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in,out] buf   Buffer containing data to send.
  * @param[in]     len   Maximum Number of Bytes to send from @p buf.
@@ -317,27 +380,43 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     TCP_DEBUG_ENTER;
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+
+    while ((sent < len) && (tcb->rexmit_len < CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE)) {
+        uint32_t wnd = _snd_wnd(tcb);
+        uint32_t flight = _gnrc_tcp_pkt_flight_size(tcb);
+        size_t full = len - sent;
+        size_t payload = 0;
+
+        /* Check if window is open */
+        if (wnd <= flight) {
+            break;
+        }
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
         /* Calculate segment size */
-        payload = (payload < CONFIG_GNRC_TCP_MSS) ? payload : CONFIG_GNRC_TCP_MSS;
-        payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        full = (full < CONFIG_GNRC_TCP_MSS) ? full : CONFIG_GNRC_TCP_MSS;
+        full = (full < tcb->mss) ? full : tcb->mss;
+        payload = wnd - flight;
+        payload = (payload < full) ? payload : full;
+
+        /* Don't send small segments while waiting for acknowledgments (RFC 1122, 4.2.3.4) */
+        if (payload < full && flight > 0) {
+            break;
+        }
 
         /* Calculate payload size for this segment */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH,
-                            tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
-        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+        if (_gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt,
+                                tcb->rcv_nxt, (uint8_t *)buf + sent, payload) < 0) {
+            break;
+        }
+        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
-        TCP_DEBUG_LEAVE;
-        return payload;
+        sent += payload;
     }
     TCP_DEBUG_LEAVE;
-    return 0;
+    return sent;
 }
 
 /**
@@ -395,7 +474,7 @@ static int _fsm_call_close(gnrc_tcp_tcb_t *tcb)
         uint16_t seq_con = 0;
         _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_FIN_ACK, tcb->snd_nxt,
                             tcb->rcv_nxt, NULL, 0);
-        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+        _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt);
         _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
     }
 
@@ -572,12 +651,13 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             tcb->iss = random_uint32();
             tcb->snd_una = tcb->iss;
             tcb->snd_nxt = tcb->iss;
+            tcb->snd_recover = tcb->iss;
             tcb->snd_wnd = seg_wnd;
 
             /* Send SYN+ACK: seq_no = iss, ack_no = rcv_nxt, T: LISTEN -> SYN_RCVD */
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN_ACK, tcb->iss,
                                 tcb->rcv_nxt, NULL, 0);
-            _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+            _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt);
             _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
             _transition_to(tcb, FSM_STATE_SYN_RCVD);
         }
@@ -639,7 +719,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             else {
                 _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_SYN_ACK,
                                     tcb->iss, tcb->rcv_nxt, NULL, 0);
-                _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt, false);
+                _gnrc_tcp_pkt_setup_retransmit(tcb, out_pkt);
                 _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
                 _transition_to(tcb, FSM_STATE_SYN_RCVD);
             }
@@ -698,6 +778,8 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                     tcb->snd_wnd = seg_wnd;
                     tcb->snd_wl1 = seg_seq;
                     tcb->snd_wl2 = seg_ack;
+                    /* Release SYN before congestion control is set up */
+                    _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
                     _transition_to(tcb, FSM_STATE_ESTABLISHED);
                 }
                 else {
@@ -713,7 +795,26 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
                     tcb->snd_una = seg_ack;
+                    tcb->dup_acks = 0;
                     _gnrc_tcp_pkt_acknowledge(tcb, seg_ack);
+
+                    /* Partial ACK during recovery: resend next hole (see RFC 6582) */
+                    if (LSS_32_BIT(tcb->snd_una, tcb->snd_recover) &&
+                        !_gnrc_tcp_pkt_rexmit_empty(tcb)) {
+                        _gnrc_tcp_pkt_retransmit(tcb, false);
+                    }
+                    /* Signal user that data was acknowledged */
+                    tcb->status |= STATUS_NOTIFY_USER;
+                }
+                /* Duplicate ACK (see RFC 5681, section 2) */
+                else if ((seg_ack == tcb->snd_una) && !_gnrc_tcp_pkt_rexmit_empty(tcb) &&
+                         (pay_len == 0) && !(ctl & (MSK_SYN | MSK_FIN)) &&
+                         (seg_wnd == tcb->snd_wnd)) {
+                    /* Fast retransmit once per window of data */
+                    if ((++tcb->dup_acks == CONFIG_GNRC_TCP_DUP_ACK_THRESHOLD) &&
+                        !LSS_32_BIT(tcb->snd_una, tcb->snd_recover)) {
+                        _gnrc_tcp_pkt_retransmit(tcb, false);
+                    }
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -738,25 +839,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionally if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (_gnrc_tcp_pkt_rexmit_empty(tcb)) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (_gnrc_tcp_pkt_rexmit_empty(tcb)) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (_gnrc_tcp_pkt_rexmit_empty(tcb)) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (_gnrc_tcp_pkt_rexmit_empty(tcb)) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         TCP_DEBUG_LEAVE;
                         return 0;
@@ -772,18 +873,8 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             /* Check if state is valid for payload receiving */
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2) {
-                /* Search for begin of payload */
-                snp = gnrc_pktsnip_search_type(in_pkt, GNRC_NETTYPE_UNDEF);
-
-                /* Accept only data that is expected, to be received */
-                if (tcb->rcv_nxt == seg_seq) {
-                    /* Copy contents into receive buffer */
-                    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
-                        tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
-                        snp = snp->next;
-                    }
-                    /* Shrink receive window */
-                    tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+                /* Copy expected data into receive buffer, hold early data */
+                if (_gnrc_tcp_rcvbuf_process(tcb, in_pkt, seg_seq, pay_len, ctl & MSK_FIN)) {
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
@@ -803,6 +894,14 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 TCP_DEBUG_LEAVE;
                 return 0;
             }
+            /* Data in front of FIN is missing: Acknowledge what was received */
+            if (LSS_32_BIT(tcb->rcv_nxt, seg_seq + pay_len)) {
+                _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
+                                    tcb->rcv_nxt, NULL, 0);
+                _gnrc_tcp_pkt_send(tcb, out_pkt, seq_con, false);
+                TCP_DEBUG_LEAVE;
+                return 0;
+            }
             /* Advance rcv_nxt over FIN bit */
             tcb->rcv_nxt = seg_seq + seg_len;
             _gnrc_tcp_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt,
@@ -813,7 +912,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (_gnrc_tcp_pkt_rexmit_empty(tcb)) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -857,9 +956,8 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     TCP_DEBUG_ENTER;
-    if (tcb->pkt_retransmit != NULL) {
-        _gnrc_tcp_pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _gnrc_tcp_pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (!_gnrc_tcp_pkt_rexmit_empty(tcb)) {
+        _gnrc_tcp_pkt_retransmit(tcb, true);
     }
     else {
         TCP_DEBUG_INFO("Retransmission queue is empty.");
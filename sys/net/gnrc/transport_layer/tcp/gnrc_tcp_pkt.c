@@ -20,6 +20,7 @@
 #include <utlist.h>
 #include <errno.h>
 #include "byteorder.h"
+#include "clist.h"
 #include "evtimer.h"
 #include "evtimer_msg.h"
 #include "net/inet_csum.h"
@@ -49,6 +50,130 @@ static inline uint32_t _max(const uint32_t x, const uint32_t y)
   return (x > y) ? x : y;
 }
 
+/**
+ * @brief Starts the retransmission timer with the bounded current RTO.
+ *
+ * @param[in,out] tcb   TCB holding the RTO.
+ */
+static void _sched_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    /* Perform boundary checks on current RTO before usage */
+    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
+    }
+    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    }
+
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
+                              MSG_TYPE_RETRANSMISSION, tcb);
+}
+
+#ifdef MODULE_GNRC_TCP_CONGURE
+static void _congure_msg_init(congure_snd_msg_t *msg,
+                              const gnrc_tcp_rexmit_t *rexmit)
+{
+    memset(msg, 0, sizeof(*msg));
+    msg->send_time = rexmit->sent;
+    msg->size = _gnrc_tcp_pkt_get_seg_len(rexmit->pkt);
+    msg->resends = rexmit->retries;
+}
+
+static void _congure_report_sent(gnrc_tcp_tcb_t *tcb,
+                                 const gnrc_tcp_rexmit_t *rexmit)
+{
+    if (tcb->congure) {
+        tcb->congure->driver->report_msg_sent(
+            tcb->congure, _gnrc_tcp_pkt_get_seg_len(rexmit->pkt)
+        );
+    }
+}
+
+static void _congure_report_discarded(gnrc_tcp_tcb_t *tcb,
+                                      const gnrc_tcp_rexmit_t *rexmit)
+{
+    if (tcb->congure) {
+        tcb->congure->driver->report_msg_discarded(
+            tcb->congure, _gnrc_tcp_pkt_get_seg_len(rexmit->pkt)
+        );
+    }
+}
+
+static void _congure_report_loss(gnrc_tcp_tcb_t *tcb,
+                                 const gnrc_tcp_rexmit_t *rexmit,
+                                 bool timeout)
+{
+    /* Only the segment that is resent is reported, the rest stays in flight */
+    clist_node_t msgs = { .next = NULL };
+    congure_snd_msg_t msg;
+
+    if (tcb->congure == NULL) {
+        return;
+    }
+    _congure_msg_init(&msg, rexmit);
+    clist_rpush(&msgs, &msg.super);
+    if (timeout) {
+        tcb->congure->driver->report_msgs_timeout(tcb->congure,
+                                                  (congure_snd_msg_t *)&msgs);
+    }
+    else {
+        tcb->congure->driver->report_msgs_lost(tcb->congure,
+                                               (congure_snd_msg_t *)&msgs);
+    }
+}
+
+static void _congure_report_acked(gnrc_tcp_tcb_t *tcb,
+                                  const gnrc_tcp_rexmit_t *rexmit)
+{
+    congure_snd_msg_t msg;
+    /* Use the end of each segment as ID, so a cumulative ACK is not taken
+     * for a duplicate ACK by the congestion control */
+    congure_snd_ack_t ack = {
+        .recv_time = evtimer_now_msec(),
+        .id = rexmit->seq_end,
+        .wnd = tcb->snd_wnd,
+        .clean = 1U,
+    };
+
+    if (tcb->congure == NULL) {
+        return;
+    }
+    _congure_msg_init(&msg, rexmit);
+    tcb->congure->driver->report_msg_acked(tcb->congure, &msg, &ack);
+}
+#else
+static inline void _congure_report_sent(gnrc_tcp_tcb_t *tcb,
+                                        const gnrc_tcp_rexmit_t *rexmit)
+{
+    (void)tcb;
+    (void)rexmit;
+}
+
+static inline void _congure_report_discarded(gnrc_tcp_tcb_t *tcb,
+                                             const gnrc_tcp_rexmit_t *rexmit)
+{
+    (void)tcb;
+    (void)rexmit;
+}
+
+static inline void _congure_report_loss(gnrc_tcp_tcb_t *tcb,
+                                        const gnrc_tcp_rexmit_t *rexmit,
+                                        bool timeout)
+{
+    (void)tcb;
+    (void)rexmit;
+    (void)timeout;
+}
+
+static inline void _congure_report_acked(gnrc_tcp_tcb_t *tcb,
+                                         const gnrc_tcp_rexmit_t *rexmit)
+{
+    (void)tcb;
+    (void)rexmit;
+}
+#endif
+
 int _gnrc_tcp_pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt,
                                        gnrc_pktsnip_t *in_pkt)
 {
@@ -285,11 +410,9 @@ int _gnrc_tcp_pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt,
         return -EINVAL;
     }
 
-    /* If this is no retransmission, advance sequence number and measure time */
+    /* If this is no retransmission, advance sequence number */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = evtimer_now_msec();
     }
     else {
         tcb->retries += 1;
@@ -376,11 +499,12 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
-int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
-                                   const bool retransmit)
+int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt)
 {
     TCP_DEBUG_ENTER;
     gnrc_pktsnip_t *snp = NULL;
+    gnrc_tcp_rexmit_t *rexmit = NULL;
+    tcp_hdr_t *hdr = NULL;
     uint32_t ctl = 0;
     uint32_t len = 0;
 
@@ -391,8 +515,8 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
+    /* Check if retransmit queue is full */
+    if (tcb->rexmit_len >= CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE) {
         TCP_DEBUG_ERROR("-ENOMEM: Retransmit queue is full.");
         TCP_DEBUG_LEAVE;
         return -ENOMEM;
@@ -406,7 +530,8 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return -EINVAL;
     }
 
-    ctl = byteorder_ntohs(((tcp_hdr_t *) snp->data)->off_ctl);
+    hdr = (tcp_hdr_t *) snp->data;
+    ctl = byteorder_ntohs(hdr->off_ctl);
     len = _gnrc_tcp_pkt_get_pay_len(pkt);
 
     /* Check if pkt contains reset or is a pure ACK, return */
@@ -415,23 +540,50 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
+    /* Append pkt and increase users: every send attempt consumes a user */
+    rexmit = &tcb->rexmit[tcb->rexmit_len++];
+    rexmit->pkt = pkt;
+    rexmit->seq_end = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(pkt);
+    rexmit->sent = evtimer_now_msec();
+    rexmit->retries = 0;
     gnrc_pktbuf_hold(pkt, 1);
+    _congure_report_sent(tcb, rexmit);
 
-    /* RTO adjustment */
-    if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
-                                        CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
-        }
+    /* The retransmission timer is already running for an earlier segment */
+    if (tcb->rexmit_len > 1) {
+        TCP_DEBUG_LEAVE;
+        return 0;
+    }
+
+    /* If this is the first transmission: rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
     }
     else {
-        /* If this is a retransmission: Double the rto (Timer Backoff) */
+        tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                    CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
+    }
+    _sched_retransmit(tcb);
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
+
+int _gnrc_tcp_pkt_retransmit(gnrc_tcp_tcb_t *tcb, const bool timeout)
+{
+    TCP_DEBUG_ENTER;
+    gnrc_tcp_rexmit_t *rexmit = &tcb->rexmit[0];
+
+    /* Retransmission queue is empty. Nothing to retransmit */
+    if (tcb->rexmit_len == 0) {
+        TCP_DEBUG_ERROR("-ENODATA: No packet to retransmit.");
+        TCP_DEBUG_LEAVE;
+        return -ENODATA;
+    }
+
+    if (timeout) {
+        _congure_report_loss(tcb, rexmit, true);
+
+        /* Double the rto (Timer Backoff) */
         tcb->rto *= 2;
 
         /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
@@ -440,19 +592,20 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
             tcb->srtt = RTO_UNINITIALIZED;
             tcb->rtt_var = RTO_UNINITIALIZED;
         }
+        _sched_retransmit(tcb);
     }
-
-    /* Perform boundary checks on current RTO before usage */
-    if (tcb->rto < (int32_t) CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_LOWER_BOUND_MS;
-    }
-    else if (tcb->rto > (int32_t) CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS) {
-        tcb->rto = CONFIG_GNRC_TCP_RTO_UPPER_BOUND_MS;
+    /* Report loss only once per window of data (see RFC 6582) */
+    else if (!LSS_32_BIT(tcb->snd_una, tcb->snd_recover)) {
+        _congure_report_loss(tcb, rexmit, false);
     }
+    tcb->snd_recover = tcb->snd_nxt;
 
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    _gnrc_tcp_eventloop_sched(&tcb->event_retransmit, tcb->rto,
-                              MSG_TYPE_RETRANSMISSION, tcb);
+    /* Resend the oldest segment */
+    rexmit->sent = evtimer_now_msec();
+    rexmit->retries += 1;
+    gnrc_pktbuf_hold(rexmit->pkt, 1);
+    _congure_report_sent(tcb, rexmit);
+    _gnrc_tcp_pkt_send(tcb, rexmit->pkt, 0, true);
     TCP_DEBUG_LEAVE;
     return 0;
 }
@@ -460,57 +613,77 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
     TCP_DEBUG_ENTER;
-    uint32_t seg = 0;
-    gnrc_pktsnip_t *snp = NULL;
-    tcp_hdr_t *hdr;
+    unsigned acked = 0;
+    int32_t rtt = RTO_UNINITIALIZED;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->rexmit_len == 0) {
         TCP_DEBUG_ERROR("-ENODATA: No packet to acknowledge.");
         TCP_DEBUG_LEAVE;
         return -ENODATA;
     }
 
-    snp = gnrc_pktsnip_search_type(tcb->pkt_retransmit, GNRC_NETTYPE_TCP);
-    if (snp == NULL) {
-        TCP_DEBUG_ERROR("-EINVAL: snp == NULL.");
+    /* Release every segment that is acknowledged completely */
+    while ((acked < tcb->rexmit_len) && LEQ_32_BIT(tcb->rexmit[acked].seq_end, ack)) {
+        gnrc_tcp_rexmit_t *rexmit = &tcb->rexmit[acked++];
+
+        /* Use time only if there was no retransmission (Karns Algorithm) */
+        if (rexmit->retries == 0) {
+            rtt = evtimer_now_msec() - rexmit->sent;
+        }
+        _congure_report_acked(tcb, rexmit);
+        gnrc_pktbuf_release(rexmit->pkt);
+    }
+    if (acked == 0) {
         TCP_DEBUG_LEAVE;
-        return -EINVAL;
+        return 0;
+    }
+    tcb->rexmit_len -= acked;
+    memmove(&tcb->rexmit[0], &tcb->rexmit[acked],
+            tcb->rexmit_len * sizeof(tcb->rexmit[0]));
+    tcb->retries = 0;
+
+    /* Measure round trip time, if there was no timer overflow */
+    if (rtt > 0) {
+        /* If this is the first sample taken */
+        if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
+            tcb->srtt = rtt;
+            tcb->rtt_var = (rtt >> 1);
+        }
+        /* If this is a subsequent sample */
+        else {
+            tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
+            tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
+            tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
+            tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
+        }
+        tcb->rto = tcb->srtt + _max(CONFIG_GNRC_TCP_RTO_GRANULARITY_MS,
+                                    CONFIG_GNRC_TCP_RTO_K * tcb->rtt_var);
     }
 
-    hdr = (tcp_hdr_t *) snp->data;
-
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _gnrc_tcp_pkt_get_seg_len(
-        tcb->pkt_retransmit) - 1;
+    /* Restart the retransmission timer for the remaining segments (see RFC 6298) */
+    _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
+    if (tcb->rexmit_len > 0) {
+        _sched_retransmit(tcb);
+    }
+    TCP_DEBUG_LEAVE;
+    return 0;
+}
 
-        /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
+void _gnrc_tcp_pkt_clear_retransmit(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+    if (tcb->rexmit_len > 0) {
         _gnrc_tcp_eventloop_unsched(&tcb->event_retransmit);
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
-
-        /* Measure round trip time */
-        int32_t rtt = evtimer_now_msec() - tcb->rtt_start;
-
-        /* Use time only if there was no timer overflow and no retransmission (Karns Algorithm) */
-        if (tcb->retries == 0 && rtt > 0) {
-            /* If this is the first sample taken */
-            if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
-                tcb->srtt = rtt;
-                tcb->rtt_var = (rtt >> 1);
-            }
-            /* If this is a subsequent sample */
-            else {
-                tcb->rtt_var = (tcb->rtt_var / CONFIG_GNRC_TCP_RTO_B_DIV) * (CONFIG_GNRC_TCP_RTO_B_DIV-1);
-                tcb->rtt_var += labs(tcb->srtt - rtt) / CONFIG_GNRC_TCP_RTO_B_DIV;
-                tcb->srtt = (tcb->srtt / CONFIG_GNRC_TCP_RTO_A_DIV) * (CONFIG_GNRC_TCP_RTO_A_DIV-1);
-                tcb->srtt += rtt / CONFIG_GNRC_TCP_RTO_A_DIV;
-            }
-        }
     }
+    for (unsigned i = 0; i < tcb->rexmit_len; i++) {
+        _congure_report_discarded(tcb, &tcb->rexmit[i]);
+        gnrc_pktbuf_release(tcb->rexmit[i].pkt);
+    }
+    tcb->rexmit_len = 0;
+    tcb->dup_acks = 0;
+    tcb->snd_recover = tcb->snd_una;
     TCP_DEBUG_LEAVE;
-    return 0;
 }
 
 uint16_t _gnrc_tcp_pkt_calc_csum(const gnrc_pktsnip_t *hdr,
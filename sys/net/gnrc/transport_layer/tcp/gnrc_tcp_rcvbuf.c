@@ -18,8 +18,13 @@
 #include <errno.h>
 #include <mutex.h>
 #include <stdint.h>
+#include <string.h>
+#include "byteorder.h"
+#include "net/gnrc.h"
+#include "net/tcp.h"
 #include "net/gnrc/tcp/config.h"
 #include "include/gnrc_tcp_common.h"
+#include "include/gnrc_tcp_pkt.h"
 #include "include/gnrc_tcp_rcvbuf.h"
 
 #define ENABLE_DEBUG 0
@@ -124,3 +129,177 @@ void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb)
     }
     TCP_DEBUG_LEAVE;
 }
+
+/**
+ * @brief Copies payload of a segment into the receive buffer.
+ *
+ * @param[in,out] tcb   TCB holding the receive buffer.
+ * @param[in]     pkt   Segment to copy the payload from.
+ * @param[in]     off   Number of payload bytes to skip.
+ *
+ * @returns   Number of bytes added to the receive buffer.
+ */
+static uint32_t _add_payload(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, uint32_t off)
+{
+    uint32_t added = 0;
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UNDEF);
+
+    while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
+        if (off >= snp->size) {
+            off -= snp->size;
+        }
+        else {
+            unsigned len = snp->size - off;
+            unsigned res = ringbuffer_add(&(tcb->rcv_buf), (char *)snp->data + off, len);
+
+            added += res;
+            off = 0;
+            /* Receive buffer is full, the rest gets retransmitted */
+            if (res < len) {
+                break;
+            }
+        }
+        snp = snp->next;
+    }
+    tcb->rcv_nxt += added;
+    return added;
+}
+
+#if CONFIG_GNRC_TCP_RCV_OOO_QUEUE_SIZE > 0
+/**
+ * @brief Extracts the sequence number of a segment.
+ *
+ * @param[in] pkt   Segment with TCP header.
+ *
+ * @returns   The sequence number of @p pkt.
+ */
+static uint32_t _get_seq(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *snp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+
+    return byteorder_ntohl(((tcp_hdr_t *)snp->data)->seq_num);
+}
+
+/**
+ * @brief Removes the first segment from the out-of-order queue.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order queue.
+ */
+static void _ooo_pop(gnrc_tcp_tcb_t *tcb)
+{
+    gnrc_pktbuf_release(tcb->rcv_ooo[0]);
+    tcb->rcv_ooo_len--;
+    memmove(&tcb->rcv_ooo[0], &tcb->rcv_ooo[1],
+            tcb->rcv_ooo_len * sizeof(tcb->rcv_ooo[0]));
+}
+
+/**
+ * @brief Adds segments from the out-of-order queue that became in-order.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order queue.
+ *
+ * @returns   Number of bytes added to the receive buffer.
+ */
+static uint32_t _ooo_drain(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t added = 0;
+
+    while (tcb->rcv_ooo_len > 0) {
+        gnrc_pktsnip_t *pkt = tcb->rcv_ooo[0];
+        uint32_t seq = _get_seq(pkt);
+        uint32_t end = seq + _gnrc_tcp_pkt_get_pay_len(pkt);
+
+        /* There is still a gap in front of the first segment */
+        if (LSS_32_BIT(tcb->rcv_nxt, seq)) {
+            break;
+        }
+        if (LSS_32_BIT(tcb->rcv_nxt, end)) {
+            added += _add_payload(tcb, pkt, tcb->rcv_nxt - seq);
+        }
+        _ooo_pop(tcb);
+    }
+    return added;
+}
+
+/**
+ * @brief Holds a segment in the out-of-order queue, sorted by sequence number.
+ *
+ * If the queue is full, the segment furthest away from tcb->rcv_nxt is
+ * dropped in favor of an earlier one.
+ *
+ * @param[in,out] tcb       TCB holding the out-of-order queue.
+ * @param[in]     pkt       The segment.
+ * @param[in]     seq       Sequence number of @p pkt.
+ */
+static void _ooo_insert(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, uint32_t seq)
+{
+    unsigned pos = 0;
+
+    while ((pos < tcb->rcv_ooo_len) && LSS_32_BIT(_get_seq(tcb->rcv_ooo[pos]), seq)) {
+        pos++;
+    }
+    /* Segment is already held */
+    if ((pos < tcb->rcv_ooo_len) && (_get_seq(tcb->rcv_ooo[pos]) == seq)) {
+        return;
+    }
+    if (tcb->rcv_ooo_len == CONFIG_GNRC_TCP_RCV_OOO_QUEUE_SIZE) {
+        if (pos == tcb->rcv_ooo_len) {
+            TCP_DEBUG_INFO("Out-of-order queue is full. Drop segment.");
+            return;
+        }
+        gnrc_pktbuf_release(tcb->rcv_ooo[--tcb->rcv_ooo_len]);
+    }
+    memmove(&tcb->rcv_ooo[pos + 1], &tcb->rcv_ooo[pos],
+            (tcb->rcv_ooo_len - pos) * sizeof(tcb->rcv_ooo[0]));
+    /* The segment is released by the eventloop after processing */
+    gnrc_pktbuf_hold(pkt, 1);
+    tcb->rcv_ooo[pos] = pkt;
+    tcb->rcv_ooo_len++;
+}
+#endif
+
+bool _gnrc_tcp_rcvbuf_process(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
+                              const uint32_t seq, const uint32_t pay_len,
+                              const bool fin)
+{
+    TCP_DEBUG_ENTER;
+    uint32_t added = 0;
+
+    /* Segment is in order or overlaps with data that was received already */
+    if (LEQ_32_BIT(seq, tcb->rcv_nxt)) {
+        if (LSS_32_BIT(tcb->rcv_nxt, seq + pay_len)) {
+            added += _add_payload(tcb, pkt, tcb->rcv_nxt - seq);
+        }
+#if CONFIG_GNRC_TCP_RCV_OOO_QUEUE_SIZE > 0
+        if (added > 0) {
+            added += _ooo_drain(tcb);
+        }
+#endif
+    }
+#if CONFIG_GNRC_TCP_RCV_OOO_QUEUE_SIZE > 0
+    /* Hold segments that fit into the window until the gap is filled */
+    else if (!fin && LEQ_32_BIT(seq + pay_len, tcb->rcv_nxt + tcb->rcv_wnd)) {
+        _ooo_insert(tcb, pkt, seq);
+    }
+#else
+    (void)fin;
+#endif
+
+    /* Shrink receive window */
+    tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+    TCP_DEBUG_LEAVE;
+    return (added > 0);
+}
+
+void _gnrc_tcp_rcvbuf_clear_ooo(gnrc_tcp_tcb_t *tcb)
+{
+    TCP_DEBUG_ENTER;
+#if CONFIG_GNRC_TCP_RCV_OOO_QUEUE_SIZE > 0
+    while (tcb->rcv_ooo_len > 0) {
+        _ooo_pop(tcb);
+    }
+#else
+    (void)tcb;
+#endif
+    TCP_DEBUG_LEAVE;
+}
@@ -20,6 +20,7 @@
 #ifndef GNRC_TCP_PKT_H
 #define GNRC_TCP_PKT_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "net/gnrc.h"
 #include "net/gnrc/tcp/tcb.h"
@@ -111,19 +112,34 @@ uint32_t _gnrc_tcp_pkt_get_pay_len(gnrc_pktsnip_t *pkt);
 /**
  * @brief Adds a packet to the retransmission mechanism.
  *
+ * Starts the retransmission timer if @p pkt is the only unacknowledged
+ * segment.
+ *
  * @param[in,out] tcb          TCB holding the connection information.
  * @param[in]     pkt          Packet to add to the retransmission mechanism.
- * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit.
  *
  * @returns   Zero on success.
  *            -ENOMEM if the retransmission queue is full.
  *            -EINVAL if pkt is null.
  */
-int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
-                                   const bool retransmit);
+int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Resends the oldest unacknowledged segment.
+ *
+ * @param[in,out] tcb       TCB holding the connection information.
+ * @param[in]     timeout   True if the retransmission timer expired, false on
+ *                          fast retransmit. On timeout the RTO is backed off.
+ *
+ * @returns   Zero on success.
+ *            -ENODATA if there is nothing to retransmit.
+ */
+int _gnrc_tcp_pkt_retransmit(gnrc_tcp_tcb_t *tcb, const bool timeout);
+
+/**
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
+ *
+ * Every segment that is covered by @p ack completely is removed.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
@@ -133,6 +149,37 @@ int _gnrc_tcp_pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
  */
 int _gnrc_tcp_pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
 
+/**
+ * @brief Removes all packets from the retransmission mechanism.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _gnrc_tcp_pkt_clear_retransmit(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Checks if there are unacknowledged segments.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   True if no segment waits for its acknowledgment.
+ */
+static inline bool _gnrc_tcp_pkt_rexmit_empty(const gnrc_tcp_tcb_t *tcb)
+{
+    return tcb->rexmit_len == 0;
+}
+
+/**
+ * @brief Number of bytes sent but not yet acknowledged.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Bytes in flight.
+ */
+static inline uint32_t _gnrc_tcp_pkt_flight_size(const gnrc_tcp_tcb_t *tcb)
+{
+    return tcb->snd_nxt - tcb->snd_una;
+}
+
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
  *
@@ -20,6 +20,9 @@
 #ifndef GNRC_TCP_RCVBUF_H
 #define GNRC_TCP_RCVBUF_H
 
+#include <stdbool.h>
+#include <stdint.h>
+#include "net/gnrc/pkt.h"
 #include "net/gnrc/tcp/tcb.h"
 
 #ifdef __cplusplus
@@ -48,6 +51,34 @@ int _gnrc_tcp_rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
  */
 void _gnrc_tcp_rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Adds the payload of a received segment to the receive buffer.
+ *
+ * Data that was already received is skipped. A segment that starts beyond
+ * tcb->rcv_nxt is held in the out-of-order queue of @p tcb, if it lies
+ * completely in the receive window, and added as soon as the missing data
+ * arrives.
+ *
+ * @param[in,out] tcb       TCB holding the receive buffer.
+ * @param[in]     pkt       The received segment.
+ * @param[in]     seq       Sequence number of @p pkt.
+ * @param[in]     pay_len   Payload length of @p pkt.
+ * @param[in]     fin       True, if the FIN flag of @p pkt is set.
+ *
+ * @returns   True if in-order data was added to the receive buffer.
+ *            False otherwise.
+ */
+bool _gnrc_tcp_rcvbuf_process(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt,
+                              const uint32_t seq, const uint32_t pay_len,
+                              const bool fin);
+
+/**
+ * @brief Drops all segments held in the out-of-order queue.
+ *
+ * @param[in,out] tcb   TCB holding the out-of-order queue.
+ */
+void _gnrc_tcp_rcvbuf_clear_ooo(gnrc_tcp_tcb_t *tcb);
+
 #ifdef __cplusplus
 }
 #endif
@@ -160,6 +160,13 @@ static void _receive(gnrc_pktsnip_t *pkt)
     }
 }
 
+#if IS_USED(MODULE_GNRC_UDP_FASTPATH)
+void gnrc_udp_fastpath_recv(gnrc_pktsnip_t *pkt)
+{
+    _receive(pkt);
+}
+#endif
+
 static void _send(gnrc_pktsnip_t *pkt)
 {
     udp_hdr_t *hdr;
@@ -32,6 +32,7 @@
 #include "xtimer.h"
 #include "timex.h"
 #include "utlist.h"
+#include "bitarithm.h"
 
 #define ENABLE_DEBUG 0
 #include "debug.h"
@@ -69,133 +70,343 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
 }
 
 /**
- * @brief returns pointer to the entry for the given destination address
- *
- * @param[in] table                the FIB table to search in
- * @param[in] dst                  the destination address
- * @param[in] dst_size             the destination address size
- * @param[out] entry_arr           the array to scribe the found match
- * @param[in, out] entry_arr_size  the number of entries provided by entry_arr (should be always 1)
- *                                 this value is overwritten with the actual found number
+ * @brief number of bits in a word of fib_table_t::prefix_lens
+ */
+#define FIB_PREFIX_LEN_WORD_BITS    (sizeof(unsigned) * 8)
+
+/**
+ * @brief returns the mask selecting the bits of a prefix in its last byte
  *
- * @return 0 if we found a next-hop prefix
- *         1 if we found the exact address next-hop
- *         -EHOSTUNREACH if no fitting next-hop is available
+ * @param[in] len   the prefix length, must not be a multiple of 8
  */
-static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
-                          fib_entry_t **entry_arr, size_t *entry_arr_size) {
-    uint64_t now = xtimer_now_usec64();
+static inline uint8_t fib_last_byte_mask(unsigned len)
+{
+    return 0xff << (8 - (len & 0x7));
+}
 
-    size_t count = 0;
-    size_t prefix_size = 0;
-    size_t match_size = dst_size << 3;
-    int ret = -EHOSTUNREACH;
-    bool is_all_zeros_addr = true;
+/**
+ * @brief returns the number of significant bits of a destination
+ *
+ * All-zero destinations are default routes, destinations without a prefix
+ * length in their flags are host routes.
+ *
+ * @param[in] dst       the destination address
+ * @param[in] dst_size  the destination address size
+ * @param[in] dst_flags the destination address flags
+ *
+ * @return the prefix length in bits
+ */
+static unsigned fib_prefix_len(const uint8_t *dst, size_t dst_size,
+                               uint32_t dst_flags)
+{
+    uint32_t len = (dst_flags & FIB_FLAG_NET_PREFIX_MASK) >> FIB_FLAG_NET_PREFIX_SHIFT;
 
-    if (IS_ACTIVE(ENABLE_DEBUG)) {
-        DEBUG("[fib_find_entry] dst =");
-        for (size_t i = 0; i < dst_size; i++) {
-            DEBUG(" %02x", dst[i]);
+    for (size_t i = 0; i < dst_size; ++i) {
+        if (dst[i] != 0) {
+            return ((len == 0) || (len > (dst_size << 3))) ? (dst_size << 3) : len;
         }
-        DEBUG("\n");
     }
+    return 0;
+}
 
-    for (size_t i = 0; i < dst_size; ++i) {
-        if (dst[i] != 0) {
-            is_all_zeros_addr = false;
-            break;
+/**
+ * @brief returns the longest prefix length used in the table that is not
+ *        longer than @p max
+ *
+ * @param[in] table     the FIB table
+ * @param[in] max       the maximum prefix length to consider
+ *
+ * @return the prefix length
+ *         -1 if no entry has a prefix of at most @p max bits
+ */
+static int fib_next_prefix_len(const fib_table_t *table, int max)
+{
+    if (max < 0) {
+        return -1;
+    }
+
+    unsigned word = max / FIB_PREFIX_LEN_WORD_BITS;
+    /* ignore longer prefixes in the first word */
+    unsigned bits = table->prefix_lens[word] &
+                    ((2U << (max % FIB_PREFIX_LEN_WORD_BITS)) - 1);
+
+    while (bits == 0) {
+        if (word == 0) {
+            return -1;
         }
+        bits = table->prefix_lens[--word];
     }
+    return (word * FIB_PREFIX_LEN_WORD_BITS) + bitarithm_msb(bits);
+}
 
-    for (size_t i = 0; i < table->size; ++i) {
+/**
+ * @brief returns the hash bucket of the first @p len bits of an address
+ *
+ * @param[in] table     the FIB table
+ * @param[in] addr      the address
+ * @param[in] len       the prefix length in bits
+ *
+ * @return the head of the bucket
+ */
+static fib_entry_t **fib_bucket(fib_table_t *table, const uint8_t *addr,
+                                unsigned len)
+{
+    /* FNV-1a over the prefix, seeded with its length */
+    uint32_t hash = 2166136261U ^ len;
 
-        /* autoinvalidate if the entry lifetime is not set to not expire */
-        if (table->data.entries[i].lifetime != FIB_LIFETIME_NO_EXPIRE) {
+    for (unsigned i = 0; i < (len >> 3); ++i) {
+        hash = (hash ^ addr[i]) * 16777619U;
+    }
+    if (len & 0x7) {
+        hash = (hash ^ (addr[len >> 3] & fib_last_byte_mask(len))) * 16777619U;
+    }
+    hash ^= hash >> 16;
 
-            /* check if the lifetime expired */
-            if (table->data.entries[i].lifetime < now) {
-                /* remove this entry if its lifetime expired */
-                table->data.entries[i].lifetime = 0;
-                table->data.entries[i].global_flags = 0;
-                table->data.entries[i].next_hop_flags = 0;
-                table->data.entries[i].iface_id = KERNEL_PID_UNDEF;
+    return &table->buckets[hash & (CONFIG_FIB_BUCKETS - 1)];
+}
 
-                if (table->data.entries[i].global != NULL) {
-                    universal_address_rem(table->data.entries[i].global);
-                    table->data.entries[i].global = NULL;
-                }
+/**
+ * @brief checks if the prefix of an entry covers an address
+ *
+ * @param[in] entry     the FIB entry
+ * @param[in] addr      the address
+ * @param[in] addr_size the address size
+ *
+ * @return true if the first fib_entry_t::prefix_len bits are equal
+ */
+static bool fib_prefix_matches(const fib_entry_t *entry, const uint8_t *addr,
+                               size_t addr_size)
+{
+    const universal_address_container_t *global = entry->global;
+    unsigned len = entry->prefix_len;
 
-                if (table->data.entries[i].next_hop != NULL) {
-                    universal_address_rem(table->data.entries[i].next_hop);
-                    table->data.entries[i].next_hop = NULL;
-                }
-            }
-        }
+    if ((global->address_size != addr_size)
+        || (memcmp(global->address, addr, len >> 3) != 0)) {
+        return false;
+    }
+    return ((len & 0x7) == 0)
+           || (((global->address[len >> 3] ^ addr[len >> 3]) & fib_last_byte_mask(len)) == 0);
+}
 
-        if ((prefix_size < (dst_size<<3)) && (table->data.entries[i].global != NULL)) {
-
-            int ret_comp = universal_address_compare(table->data.entries[i].global, dst,
-                                                     &match_size);
-            /* If we found an exact match */
-            if ((ret_comp == UNIVERSAL_ADDRESS_EQUAL)
-                || (is_all_zeros_addr && (ret_comp == UNIVERSAL_ADDRESS_IS_ALL_ZERO_ADDRESS))) {
-                entry_arr[0] = &(table->data.entries[i]);
-                *entry_arr_size = 1;
-                /* we will not find a better one so we return */
-                return 1;
-            }
-            else {
-                /* we try to find the most fitting prefix */
-                if (ret_comp == UNIVERSAL_ADDRESS_MATCHING_PREFIX) {
-                    if (table->data.entries[i].global_flags & FIB_FLAG_NET_PREFIX_MASK) {
-                        /* we shift the most upper flag byte back to get the number of prefix bits */
-                        uint32_t global_prefix_len = (table->data.entries[i].global_flags
-                                                   & FIB_FLAG_NET_PREFIX_MASK) >> FIB_FLAG_NET_PREFIX_SHIFT;
-
-                        if ((match_size >= global_prefix_len) &&
-                            ((prefix_size == 0) || (match_size > prefix_size))) {
-                            entry_arr[0] = &(table->data.entries[i]);
-                            /* we could find a better one so we move on */
-                            ret = 0;
-
-                            prefix_size = match_size;
-                            count = 1;
-                        }
-                    }
-                 }
-                 else if (ret_comp == UNIVERSAL_ADDRESS_IS_ALL_ZERO_ADDRESS) {
-                    /* we found the default gateway entry, e.g. ::/0 for IPv6
-                     * and we keep it only if there is no better one
-                     */
-                    if (prefix_size == 0) {
-                        entry_arr[0] = &(table->data.entries[i]);
-                        /* we could find a better one so we move on */
-                        ret = 0;
-                        count = 1;
-                    }
-                }
-                match_size = dst_size<<3;
+/**
+ * @brief adds an entry to its hash bucket
+ *
+ * @param[in] table     the FIB table
+ * @param[in] entry     the entry with global address and prefix length set
+ */
+static void fib_link(fib_table_t *table, fib_entry_t *entry)
+{
+    unsigned len = entry->prefix_len;
+
+    LL_PREPEND(*fib_bucket(table, entry->global->address, len), entry);
+    assert(table->prefix_len_refs[len] < UINT16_MAX);
+    if (table->prefix_len_refs[len]++ == 0) {
+        table->prefix_lens[len / FIB_PREFIX_LEN_WORD_BITS] |= 1U << (len % FIB_PREFIX_LEN_WORD_BITS);
+    }
+}
+
+/**
+ * @brief removes an entry from its hash bucket
+ *
+ * @param[in] table     the FIB table
+ * @param[in] entry     the entry
+ */
+static void fib_unlink(fib_table_t *table, fib_entry_t *entry)
+{
+    unsigned len = entry->prefix_len;
+
+    LL_DELETE(*fib_bucket(table, entry->global->address, len), entry);
+
+    /* keep the prefix length as long as another entry uses it */
+    assert(table->prefix_len_refs[len] > 0);
+    if (--table->prefix_len_refs[len] == 0) {
+        table->prefix_lens[len / FIB_PREFIX_LEN_WORD_BITS] &= ~(1U << (len % FIB_PREFIX_LEN_WORD_BITS));
+    }
+}
+
+/**
+ * @brief sets the lifetime of an entry and sorts it into the expiry list
+ *
+ * @param[in] table     the FIB table
+ * @param[in] entry     the entry
+ * @param[in] lifetime  the lifetime in ms
+ */
+static void fib_set_lifetime(fib_table_t *table, fib_entry_t *entry,
+                             uint32_t lifetime)
+{
+    if ((entry->lifetime != 0) && (entry->lifetime != FIB_LIFETIME_NO_EXPIRE)) {
+        LL_DELETE2(table->expiry, entry, expiry_next);
+    }
+
+    if (lifetime == (uint32_t)FIB_LIFETIME_NO_EXPIRE) {
+        entry->lifetime = FIB_LIFETIME_NO_EXPIRE;
+        return;
+    }
+
+    fib_lifetime_to_absolute(lifetime, &entry->lifetime);
+
+    fib_entry_t **pos = &table->expiry;
+    while ((*pos != NULL) && ((*pos)->lifetime <= entry->lifetime)) {
+        pos = &(*pos)->expiry_next;
+    }
+    entry->expiry_next = *pos;
+    *pos = entry;
+}
+
+/**
+ * @brief removes the given entry
+ *
+ * @param[in] table the FIB table the entry belongs to
+ * @param[in] entry the entry to be removed
+ */
+static void fib_remove(fib_table_t *table, fib_entry_t *entry)
+{
+    fib_unlink(table, entry);
+
+    if (entry->lifetime != FIB_LIFETIME_NO_EXPIRE) {
+        LL_DELETE2(table->expiry, entry, expiry_next);
+    }
+
+    universal_address_rem(entry->global);
+    universal_address_rem(entry->next_hop);
+
+    entry->global = NULL;
+    entry->global_flags = 0;
+    entry->next_hop = NULL;
+    entry->next_hop_flags = 0;
+
+    entry->iface_id = KERNEL_PID_UNDEF;
+    entry->lifetime = 0;
+    entry->expiry_next = NULL;
+    entry->prefix_len = 0;
+
+    LL_PREPEND(table->unused, entry);
+}
+
+/**
+ * @brief removes all entries with an expired lifetime
+ *
+ * @param[in] table the FIB table
+ */
+static void fib_expire(fib_table_t *table)
+{
+    if (table->expiry == NULL) {
+        return;
+    }
+
+    uint64_t now = xtimer_now_usec64();
+
+    while ((table->expiry != NULL) && (table->expiry->lifetime < now)) {
+        fib_remove(table, table->expiry);
+    }
+}
+
+/**
+ * @brief empties a single hop table
+ *
+ * @param[in] table the FIB table
+ */
+static void fib_reset_entries(fib_table_t *table)
+{
+    memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+    memset(table->buckets, 0, sizeof(table->buckets));
+    memset(table->prefix_lens, 0, sizeof(table->prefix_lens));
+    memset(table->prefix_len_refs, 0, sizeof(table->prefix_len_refs));
+    table->expiry = NULL;
+    table->unused = NULL;
+
+    /* hand out unused entries in order */
+    for (size_t i = table->size; i > 0; --i) {
+        LL_PREPEND(table->unused, &table->data.entries[i - 1]);
+    }
+}
+
+/**
+ * @brief returns the entry for exactly the given destination address
+ *
+ * @param[in] table     the FIB table to search in
+ * @param[in] dst       the destination address
+ * @param[in] dst_size  the destination address size
+ *
+ * @return the entry
+ *         NULL if there is no entry for @p dst
+ */
+static fib_entry_t *fib_find_exact(fib_table_t *table, const uint8_t *dst,
+                                   size_t dst_size)
+{
+    fib_expire(table);
+
+    if (dst_size > UNIVERSAL_ADDRESS_SIZE) {
+        return NULL;
+    }
+
+    for (int len = fib_next_prefix_len(table, dst_size << 3); len >= 0;
+         len = fib_next_prefix_len(table, len - 1)) {
+        fib_entry_t *entry;
+        LL_FOREACH(*fib_bucket(table, dst, len), entry) {
+            if ((entry->prefix_len == (unsigned)len)
+                && (entry->global->address_size == dst_size)
+                && (memcmp(entry->global->address, dst, dst_size) == 0)) {
+                return entry;
             }
         }
     }
 
+    return NULL;
+}
+
+/**
+ * @brief returns the entry with the longest prefix covering the given
+ *        destination address
+ *
+ * @param[in] table     the FIB table to search in
+ * @param[in] dst       the destination address
+ * @param[in] dst_size  the destination address size
+ * @param[out] entry    the found entry
+ *
+ * @return 0 if we found a next-hop prefix
+ *         1 if we found a next-hop for the full address
+ *         -EHOSTUNREACH if no fitting next-hop is available
+ */
+static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
+                          fib_entry_t **entry)
+{
+    fib_expire(table);
+
     if (IS_ACTIVE(ENABLE_DEBUG)) {
-        if (count > 0) {
-            DEBUG("[fib_find_entry] found prefix on interface %d:", entry_arr[0]->iface_id);
-            for (size_t i = 0; i < entry_arr[0]->global->address_size; i++) {
-                DEBUG(" %02x", entry_arr[0]->global->address[i]);
+        DEBUG("[fib_find_entry] dst =");
+        for (size_t i = 0; i < dst_size; i++) {
+            DEBUG(" %02x", dst[i]);
+        }
+        DEBUG("\n");
+    }
+
+    if (dst_size > UNIVERSAL_ADDRESS_SIZE) {
+        return -EHOSTUNREACH;
+    }
+
+    /* probe the prefix lengths in use, the longest first */
+    for (int len = fib_next_prefix_len(table, dst_size << 3); len >= 0;
+         len = fib_next_prefix_len(table, len - 1)) {
+        fib_entry_t *tmp;
+        LL_FOREACH(*fib_bucket(table, dst, len), tmp) {
+            if ((tmp->prefix_len == (unsigned)len)
+                && fib_prefix_matches(tmp, dst, dst_size)) {
+                DEBUG("[fib_find_entry] found /%d on interface %d\n", len,
+                      tmp->iface_id);
+                *entry = tmp;
+                return (len == (int)(dst_size << 3)) ? 1 : 0;
             }
-            DEBUG("\n");
         }
     }
 
-    *entry_arr_size = count;
-    return ret;
+    return -EHOSTUNREACH;
 }
 
 /**
- * @brief updates the next hop the lifetime and the interface id for a given entry
+ * @brief updates the next hop and the lifetime for a given entry
  *
+ * @param[in] table          the FIB table the entry belongs to
  * @param[in] entry          the entry to be updated
  * @param[in] next_hop       the next hop address to be updated
  * @param[in] next_hop_size  the next hop address size
@@ -205,9 +416,9 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
  * @return 0 if the entry has been updated
  *         -ENOMEM if the entry cannot be updated due to insufficient RAM
  */
-static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
-                         size_t next_hop_size, uint32_t next_hop_flags,
-                         uint32_t lifetime)
+static int fib_upd_entry(fib_table_t *table, fib_entry_t *entry,
+                         uint8_t *next_hop, size_t next_hop_size,
+                         uint32_t next_hop_flags, uint32_t lifetime)
 {
     universal_address_container_t *container = universal_address_add(next_hop, next_hop_size);
 
@@ -219,12 +430,7 @@ static int fib_upd_entry(fib_entry_t *entry, uint8_t *next_hop,
     entry->next_hop = container;
     entry->next_hop_flags = next_hop_flags;
 
-    if (lifetime != (uint32_t)FIB_LIFETIME_NO_EXPIRE) {
-        fib_lifetime_to_absolute(lifetime, &entry->lifetime);
-    }
-    else {
-        entry->lifetime = FIB_LIFETIME_NO_EXPIRE;
-    }
+    fib_set_lifetime(table, entry, lifetime);
 
     return 0;
 }
@@ -250,60 +456,32 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                             uint8_t *next_hop, size_t next_hop_size, uint32_t
                             next_hop_flags, uint32_t lifetime)
 {
-    for (size_t i = 0; i < table->size; ++i) {
-        if (table->data.entries[i].lifetime == 0) {
-
-            table->data.entries[i].global = universal_address_add(dst, dst_size);
-
-            if (table->data.entries[i].global != NULL) {
-                table->data.entries[i].global_flags = dst_flags;
-                table->data.entries[i].next_hop = universal_address_add(next_hop, next_hop_size);
-                table->data.entries[i].next_hop_flags = next_hop_flags;
-            }
+    fib_entry_t *entry = table->unused;
 
-            if (table->data.entries[i].next_hop != NULL) {
-                /* everything worked fine */
-                table->data.entries[i].iface_id = iface_id;
-
-                if (lifetime != (uint32_t) FIB_LIFETIME_NO_EXPIRE) {
-                    fib_lifetime_to_absolute(lifetime, &table->data.entries[i].lifetime);
-                }
-                else {
-                    table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
-                }
-
-                return 0;
-            }
-        }
+    if ((entry == NULL) || (dst_size > UNIVERSAL_ADDRESS_SIZE)
+        || (next_hop_size > UNIVERSAL_ADDRESS_SIZE)) {
+        return -ENOMEM;
     }
 
-    return -ENOMEM;
-}
-
-/**
- * @brief removes the given entry
- *
- * @param[in] entry the entry to be removed
- *
- * @return 0 on success
- */
-static int fib_remove(fib_entry_t *entry)
-{
-    if (entry->global != NULL) {
-        universal_address_rem(entry->global);
+    entry->global = universal_address_add(dst, dst_size);
+    if (entry->global == NULL) {
+        return -ENOMEM;
     }
 
-    if (entry->next_hop) {
-        universal_address_rem(entry->next_hop);
+    entry->next_hop = universal_address_add(next_hop, next_hop_size);
+    if (entry->next_hop == NULL) {
+        universal_address_rem(entry->global);
+        entry->global = NULL;
+        return -ENOMEM;
     }
 
-    entry->global = NULL;
-    entry->global_flags = 0;
-    entry->next_hop = NULL;
-    entry->next_hop_flags = 0;
-
-    entry->iface_id = KERNEL_PID_UNDEF;
-    entry->lifetime = 0;
+    LL_DELETE(table->unused, entry);
+    entry->iface_id = iface_id;
+    entry->global_flags = dst_flags;
+    entry->next_hop_flags = next_hop_flags;
+    entry->prefix_len = fib_prefix_len(dst, dst_size, dst_flags);
+    fib_link(table, entry);
+    fib_set_lifetime(table, entry, lifetime);
 
     return 0;
 }
@@ -395,8 +573,6 @@ int fib_add_entry(fib_table_t *table,
 {
     mutex_lock(&(table->mtx_access));
     DEBUG("[fib_add_entry]\n");
-    size_t count = 1;
-    fib_entry_t *entry[count];
 
     /* check if dst and next_hop are valid pointers */
     if ((dst == NULL) || (next_hop == NULL)) {
@@ -404,11 +580,13 @@ int fib_add_entry(fib_table_t *table,
         return -EFAULT;
     }
 
-    int ret = fib_find_entry(table, dst, dst_size, &(entry[0]), &count);
+    int ret;
+    fib_entry_t *entry = fib_find_exact(table, dst, dst_size);
 
-    if (ret == 1) {
+    if (entry != NULL) {
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry, next_hop, next_hop_size,
+                            next_hop_flags, lifetime);
     }
     else {
         ret = fib_create_entry(table, iface_id, dst, dst_size, dst_flags,
@@ -425,8 +603,6 @@ int fib_update_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
 {
     mutex_lock(&(table->mtx_access));
     DEBUG("[fib_update_entry]\n");
-    size_t count = 1;
-    fib_entry_t *entry[count];
     int ret = -ENOMEM;
 
     /* check if dst and next_hop are valid pointers */
@@ -435,16 +611,16 @@ int fib_update_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
         return -EFAULT;
     }
 
-    if (fib_find_entry(table, dst, dst_size, &(entry[0]), &count) == 1) {
-        DEBUG("[fib_update_entry] found entry: %p\n", (void *)(entry[0]));
+    fib_entry_t *entry = fib_find_exact(table, dst, dst_size);
+
+    if (entry != NULL) {
+        DEBUG("[fib_update_entry] found entry: %p\n", (void *)entry);
         /* we must take the according entry and update the values */
-        ret = fib_upd_entry(entry[0], next_hop, next_hop_size, next_hop_flags, lifetime);
+        ret = fib_upd_entry(table, entry, next_hop, next_hop_size,
+                            next_hop_flags, lifetime);
     }
     else {
-        /* we have ambiguous entries, i.e. count > 1
-         * this should never happen
-         */
-        DEBUG("[fib_update_entry] ambiguous entries detected!!!\n");
+        DEBUG("[fib_update_entry] no entry found\n");
     }
 
     mutex_unlock(&(table->mtx_access));
@@ -455,20 +631,14 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
 {
     mutex_lock(&(table->mtx_access));
     DEBUG("[fib_remove_entry]\n");
-    size_t count = 1;
-    fib_entry_t *entry[count];
 
-    int ret = fib_find_entry(table, dst, dst_size, &(entry[0]), &count);
+    fib_entry_t *entry = fib_find_exact(table, dst, dst_size);
 
-    if (ret == 1) {
-        /* we must take the according entry and update the values */
-        fib_remove(entry[0]);
+    if (entry != NULL) {
+        fib_remove(table, entry);
     }
     else {
-        /* we have ambiguous entries, i.e. count > 1
-         * this should never happen
-         */
-        DEBUG("[fib_update_entry] ambiguous entries detected!!!\n");
+        DEBUG("[fib_remove_entry] no entry found\n");
     }
 
     mutex_unlock(&(table->mtx_access));
@@ -479,10 +649,13 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
     mutex_lock(&(table->mtx_access));
     DEBUG("[fib_flush]\n");
 
-    for (size_t i = 0; i < table->size; ++i) {
-        if ((interface == KERNEL_PID_UNDEF) ||
-            (interface == table->data.entries[i].iface_id)) {
-            fib_remove(&table->data.entries[i]);
+    /* backwards, so fib_remove() finds remaining entries with the same
+     * prefix length early */
+    for (size_t i = table->size; i > 0; --i) {
+        fib_entry_t *entry = &table->data.entries[i - 1];
+        if ((entry->global != NULL) &&
+            ((interface == KERNEL_PID_UNDEF) || (interface == entry->iface_id))) {
+            fib_remove(table, entry);
         }
     }
 
@@ -496,8 +669,7 @@ int fib_get_next_hop(fib_table_t *table, kernel_pid_t *iface_id,
 {
     mutex_lock(&(table->mtx_access));
     DEBUG("[fib_get_next_hop]\n");
-    size_t count = 1;
-    fib_entry_t *entry[count];
+    fib_entry_t *entry = NULL;
 
     if ((iface_id == NULL)
         || (next_hop_size == NULL)
@@ -511,20 +683,19 @@ int fib_get_next_hop(fib_table_t *table, kernel_pid_t *iface_id,
         return -EFAULT;
     }
 
-    int ret = fib_find_entry(table, dst, dst_size, &(entry[0]), &count);
+    int ret = fib_find_entry(table, dst, dst_size, &entry);
     if (!(ret == 0 || ret == 1)) {
         /* notify all responsible RPs for unknown  next-hop for the destination address */
         if (fib_signal_rp(table, FIB_MSG_RP_SIGNAL_UNREACHABLE_DESTINATION,
                           dst, dst_size, dst_flags) == 0) {
-            count = 1;
             /* now lets see if the RRPs have found a valid next-hop */
-            ret = fib_find_entry(table, dst, dst_size, &(entry[0]), &count);
+            ret = fib_find_entry(table, dst, dst_size, &entry);
         }
     }
 
     if (ret == 0 || ret == 1) {
 
-        uint8_t *address_ret = universal_address_get_address(entry[0]->next_hop,
+        uint8_t *address_ret = universal_address_get_address(entry->next_hop,
                                next_hop, next_hop_size);
 
         if (address_ret == NULL) {
@@ -537,8 +708,8 @@ int fib_get_next_hop(fib_table_t *table, kernel_pid_t *iface_id,
         return -EHOSTUNREACH;
     }
 
-    *iface_id = entry[0]->iface_id;
-    *next_hop_flags = entry[0]->next_hop_flags;
+    *iface_id = entry->iface_id;
+    *next_hop_flags = entry->next_hop_flags;
     mutex_unlock(&(table->mtx_access));
     return 0;
 }
@@ -602,7 +773,7 @@ void fib_init(fib_table_t *table)
                sizeof(fib_sr_entry_t) * table->data.source_routes->entry_pool_size);
     }
     else {
-        memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+        fib_reset_entries(table);
     }
     universal_address_init();
     mutex_unlock(&(table->mtx_access));
@@ -627,7 +798,7 @@ void fib_deinit(fib_table_t *table)
                sizeof(fib_sr_entry_t) * table->data.source_routes->entry_pool_size);
     }
     else {
-        memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+        fib_reset_entries(table);
     }
     universal_address_reset();
     mutex_unlock(&(table->mtx_access));
@@ -761,10 +932,11 @@ static int fib_sr_new_entry(fib_table_t *table, uint8_t *addr, size_t addr_size,
 */
 static int fib_is_sr_in_table(fib_table_t *table, const fib_sr_t *fib_sr)
 {
-    for (size_t i = 0; i < table->size; ++i) {
-        if (&(table->data.source_routes->headers[i]) == fib_sr) {
-            return 0;
-        }
+    uintptr_t offset = (uintptr_t)fib_sr - (uintptr_t)table->data.source_routes->headers;
+
+    /* headers is an array, so a range and stride check suffices */
+    if ((offset < (table->size * sizeof(fib_sr_t))) && ((offset % sizeof(fib_sr_t)) == 0)) {
+        return 0;
     }
     return -ENOENT;
 }
@@ -1627,13 +1799,10 @@ int fib_devel_get_lifetime(fib_table_t *table, uint64_t *lifetime, uint8_t *dst,
                            size_t dst_size)
 {
     if (table->table_type == FIB_TABLE_TYPE_SH) {
-        size_t count = 1;
-        fib_entry_t *entry[count];
-
-        int ret = fib_find_entry(table, dst, dst_size, &(entry[0]), &count);
-        if (ret == 1 ) {
+        fib_entry_t *entry = fib_find_exact(table, dst, dst_size);
+        if (entry != NULL) {
             /* only return lifetime of exact matches */
-            *lifetime = entry[0]->lifetime;
+            *lifetime = entry->lifetime;
             return 0;
         }
         return -EHOSTUNREACH;
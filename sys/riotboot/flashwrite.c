@@ -65,6 +65,7 @@ int riotboot_flashwrite_init_raw(riotboot_flashwrite_t *state, int target_slot,
     state->target_slot = target_slot;
     state->flashpage =
         flashpage_page((void *)riotboot_slot_get_hdr(target_slot));
+    state->erased = state->flashpage + 1;
 
     if (CONFIG_RIOTBOOT_FLASHWRITE_RAW && offset) {
         /* Erase the first page only if the offset (!=0) specifies that there is
@@ -75,6 +76,45 @@ int riotboot_flashwrite_init_raw(riotboot_flashwrite_t *state, int target_slot,
     return 0;
 }
 
+#if CONFIG_RIOTBOOT_FLASHWRITE_RAW
+static int _write_raw(void *addr, const void *data, size_t len)
+{
+    flashpage_write(addr, data, len);
+    /* unlike flashpage_write_and_verify(), flashpage_write() doesn't check
+     * the result, so a write to a page that wasn't erased would go unnoticed */
+    if (memcmp(addr, data, len)) {
+        LOG_WARNING(LOG_PREFIX "error writing flash at %p!\n", addr);
+        return -1;
+    }
+    return 0;
+}
+#endif
+
+int riotboot_flashwrite_erase_ahead(riotboot_flashwrite_t *state, size_t len)
+{
+#if CONFIG_RIOTBOOT_FLASHWRITE_RAW
+    uint8_t *slot_start = (uint8_t *)riotboot_slot_get_hdr(state->target_slot);
+    size_t end = min(state->offset + len,
+                     riotboot_slot_size(state->target_slot));
+
+    if (end == 0) {
+        return 0;
+    }
+
+    unsigned last = flashpage_page(slot_start + end - 1);
+
+    while (state->erased <= last) {
+        LOG_DEBUG(LOG_PREFIX "erasing page %u ahead\n", state->erased);
+        flashpage_erase(state->erased++);
+    }
+#else
+    /* pages are erased by flashpage_write_and_verify() */
+    (void)state;
+    (void)len;
+#endif
+    return 0;
+}
+
 int riotboot_flashwrite_flush(riotboot_flashwrite_t *state)
 {
     if (CONFIG_RIOTBOOT_FLASHWRITE_RAW) {
@@ -89,9 +129,8 @@ int riotboot_flashwrite_flush(riotboot_flashwrite_t *state)
         /* Get the offset of the remaining chunk */
         size_t flashpage_pos = state->offset - flashwrite_buffer_pos;
         /* Write remaining chunk */
-        flashpage_write(slot_start + flashpage_pos,
-                        state->flashpage_buf,
-                        RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
+        return _write_raw(slot_start + flashpage_pos, state->flashpage_buf,
+                          RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
     }
     else {
         if (flashpage_write_and_verify(state->flashpage,
@@ -126,10 +165,13 @@ int riotboot_flashwrite_putbytes(riotboot_flashwrite_t *state,
 
         if (CONFIG_RIOTBOOT_FLASHWRITE_RAW &&
             flashpage_pos == flashpage_size(state->flashpage)) {
-            /* Erase the next page */
+            /* Erase the next page, unless it was already erased ahead */
             state->flashpage++;
             flashpage_pos = 0;
-            flashpage_erase(state->flashpage);
+            if (state->flashpage >= state->erased) {
+                flashpage_erase(state->flashpage);
+                state->erased = state->flashpage + 1;
+            }
         }
         if (CONFIG_RIOTBOOT_FLASHWRITE_RAW &&
             flashwrite_buffer_pos == 0) {
@@ -152,10 +194,10 @@ int riotboot_flashwrite_putbytes(riotboot_flashwrite_t *state,
                 memcpy(state->firstblock_buf,
                        state->flashpage_buf, RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
             }
-            else {
-                flashpage_write((uint8_t *)addr + flashpage_pos,
+            else if (_write_raw((uint8_t *)addr + flashpage_pos,
                                 state->flashpage_buf,
-                                RIOTBOOT_FLASHPAGE_BUFFER_SIZE);
+                                RIOTBOOT_FLASHPAGE_BUFFER_SIZE)) {
+                return -1;
             }
 #else
             int res = flashpage_write_and_verify(state->flashpage,
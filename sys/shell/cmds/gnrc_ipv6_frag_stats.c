@@ -29,6 +29,9 @@ static int _gnrc_ipv6_frag_stats(int argc, char **argv)
         printf("frag full: %u\n", stats->frag_full);
         printf("frags complete: %u\n", stats->fragments);
         printf("dgs complete: %u\n", stats->datagrams);
+        printf("frags sent: %u\n", stats->sent_fragments);
+        printf("dgs sent: %u\n", stats->sent_datagrams);
+        printf("send bursts: %u\n", stats->bursts);
     }
     return 0;
 }
@@ -13,6 +13,7 @@
  * @author  Martine Lenders <m.lenders@fu-berlin.de>
  */
 
+#include <inttypes.h>
 #include <stdio.h>
 
 #include "kernel_defines.h"
@@ -77,6 +78,9 @@ static void _usage_nib_neigh(char **argv)
     printf("       %s %s add <iface> <ipv6 addr> [<l2 addr>]\n", argv[0], argv[1]);
     printf("       %s %s del <iface> <ipv6 addr>\n", argv[0], argv[1]);
     printf("       %s %s show [iface]\n", argv[0], argv[1]);
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    printf("       %s %s stats [reset]\n", argv[0], argv[1]);
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
 }
 
 static void _usage_nib_prefix(char **argv)
@@ -161,6 +165,18 @@ static int _nib_neigh(int argc, char **argv)
         }
         gnrc_ipv6_nib_nc_del(&ipv6_addr, iface);
     }
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+    else if ((argc > 2) && (strcmp(argv[2], "stats") == 0)) {
+        gnrc_ipv6_nib_nc_hash_stats_t stats;
+
+        gnrc_ipv6_nib_nc_get_hash_stats(&stats, (argc > 3) &&
+                                        (strcmp(argv[3], "reset") == 0));
+        printf("entries: %u\n", (unsigned)stats.entries);
+        printf("look-ups: %" PRIu32 "\n", stats.lookups);
+        printf("probes: %" PRIu32 " (max. %u per look-up)\n", stats.probes,
+               (unsigned)stats.max_probes);
+    }
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
     else {
         _usage_nib_neigh(argv);
         return 1;
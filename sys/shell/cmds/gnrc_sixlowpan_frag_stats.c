@@ -52,6 +52,10 @@ static int _gnrc_6lo_frag_stats(int argc, char **argv)
 #endif  /* MODULE_GNRC_SIXLOWPAN_FRAG_SFR_STATS */
     printf("frags complete: %u\n", stats->fragments);
     printf("dgs complete: %u\n", stats->datagrams);
+    printf("reass latency: avg %lu us, max %lu us\n",
+           (long unsigned)(stats->datagrams
+                           ? stats->latency_sum / stats->datagrams : 0),
+           (long unsigned)stats->latency_max);
     return 0;
 }
 
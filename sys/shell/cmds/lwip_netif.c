@@ -18,6 +18,7 @@
  * @}
  */
 
+#include <inttypes.h>
 #include <kernel_defines.h>
 #include <stdio.h>
 
@@ -79,6 +80,8 @@ static void _netif_list(struct netif *netif)
     printf("        Link type: %s\n",
         (dev->driver->get(dev, NETOPT_IS_WIRED, &i, sizeof(i)) > 0) ?
             "wired" : "wireless");
+    printf("        RX dropped: %" PRIu32 " no pbuf: %" PRIu32 "\n",
+        compat->rx_stats.dropped, compat->rx_stats.alloc_failed);
 #ifdef MODULE_LWIP_IPV4
     printf("        inet addr: ");
     ip_addr_debug_print(LWIP_DBG_ON, netif_ip_addr4(netif));
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to print statistics of the thread-cached
+ *              allocator
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "malloc_thread_cache.h"
+#include "shell.h"
+#include "thread.h"
+
+static int _malloc_cache_handler(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+
+#if IS_USED(MODULE_MALLOC_THREAD_SAFE)
+    puts("pid | name                 | allocs   | frees    | hits     "
+         "| refills | flushes | fallback | cached");
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        malloc_thread_cache_thread_stats_t t;
+
+        malloc_thread_cache_thread_stats(pid, &t);
+        if ((t.allocs == 0) && (t.frees == 0)) {
+            continue;
+        }
+        const char *name = thread_get(pid) ? thread_getname(pid) : "(exited)";
+        printf("%3d | %-20s | %8" PRIu32 " | %8" PRIu32 " | %8" PRIu32
+               " | %7" PRIu32 " | %7" PRIu32 " | %8" PRIu32 " | %6u\n",
+               (int)pid, name, t.allocs, t.frees, t.cache_hits,
+               t.refills, t.flushes, t.fallbacks, (unsigned)t.cached);
+    }
+
+    puts("\nsize | slabs | blocks | used   | free   | cached | fragmentation");
+    for (unsigned i = 0; i < CONFIG_MALLOC_THREAD_CACHE_CLASSES; i++) {
+        malloc_thread_cache_class_stats_t c;
+
+        malloc_thread_cache_class_stats(i, &c);
+        unsigned unused = c.free_global + c.free_cached;
+        unsigned frag = c.blocks ? (100U * unused) / c.blocks : 0;
+        printf("%4u | %5u | %6u | %6u | %6u | %6u | %3u%%\n",
+               (unsigned)c.size, (unsigned)c.slabs, (unsigned)c.blocks,
+               (unsigned)(c.blocks - unused), (unsigned)c.free_global,
+               (unsigned)c.free_cached, frag);
+    }
+    printf("\n%u of %u slabs unassigned\n", malloc_thread_cache_free_slabs(),
+           (unsigned)(CONFIG_MALLOC_THREAD_CACHE_ARENA_SIZE /
+                      CONFIG_MALLOC_THREAD_CACHE_SLAB_SIZE));
+    return 0;
+#else
+    /* the C library of this platform is thread-safe by itself */
+    puts("thread cache not available on this platform");
+    return 1;
+#endif
+}
+
+SHELL_COMMAND(malloc_cache, "Prints statistics of the thread-cached allocator",
+              _malloc_cache_handler);
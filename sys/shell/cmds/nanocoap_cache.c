@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command to print statistics of the nanoCoAP cache
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "net/nanocoap/cache.h"
+#include "shell.h"
+
+static int _nanocoap_cache_handler(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    nanocoap_cache_stats_t stats;
+
+    nanocoap_cache_get_stats(&stats);
+    printf("entries: %u used, %u free\n",
+           (unsigned)nanocoap_cache_used_count(),
+           (unsigned)nanocoap_cache_free_count());
+    printf("bytes: %u of %u used\n", (unsigned)nanocoap_cache_bytes_used(),
+           (unsigned)CONFIG_NANOCOAP_CACHE_SIZE);
+    printf("hits: %" PRIu32 ", misses: %" PRIu32 ", evictions: %" PRIu32
+           ", expirations: %" PRIu32 "\n",
+           stats.hits, stats.misses, stats.evictions, stats.expirations);
+    return 0;
+}
+
+SHELL_COMMAND(coap_cache, "Prints statistics of the nanoCoAP cache",
+              _nanocoap_cache_handler);
@@ -25,6 +25,7 @@
 #include <inttypes.h>
 #include <nanocbor/nanocbor.h>
 #include <assert.h>
+#include <string.h>
 
 #include "hashes/sha256.h"
 
@@ -43,6 +44,12 @@
 #include "suit/transport/vfs.h"
 #endif
 #include "suit/transport/mock.h"
+#if IS_USED(MODULE_SUIT_PIPELINE)
+#include "suit/pipeline.h"
+#endif
+#if IS_USED(MODULE_ZTIMER_MSEC)
+#include "ztimer.h"
+#endif
 
 #if defined(MODULE_PROGRESS_BAR)
 #include "progress_bar.h"
@@ -53,6 +60,28 @@
 #define ENABLE_DEBUG 0
 #include "debug.h"
 
+/* The payload is digested while it is written to the storage, so it doesn't
+ * have to be read back for the validation. The digest is only used if the
+ * whole payload was written in order by the last fetch of the component. */
+static struct {
+    const suit_component_t *comp;   /**< component being fetched */
+    size_t next;                    /**< offset of the next chunk to digest */
+    bool digested;                  /**< digest holds the complete digest */
+    sha256_context_t sha256;
+    uint8_t digest[SHA256_DIGEST_LENGTH];
+    uint32_t start;                 /**< start of the fetch in ms */
+    suit_fetch_stats_t stats;
+} _fetch;
+
+static inline uint32_t _now_ms(void)
+{
+#if IS_USED(MODULE_ZTIMER_MSEC)
+    return ztimer_now(ZTIMER_MSEC);
+#else
+    return 0;
+#endif
+}
+
 static int _get_component_size(suit_manifest_t *manifest,
                                suit_component_t *comp,
                                uint32_t *img_size)
@@ -345,7 +374,40 @@ static inline void _print_download_progress(suit_manifest_t *manifest,
 #endif
 }
 
-#if defined(MODULE_SUIT_TRANSPORT_COAP) || defined(MODULE_SUIT_TRANSPORT_VFS)
+#if defined(MODULE_SUIT_TRANSPORT_COAP) || defined(MODULE_SUIT_TRANSPORT_VFS) || \
+    defined(MODULE_SUIT_TRANSPORT_MOCK)
+/* runs in the pipeline thread with module suit_pipeline */
+static int _store_chunk(void *arg, size_t offset, uint8_t *buf, size_t len,
+                        int more)
+{
+    suit_manifest_t *manifest = (suit_manifest_t *)arg;
+    suit_component_t *comp = &manifest->components[manifest->component_current];
+
+    int res = suit_storage_write(comp->storage_backend, manifest, buf, offset, len);
+    if (res < 0) {
+        return res;
+    }
+
+    if (offset == _fetch.next) {
+        sha256_update(&_fetch.sha256, buf, len);
+        _fetch.next += len;
+    }
+
+    if (more) {
+        return suit_storage_prepare(comp->storage_backend,
+                                    CONFIG_SUIT_STORAGE_PREPARE_AHEAD);
+    }
+
+    LOG_INFO("Finalizing payload store\n");
+    /* Finalize the write if no more data available */
+    res = suit_storage_finish(comp->storage_backend, manifest);
+    if ((res == SUIT_OK) && (_fetch.next == offset + len)) {
+        sha256_final(&_fetch.sha256, _fetch.digest);
+        _fetch.digested = true;
+    }
+    return res;
+}
+
 static int _storage_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
                            int more)
 {
@@ -379,17 +441,61 @@ static int _storage_helper(void *arg, size_t offset, uint8_t *buf, size_t len,
     }
 
     _print_download_progress(manifest, offset, len, image_size);
+    _fetch.stats.total = image_size;
+    _fetch.stats.received = total;
 
-    int res = suit_storage_write(comp->storage_backend, manifest, buf, offset, len);
-    if (!more) {
-        LOG_INFO("Finalizing payload store\n");
-        /* Finalize the write if no more data available */
-        res = suit_storage_finish(comp->storage_backend, manifest);
-    }
+    uint32_t start = _now_ms();
+#if IS_USED(MODULE_SUIT_PIPELINE)
+    int res = suit_pipeline_put(offset, buf, len, more);
+#else
+    int res = _store_chunk(manifest, offset, buf, len, more);
+#endif
+    uint32_t now = _now_ms();
+
+    _fetch.stats.stall_ms += now - start;
+    _fetch.stats.elapsed_ms = now - _fetch.start;
     return res;
 }
 #endif
 
+static void _fetch_start(suit_manifest_t *manifest, suit_component_t *comp)
+{
+    memset(&_fetch, 0, sizeof(_fetch));
+    _fetch.comp = comp;
+    sha256_init(&_fetch.sha256);
+    _fetch.start = _now_ms();
+#if IS_USED(MODULE_SUIT_PIPELINE)
+    suit_pipeline_start(_store_chunk, manifest);
+#else
+    (void)manifest;
+#endif
+}
+
+static int _fetch_finish(int res)
+{
+#if IS_USED(MODULE_SUIT_PIPELINE)
+    /* the chunks still queued are stored even if the transport failed */
+    int stored = suit_pipeline_finish();
+    if (res == 0) {
+        res = stored;
+    }
+#endif
+    _fetch.stats.elapsed_ms = _now_ms() - _fetch.start;
+
+    uint32_t ms = _fetch.stats.elapsed_ms ? _fetch.stats.elapsed_ms : 1;
+    LOG_INFO("Fetched %u bytes in %" PRIu32 " ms (%" PRIu32 " B/s), "
+             "%" PRIu32 " ms waiting for storage\n",
+             (unsigned)_fetch.stats.received, _fetch.stats.elapsed_ms,
+             (uint32_t)(((uint64_t)_fetch.stats.received * 1000) / ms),
+             _fetch.stats.stall_ms);
+    return res;
+}
+
+void suit_fetch_get_stats(suit_fetch_stats_t *stats)
+{
+    *stats = _fetch.stats;
+}
+
 static int _dtv_fetch(suit_manifest_t *manifest, int key,
                       nanocbor_value_t *_it)
 {
@@ -436,6 +542,8 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
 
     res = -1;
 
+    _fetch_start(manifest, comp);
+
     if (0) {}
 #ifdef MODULE_SUIT_TRANSPORT_COAP
     else if ((strncmp(manifest->urlbuf, "coap://", 7) == 0) ||
@@ -447,7 +555,7 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
 #endif
 #ifdef MODULE_SUIT_TRANSPORT_MOCK
     else if (strncmp(manifest->urlbuf, "test://", 7) == 0) {
-        res = suit_transport_mock_fetch(manifest);
+        res = suit_transport_mock_fetch(manifest, _storage_helper, manifest);
     }
 #endif
 #ifdef MODULE_SUIT_TRANSPORT_VFS
@@ -460,6 +568,7 @@ static int _dtv_fetch(suit_manifest_t *manifest, int key,
         return res;
     }
 
+    res = _fetch_finish(res);
     suit_component_set_flag(comp, SUIT_COMPONENT_STATE_FETCHED);
 
     if (res) {
@@ -500,7 +609,13 @@ static int _validate_payload(suit_component_t *component, const uint8_t *digest,
     uint8_t payload_digest[SHA256_DIGEST_LENGTH];
     suit_storage_t *storage = component->storage_backend;
 
-    if (suit_storage_has_readptr(storage)) {
+    if ((_fetch.comp == component) && _fetch.digested &&
+        (_fetch.next == payload_size) &&
+        suit_component_check_flag(component, SUIT_COMPONENT_STATE_FETCHED)) {
+        /* Digested while it was written */
+        memcpy(payload_digest, _fetch.digest, sizeof(payload_digest));
+    }
+    else if (suit_storage_has_readptr(storage)) {
         /* Direct read possible */
         const uint8_t *payload = NULL;
         size_t payload_len = 0;
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_suit_pipeline
+ * @{
+ *
+ * @file
+ * @brief       SUIT pipelined payload storage
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "sema.h"
+#include "thread.h"
+
+#include "suit/pipeline.h"
+
+typedef struct {
+    size_t offset;
+    size_t len;
+    bool more;
+    uint8_t buf[CONFIG_SUIT_PIPELINE_BUF_SIZE];
+} _chunk_t;
+
+static _chunk_t _chunks[CONFIG_SUIT_PIPELINE_BUF_NUMOF];
+/* the transport fills _chunks[_head], the writer thread drains _chunks[_tail],
+ * the semaphores count the free and the filled buffers */
+static unsigned _head;
+static unsigned _tail;
+static sema_t _free;
+static sema_t _filled = SEMA_CREATE_LOCKED();
+static coap_blockwise_cb_t _cb;
+static void *_arg;
+static volatile int _res;
+
+static kernel_pid_t _pid = KERNEL_PID_UNDEF;
+static char _stack[SUIT_PIPELINE_STACKSIZE];
+
+static void *_writer(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        sema_wait(&_filled);
+
+        _chunk_t *chunk = &_chunks[_tail];
+
+        /* after an error, the remaining chunks are dropped */
+        if (_res >= 0) {
+            int res = _cb(_arg, chunk->offset, chunk->buf, chunk->len,
+                          chunk->more);
+            if (res < 0) {
+                _res = res;
+            }
+        }
+        _tail = (_tail + 1) % CONFIG_SUIT_PIPELINE_BUF_NUMOF;
+        sema_post(&_free);
+    }
+
+    return NULL;
+}
+
+void suit_pipeline_start(coap_blockwise_cb_t cb, void *arg)
+{
+    _cb = cb;
+    _arg = arg;
+    _res = 0;
+    _head = 0;
+    _tail = 0;
+    sema_create(&_free, CONFIG_SUIT_PIPELINE_BUF_NUMOF);
+
+    if (_pid == KERNEL_PID_UNDEF) {
+        _pid = thread_create(_stack, sizeof(_stack), SUIT_PIPELINE_PRIO,
+                             THREAD_CREATE_STACKTEST, _writer, NULL,
+                             "suit_pipeline");
+    }
+}
+
+int suit_pipeline_put(size_t offset, const uint8_t *buf, size_t len, int more)
+{
+    do {
+        size_t chunk_len = (len > CONFIG_SUIT_PIPELINE_BUF_SIZE)
+                         ? CONFIG_SUIT_PIPELINE_BUF_SIZE : len;
+
+        sema_wait(&_free);
+        if (_res < 0) {
+            sema_post(&_free);
+            return _res;
+        }
+
+        _chunk_t *chunk = &_chunks[_head];
+
+        memcpy(chunk->buf, buf, chunk_len);
+        chunk->offset = offset;
+        chunk->len = chunk_len;
+        chunk->more = more || (chunk_len < len);
+        _head = (_head + 1) % CONFIG_SUIT_PIPELINE_BUF_NUMOF;
+        sema_post(&_filled);
+
+        offset += chunk_len;
+        buf += chunk_len;
+        len -= chunk_len;
+    } while (len);
+
+    return 0;
+}
+
+int suit_pipeline_finish(void)
+{
+    /* all buffers are free once the writer thread drained them */
+    for (unsigned i = 0; i < CONFIG_SUIT_PIPELINE_BUF_NUMOF; i++) {
+        sema_wait(&_free);
+    }
+    return _res;
+}
@@ -84,6 +84,14 @@ static int _flashwrite_write(suit_storage_t *storage,
     return riotboot_flashwrite_putbytes(&fw->writer, buf, len, 1);
 }
 
+static int _flashwrite_prepare(suit_storage_t *storage, size_t len)
+{
+    suit_storage_flashwrite_t *fw = _get_fw(storage);
+
+    return riotboot_flashwrite_erase_ahead(&fw->writer, len) <
+           0 ? SUIT_ERR_STORAGE : SUIT_OK;
+}
+
 static int _flashwrite_finish(suit_storage_t *storage,
                               const suit_manifest_t *manifest)
 {
@@ -227,6 +235,7 @@ static const suit_storage_driver_t suit_storage_flashwrite_driver = {
     .start = _flashwrite_start,
     .write = _flashwrite_write,
     .finish = _flashwrite_finish,
+    .prepare = _flashwrite_prepare,
     .read = _flashwrite_read,
     .install = _flashwrite_install,
     .has_location = _flashwrite_has_location,
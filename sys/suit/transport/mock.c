@@ -9,34 +9,45 @@
 #include <assert.h>
 #include <stdio.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "kernel_defines.h"
 #include "log.h"
 
 #include "suit.h"
-#include "suit/storage.h"
 #include "suit/transport/mock.h"
 
 /* Must be defined by the test */
 extern const suit_transport_mock_payload_t payloads[];
 extern const size_t num_payloads;
 
-static const suit_component_t *_get_component(const suit_manifest_t *manifest)
-{
-    assert(manifest->component_current < CONFIG_SUIT_COMPONENT_MAX);
-    return &manifest->components[manifest->component_current];
-}
-
-int suit_transport_mock_fetch(const suit_manifest_t *manifest)
+int suit_transport_mock_fetch(const suit_manifest_t *manifest,
+                              coap_blockwise_cb_t cb, void *ctx)
 {
     size_t file = manifest->component_current;
-    const suit_component_t *comp = _get_component(manifest);
+    const suit_transport_mock_payload_t *payload = &payloads[file];
+    size_t offset = 0;
 
     assert(file < num_payloads);
 
     LOG_INFO("Mock writing payload %d\n", (unsigned)file);
 
-    suit_storage_write(comp->storage_backend, manifest, payloads[file].buf, 0,
-                       payloads[file].len);
+    do {
+        /* the callback may modify the chunk */
+        uint8_t buf[SUIT_TRANSPORT_MOCK_CHUNK_SIZE];
+        size_t len = payload->len - offset;
+
+        if (len > sizeof(buf)) {
+            len = sizeof(buf);
+        }
+        memcpy(buf, payload->buf + offset, len);
+
+        int res = cb(ctx, offset, buf, len, offset + len < payload->len);
+        if (res < 0) {
+            return res;
+        }
+        offset += len;
+    } while (offset < payload->len);
+
     return 0;
 }
@@ -17,6 +17,8 @@
  * @}
  */
 
+#include <string.h>
+
 #include "irq.h"
 #include "tsrb.h"
 
@@ -35,6 +37,33 @@ static uint8_t _peek(tsrb_t *rb, unsigned int idx)
     return rb->buf[(rb->reads + idx) & (rb->size - 1)];
 }
 
+static size_t _min(size_t a, size_t b)
+{
+    return (a < b) ? a : b;
+}
+
+/* copies n readable bytes to dst, in at most two chunks as the data may wrap
+ * around the end of the buffer */
+static void _copy_out(const tsrb_t *rb, uint8_t *dst, size_t n)
+{
+    unsigned idx = rb->reads & (rb->size - 1);
+    size_t chunk = _min(n, rb->size - idx);
+
+    memcpy(dst, &rb->buf[idx], chunk);
+    memcpy(dst + chunk, rb->buf, n - chunk);
+}
+
+/* copies n bytes from src to the free space of the buffer, in at most two
+ * chunks as the free space may wrap around the end of the buffer */
+static void _copy_in(tsrb_t *rb, const uint8_t *src, size_t n)
+{
+    unsigned idx = rb->writes & (rb->size - 1);
+    size_t chunk = _min(n, rb->size - idx);
+
+    memcpy(&rb->buf[idx], src, chunk);
+    memcpy(rb->buf, src + chunk, n - chunk);
+}
+
 int tsrb_get_one(tsrb_t *rb)
 {
     int retval = -1;
@@ -59,38 +88,30 @@ int tsrb_peek_one(tsrb_t *rb)
 
 int tsrb_get(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        *dst++ = _pop(rb);
-        tmp--;
-    }
+    n = _min(n, rb->writes - rb->reads);
+    _copy_out(rb, dst, n);
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
 
 int tsrb_peek(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t idx = 0;
     unsigned irq_state = irq_disable();
-    unsigned int avail = tsrb_avail(rb);
-    while (idx < n && idx != avail) {
-        *dst++ = _peek(rb, idx++);
-    }
+    n = _min(n, rb->writes - rb->reads);
+    _copy_out(rb, dst, n);
     irq_restore(irq_state);
-    return idx;
+    return n;
 }
 
 int tsrb_drop(tsrb_t *rb, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_empty(rb)) {
-        _pop(rb);
-        tmp--;
-    }
+    n = _min(n, rb->writes - rb->reads);
+    rb->reads += n;
     irq_restore(irq_state);
-    return (n - tmp);
+    return n;
 }
 
 int tsrb_add_one(tsrb_t *rb, uint8_t c)
@@ -107,12 +128,50 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c)
 
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n)
 {
-    size_t tmp = n;
     unsigned irq_state = irq_disable();
-    while (tmp && !tsrb_full(rb)) {
-        _push(rb, *src++);
-        tmp--;
-    }
+    n = _min(n, rb->size - (rb->writes - rb->reads));
+    _copy_in(rb, src, n);
+    rb->writes += n;
+    irq_restore(irq_state);
+    return n;
+}
+
+size_t tsrb_read_span(tsrb_t *rb, const uint8_t **src)
+{
+    unsigned irq_state = irq_disable();
+    unsigned reads = rb->reads;
+    unsigned avail = rb->writes - reads;
+    irq_restore(irq_state);
+
+    unsigned idx = reads & (rb->size - 1);
+    *src = &rb->buf[idx];
+    return _min(avail, rb->size - idx);
+}
+
+void tsrb_read_commit(tsrb_t *rb, size_t n)
+{
+    unsigned irq_state = irq_disable();
+    assert(n <= (rb->writes - rb->reads));
+    rb->reads += n;
+    irq_restore(irq_state);
+}
+
+size_t tsrb_write_span(tsrb_t *rb, uint8_t **dst)
+{
+    unsigned irq_state = irq_disable();
+    unsigned writes = rb->writes;
+    unsigned space = rb->size - (writes - rb->reads);
+    irq_restore(irq_state);
+
+    unsigned idx = writes & (rb->size - 1);
+    *dst = &rb->buf[idx];
+    return _min(space, rb->size - idx);
+}
+
+void tsrb_write_commit(tsrb_t *rb, size_t n)
+{
+    unsigned irq_state = irq_disable();
+    assert(n <= (rb->size - (rb->writes - rb->reads)));
+    rb->writes += n;
     irq_restore(irq_state);
-    return (n - tmp);
 }
@@ -340,15 +340,8 @@ static void _handle_in(usbus_cdcacm_device_t *cdcacm,
         return;
     }
     /* copy at most CONFIG_USBUS_CDC_ACM_BULK_EP_SIZE chars from input into ep->buf */
-    unsigned old = irq_disable();
-    while (!tsrb_empty(&cdcacm->tsrb)) {
-        int c = tsrb_get_one(&cdcacm->tsrb);
-        cdcacm->in_buf[cdcacm->occupied++] = (uint8_t)c;
-        if (cdcacm->occupied >= CONFIG_USBUS_CDC_ACM_BULK_EP_SIZE) {
-            break;
-        }
-    }
-    irq_restore(old);
+    cdcacm->occupied = tsrb_get(&cdcacm->tsrb, cdcacm->in_buf,
+                                CONFIG_USBUS_CDC_ACM_BULK_EP_SIZE);
     usbdev_ep_xmit(ep, cdcacm->in_buf, cdcacm->occupied);
 }
 
@@ -281,6 +281,18 @@ static void _scsi_sense6(usbus_handler_t *handler)
     msc->state = WAIT_FOR_TRANSFER;
 }
 
+static void _scsi_sync_cache(usbus_handler_t *handler, uint8_t lun)
+{
+    usbus_msc_device_t *msc = container_of(handler, usbus_msc_device_t,
+                                           handler_ctrl);
+
+    /* write back data the MTD layer may hold back */
+    if (mtd_flush(msc->lun_dev[lun].mtd) != 0) {
+        msc->cmd.status = USB_MSC_CSW_STATUS_COMMAND_FAILED;
+    }
+    msc->state = GEN_CSW;
+}
+
 void usbus_msc_scsi_process_cmd(usbus_t *usbus, usbus_handler_t *handler,
                                 usbdev_ep_t *ep, size_t len)
 {
@@ -368,6 +380,10 @@ void usbus_msc_scsi_process_cmd(usbus_t *usbus, usbus_handler_t *handler,
         DEBUG_PUTS("TODO: SCSI_VERIFY10");
         msc->state = GEN_CSW;
         break;
+    case SCSI_SYNCHRONIZE_CACHE10:
+        DEBUG_PUTS("SCSI_SYNCHRONIZE_CACHE10");
+        _scsi_sync_cache(handler, cbw->lun);
+        break;
     default:
         DEBUG("Unhandled SCSI command:0x%x", cbw->cb[0]);
         msc->state = GEN_CSW;
@@ -14,6 +14,7 @@
  * @author  Joakim Nohlgård <joakim.nohlgard@eistec.se>
  */
 
+#include <assert.h> /* for static_assert */
 #include <errno.h> /* for error codes */
 #include <string.h> /* for strncmp */
 #include <stddef.h> /* for NULL */
@@ -23,6 +24,7 @@
 #include <fcntl.h> /* for O_ACCMODE, ..., fcntl */
 #include <unistd.h> /* for STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO */
 
+#include "bitfield.h"
 #include "container.h"
 #include "modules.h"
 #include "vfs.h"
@@ -63,6 +65,15 @@ XFA_INIT(vfs_mount_t, vfs_mountpoints_xfa);
  */
 static vfs_file_t _vfs_open_files[VFS_MAX_OPEN_FILES];
 
+/**
+ * @internal
+ * @brief Bitmap of the entries of _vfs_open_files not available to
+ *        _allocate_fd(VFS_ANY_FD)
+ *
+ * The stdio file descriptor numbers are always marked as taken.
+ */
+static BITFIELD(_vfs_fd_used, VFS_MAX_OPEN_FILES) = { 0xe0 };
+
 /**
  * @internal
  * @brief List handle for list of all currently mounted file systems
@@ -72,6 +83,15 @@ static vfs_file_t _vfs_open_files[VFS_MAX_OPEN_FILES];
  */
 static clist_node_t _vfs_mounts_list;
 
+/**
+ * @internal
+ * @brief Mounted file systems, sorted by descending length of the mount point
+ *
+ * The first mount point in this list that is a prefix of a path is the
+ * longest one. Equally long mount points are sorted newest first.
+ */
+static vfs_mount_t *_vfs_mounts_index;
+
 /**
  * @internal
  * @brief Find an unused entry in the _vfs_open_files array and mark it as used
@@ -145,6 +165,159 @@ static inline int _fd_is_valid(int fd);
 static mutex_t _mount_mutex = MUTEX_INIT;
 static mutex_t _open_mutex = MUTEX_INIT;
 
+#if IS_USED(MODULE_VFS_STAT_CACHE)
+/**
+ * @internal
+ * @brief Cached result of vfs_stat
+ */
+typedef struct {
+    vfs_mount_t *mp;                /**< Mount of the path, NULL if unused */
+    int res;                        /**< Result of the stat operation */
+    struct stat buf;                /**< Status, if res is 0 */
+    uint8_t len;                    /**< Length of path */
+    char path[CONFIG_VFS_STAT_CACHE_PATH_MAX];  /**< Absolute path */
+} _stat_cache_entry_t;
+
+static_assert(CONFIG_VFS_STAT_CACHE_PATH_MAX <= UINT8_MAX,
+              "CONFIG_VFS_STAT_CACHE_PATH_MAX must fit into _stat_cache_entry_t::len");
+
+static _stat_cache_entry_t _stat_cache[CONFIG_VFS_STAT_CACHE_SIZE];
+static unsigned _stat_cache_next;
+static mutex_t _stat_cache_mutex = MUTEX_INIT;
+
+static _stat_cache_entry_t *_stat_cache_find(vfs_mount_t *mountp, const char *path,
+                                             size_t len)
+{
+    for (unsigned i = 0; i < CONFIG_VFS_STAT_CACHE_SIZE; i++) {
+        _stat_cache_entry_t *e = &_stat_cache[i];
+        if ((e->mp == mountp) && (e->len == len) && !memcmp(e->path, path, len)) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @internal
+ * @brief Look up a cached result
+ *
+ * On a miss, @p gen is set to the generation of the mount, to be passed to
+ * _stat_cache_put() along with the result of the file system.
+ */
+static bool _stat_cache_get(vfs_mount_t *mountp, const char *path,
+                            struct stat *buf, int *res, unsigned *gen)
+{
+    size_t len = strlen(path);
+    bool found = false;
+
+    mutex_lock(&_stat_cache_mutex);
+    *gen = mountp->stat_cache_gen;
+    _stat_cache_entry_t *e = NULL;
+    if (len <= CONFIG_VFS_STAT_CACHE_PATH_MAX) {
+        e = _stat_cache_find(mountp, path, len);
+    }
+    if (e != NULL) {
+        *res = e->res;
+        *buf = e->buf;
+        found = true;
+    }
+    mutex_unlock(&_stat_cache_mutex);
+    return found;
+}
+
+/**
+ * @internal
+ * @brief Cache the result of the file system
+ *
+ * The result is dropped if the mount was modified since @p gen was taken, it
+ * may describe the state before the modification.
+ */
+static void _stat_cache_put(vfs_mount_t *mountp, const char *path,
+                            const struct stat *buf, int res, unsigned gen)
+{
+    size_t len = strlen(path);
+
+    /* only cache definite answers */
+    if ((len > CONFIG_VFS_STAT_CACHE_PATH_MAX) || ((res != 0) && (res != -ENOENT))) {
+        return;
+    }
+    mutex_lock(&_stat_cache_mutex);
+    if (gen != mountp->stat_cache_gen) {
+        mutex_unlock(&_stat_cache_mutex);
+        return;
+    }
+    _stat_cache_entry_t *e = _stat_cache_find(mountp, path, len);
+    if (e == NULL) {
+        /* replace the oldest entry */
+        e = &_stat_cache[_stat_cache_next];
+        _stat_cache_next = (_stat_cache_next + 1) % CONFIG_VFS_STAT_CACHE_SIZE;
+    }
+    e->mp = mountp;
+    e->res = res;
+    e->buf = *buf;
+    e->len = len;
+    memcpy(e->path, path, len);
+    mutex_unlock(&_stat_cache_mutex);
+}
+
+/**
+ * @internal
+ * @brief Drop all cached results of a mount
+ *
+ * Called whenever a file system was modified. The modified path is not known
+ * for writes to an open file, and renaming or removing a directory affects
+ * all paths below it, so all entries of the mount are dropped.
+ *
+ * Must be called after the file system driver returned: a vfs_stat() that
+ * starts earlier could still see and cache the old state otherwise.
+ */
+static void _stat_cache_invalidate(vfs_mount_t *mountp)
+{
+    if (mountp == NULL) {
+        return;
+    }
+    mutex_lock(&_stat_cache_mutex);
+    mountp->stat_cache_gen++;
+    for (unsigned i = 0; i < CONFIG_VFS_STAT_CACHE_SIZE; i++) {
+        if (_stat_cache[i].mp == mountp) {
+            _stat_cache[i].mp = NULL;
+        }
+    }
+    mutex_unlock(&_stat_cache_mutex);
+}
+#else
+static inline bool _stat_cache_get(vfs_mount_t *mountp, const char *path,
+                                   struct stat *buf, int *res, unsigned *gen)
+{
+    (void)mountp;
+    (void)path;
+    (void)buf;
+    (void)res;
+    *gen = 0;
+    return false;
+}
+
+static inline void _stat_cache_put(vfs_mount_t *mountp, const char *path,
+                                   const struct stat *buf, int res, unsigned gen)
+{
+    (void)mountp;
+    (void)path;
+    (void)buf;
+    (void)res;
+    (void)gen;
+}
+
+static inline void _stat_cache_invalidate(vfs_mount_t *mountp)
+{
+    (void)mountp;
+}
+#endif
+
+static inline bool _is_writable(int flags)
+{
+    return ((flags & O_ACCMODE) != O_RDONLY) || (flags & (O_CREAT | O_TRUNC));
+}
+
 int vfs_close(int fd)
 {
     DEBUG("vfs_close: %d\n", fd);
@@ -158,6 +331,9 @@ int vfs_close(int fd)
          * system driver close() call below */
         res = filp->f_op->close(filp);
     }
+    if (_is_writable(filp->flags)) {
+        _stat_cache_invalidate(filp->mp);
+    }
     _free_fd(fd);
     return res;
 }
@@ -301,13 +477,16 @@ int vfs_open(const char *name, int flags, mode_t mode)
     vfs_file_t *filp = &_vfs_open_files[fd];
     if (filp->f_op->open != NULL) {
         res = filp->f_op->open(filp, rel_path, flags, mode);
-        if (res < 0) {
-            /* something went wrong during open */
-            DEBUG("vfs_open: open: ERR %d!\n", res);
-            /* clean up */
-            _free_fd(fd);
-            return res;
-        }
+    }
+    if (_is_writable(flags)) {
+        _stat_cache_invalidate(mountp);
+    }
+    if (res < 0) {
+        /* something went wrong during open */
+        DEBUG("vfs_open: open: ERR %d!\n", res);
+        /* clean up */
+        _free_fd(fd);
+        return res;
     }
     DEBUG("vfs_open: opened %d\n", fd);
     return fd;
@@ -354,7 +533,9 @@ ssize_t vfs_write(int fd, const void *src, size_t count)
         /* driver does not implement write() */
         return -EINVAL;
     }
-    return filp->f_op->write(filp, src, count);
+    ssize_t written = filp->f_op->write(filp, src, count);
+    _stat_cache_invalidate(filp->mp);
+    return written;
 }
 
 ssize_t vfs_write_iol(int fd, const iolist_t *snips)
@@ -513,7 +694,9 @@ int vfs_format(vfs_mount_t *mountp)
 
     if (mountp->fs->fs_op != NULL) {
         if (mountp->fs->fs_op->format != NULL) {
-            return mountp->fs->fs_op->format(mountp);
+            ret = mountp->fs->fs_op->format(mountp);
+            _stat_cache_invalidate(mountp);
+            return ret;
         }
     }
 
@@ -542,6 +725,14 @@ int vfs_mount(vfs_mount_t *mountp)
     }
     /* Insert last in list. This property is relied on by vfs_iterate_mount_dirs. */
     clist_rpush(&_vfs_mounts_list, &mountp->list_entry);
+    /* Insert behind all longer mount points, an equal mount point mounted
+     * later shadows this one */
+    vfs_mount_t **prev = &_vfs_mounts_index;
+    while ((*prev != NULL) && ((*prev)->mount_point_len > mountp->mount_point_len)) {
+        prev = &(*prev)->index_next;
+    }
+    mountp->index_next = *prev;
+    *prev = mountp;
     mutex_unlock(&_mount_mutex);
     DEBUG("vfs_mount: mount done\n");
     return 0;
@@ -587,6 +778,12 @@ int vfs_umount(vfs_mount_t *mountp, bool force)
         mutex_unlock(&_mount_mutex);
         return -EINVAL;
     }
+    vfs_mount_t **prev = &_vfs_mounts_index;
+    while (*prev != mountp) {
+        prev = &(*prev)->index_next;
+    }
+    *prev = mountp->index_next;
+    _stat_cache_invalidate(mountp);
     mutex_unlock(&_mount_mutex);
     return 0;
 }
@@ -633,6 +830,7 @@ int vfs_rename(const char *from_path, const char *to_path)
         return -EXDEV;
     }
     res = mountp->fs->fs_op->rename(mountp, rel_from, rel_to);
+    _stat_cache_invalidate(mountp);
     DEBUG("vfs_rename: rename %p, \"%s\" -> \"%s\"", (void *)mountp, rel_from, rel_to);
     if (res < 0) {
         /* something went wrong during rename */
@@ -673,6 +871,7 @@ int vfs_unlink(const char *name)
         return -EROFS;
     }
     res = mountp->fs->fs_op->unlink(mountp, rel_path);
+    _stat_cache_invalidate(mountp);
     DEBUG("vfs_unlink: unlink %p, \"%s\"", (void *)mountp, rel_path);
     if (res < 0) {
         /* something went wrong during unlink */
@@ -710,6 +909,7 @@ int vfs_mkdir(const char *name, mode_t mode)
         return -EROFS;
     }
     res = mountp->fs->fs_op->mkdir(mountp, rel_path, mode);
+    _stat_cache_invalidate(mountp);
     DEBUG("vfs_mkdir: mkdir %p, \"%s\"", (void *)mountp, rel_path);
     if (res < 0) {
         /* something went wrong during mkdir */
@@ -747,6 +947,7 @@ int vfs_rmdir(const char *name)
         return -EROFS;
     }
     res = mountp->fs->fs_op->rmdir(mountp, rel_path);
+    _stat_cache_invalidate(mountp);
     DEBUG("vfs_rmdir: rmdir %p, \"%s\"", (void *)mountp, rel_path);
     if (res < 0) {
         /* something went wrong during rmdir */
@@ -783,8 +984,12 @@ int vfs_stat(const char *restrict path, struct stat *restrict buf)
         atomic_fetch_sub(&mountp->open_files, 1);
         return -EPERM;
     }
-    memset(buf, 0, sizeof(*buf));
-    res = mountp->fs->fs_op->stat(mountp, rel_path, buf);
+    unsigned gen;
+    if (!_stat_cache_get(mountp, path, buf, &res, &gen)) {
+        memset(buf, 0, sizeof(*buf));
+        res = mountp->fs->fs_op->stat(mountp, rel_path, buf);
+        _stat_cache_put(mountp, path, buf, res, gen);
+    }
     /* remember to decrement the open_files count */
     atomic_fetch_sub(&mountp->open_files, 1);
     return res;
@@ -983,20 +1188,18 @@ const vfs_file_t *vfs_file_get(int fd)
 static inline int _allocate_fd(int fd)
 {
     if (fd < 0) {
-        for (fd = 0; fd < VFS_MAX_OPEN_FILES; ++fd) {
-            if ((fd == STDIN_FILENO) || (fd == STDOUT_FILENO) || (fd == STDERR_FILENO)) {
-                /* Do not auto-allocate the stdio file descriptor numbers to
-                 * avoid conflicts between normal file system users and stdio
-                 * drivers such as stdio_uart, stdio_rtt which need to be able
-                 * to bind to these specific file descriptor numbers. */
-                continue;
-            }
-            if (_vfs_open_files[fd].pid == KERNEL_PID_UNDEF) {
-                break;
-            }
+        /* The stdio file descriptor numbers are never auto-allocated, they are
+         * always set in _vfs_fd_used. This avoids conflicts between normal
+         * file system users and stdio drivers such as stdio_uart, stdio_rtt
+         * which need to be able to bind to these specific file descriptor
+         * numbers. */
+        fd = bf_get_unset(_vfs_fd_used, VFS_MAX_OPEN_FILES);
+        if (fd < 0) {
+            /* The _vfs_open_files array is full */
+            return -ENFILE;
         }
     }
-    if (fd >= VFS_MAX_OPEN_FILES) {
+    else if (fd >= VFS_MAX_OPEN_FILES) {
         /* The _vfs_open_files array is full */
         return -ENFILE;
     }
@@ -1004,6 +1207,9 @@ static inline int _allocate_fd(int fd)
         /* The desired fd is already in use */
         return -EEXIST;
     }
+    else if (fd > STDERR_FILENO) {
+        bf_set_atomic(_vfs_fd_used, fd);
+    }
     kernel_pid_t pid = thread_getpid();
     if (pid == KERNEL_PID_UNDEF) {
         /* This happens when calling vfs_bind during boot, before threads have
@@ -1021,6 +1227,9 @@ static inline void _free_fd(int fd)
         atomic_fetch_sub(&_vfs_open_files[fd].mp->open_files, 1);
     }
     _vfs_open_files[fd].pid = KERNEL_PID_UNDEF;
+    if (fd > STDERR_FILENO) {
+        bf_unset_atomic(_vfs_fd_used, fd);
+    }
 }
 
 static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *mountp, int flags, void *private_data)
@@ -1041,41 +1250,25 @@ static inline int _init_fd(int fd, const vfs_file_ops_t *f_op, vfs_mount_t *moun
 static inline int _find_mount(vfs_mount_t **mountpp, const char *name, const char **rel_path)
 {
     size_t longest_match = 0;
-    size_t name_len = strlen(name);
     mutex_lock(&_mount_mutex);
 
-    clist_node_t *node = _vfs_mounts_list.next;
-    if (node == NULL) {
-        /* list empty */
-        mutex_unlock(&_mount_mutex);
-        return -ENOENT;
-    }
-    vfs_mount_t *mountp = NULL;
-    do {
-        node = node->next;
-        vfs_mount_t *it = container_of(node, vfs_mount_t, list_entry);
-        size_t len = it->mount_point_len;
-        if (len < longest_match) {
-            /* Already found a longer prefix */
-            continue;
-        }
-        if (len > name_len) {
-            /* path name is shorter than the mount point name */
+    vfs_mount_t *mountp = _vfs_mounts_index;
+    for (; mountp != NULL; mountp = mountp->index_next) {
+        size_t len = mountp->mount_point_len;
+        if (strncmp(name, mountp->mount_point, len) != 0) {
+            /* mount_point is not a prefix of name */
             continue;
         }
-        if ((len > 1) && (name[len] != '/') && (name[len] != '\0')) {
-            /* name does not have a directory separator where mount point name ends */
-            continue;
+        /* special check for mount_point == "/" */
+        if (len == 1) {
+            break;
         }
-        if (strncmp(name, it->mount_point, len) == 0) {
-            /* mount_point is a prefix of name */
-            /* special check for mount_point == "/" */
-            if (len > 1) {
-                longest_match = len;
-            }
-            mountp = it;
+        if ((name[len] == '/') || (name[len] == '\0')) {
+            /* name has a directory separator where mount point name ends */
+            longest_match = len;
+            break;
         }
-    } while (node != _vfs_mounts_list.next);
+    }
     if (mountp == NULL) {
         /* not found */
         mutex_unlock(&_mount_mutex);
@@ -112,11 +112,182 @@ bool ztimer_release(ztimer_clock_t *clock)
 }
 #endif /* MODULE_ZTIMER_ONDEMAND */
 
+static inline bool _uses_heap(const ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_HEAP
+    return clock->heap;
+#else
+    (void)clock;
+    return false;
+#endif
+}
+
+#if MODULE_ZTIMER_HEAP
+static inline uint64_t _heap_key(const ztimer_base_t *entry)
+{
+    return ((uint64_t)entry->epoch << 32) | entry->offset;
+}
+
+static inline uint64_t _heap_now(const ztimer_clock_t *clock)
+{
+    return ((uint64_t)clock->epoch << 32) | clock->list.offset;
+}
+
+static void _heap_advance(ztimer_clock_t *clock, uint32_t diff)
+{
+    uint32_t old_base = clock->list.offset;
+
+    clock->list.offset += diff;
+    if (clock->list.offset < old_base) {
+        clock->epoch++;
+    }
+}
+
+/* links the heaps @p a and @p b, returns the new root. The caller is
+ * responsible for the root's next and prev pointers. */
+static ztimer_base_t *_heap_meld(ztimer_base_t *a, ztimer_base_t *b)
+{
+    if (_heap_key(b) < _heap_key(a)) {
+        ztimer_base_t *tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    b->prev = a;
+    b->next = a->child;
+    if (b->next) {
+        b->next->prev = b;
+    }
+    a->child = b;
+
+    return a;
+}
+
+/* two-pass pairing of a sibling list, returns the new root */
+static ztimer_base_t *_heap_merge_pairs(ztimer_base_t *first)
+{
+    ztimer_base_t *pairs = NULL;
+
+    /* first pass: meld pairs left to right, collecting them in reverse */
+    while (first) {
+        ztimer_base_t *a = first;
+        ztimer_base_t *b = a->next;
+
+        if (b) {
+            first = b->next;
+            a = _heap_meld(a, b);
+        }
+        else {
+            first = NULL;
+        }
+        a->next = pairs;
+        pairs = a;
+    }
+
+    if (!pairs) {
+        return NULL;
+    }
+
+    /* second pass: meld right to left into a single heap */
+    ztimer_base_t *root = pairs;
+
+    pairs = pairs->next;
+    while (pairs) {
+        ztimer_base_t *next = pairs->next;
+        root = _heap_meld(root, pairs);
+        pairs = next;
+    }
+    root->next = NULL;
+
+    return root;
+}
+
+static void _heap_set_root(ztimer_clock_t *clock, ztimer_base_t *root)
+{
+    clock->list.next = root;
+    if (root) {
+        /* the root's prev pointer marks it as set */
+        root->prev = &clock->list;
+        root->next = NULL;
+    }
+}
+
+static void _heap_add(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    uint64_t target = _heap_now(clock) + entry->offset;
+
+    entry->offset = (uint32_t)target;
+    entry->epoch = target >> 32;
+    entry->child = NULL;
+    entry->next = NULL;
+
+    if (clock->list.next) {
+        _heap_set_root(clock, _heap_meld(clock->list.next, entry));
+    }
+    else {
+        _heap_set_root(clock, entry);
+    }
+}
+
+static void _heap_del(ztimer_clock_t *clock, ztimer_base_t *entry)
+{
+    ztimer_base_t *subtree = _heap_merge_pairs(entry->child);
+
+    if (entry == clock->list.next) {
+        _heap_set_root(clock, subtree);
+    }
+    else {
+        /* unlink from parent (if leftmost child) or left sibling */
+        if (entry->prev->child == entry) {
+            entry->prev->child = entry->next;
+        }
+        else {
+            entry->prev->next = entry->next;
+        }
+        if (entry->next) {
+            entry->next->prev = entry->prev;
+        }
+        if (subtree) {
+            _heap_set_root(clock, _heap_meld(clock->list.next, subtree));
+        }
+    }
+
+    /* reset the entry's pointers so _is_set() considers it unset */
+    entry->next = NULL;
+    entry->prev = NULL;
+    entry->child = NULL;
+}
+
+void ztimer_clock_use_heap(ztimer_clock_t *clock)
+{
+    assert(!clock->list.next);
+    clock->heap = true;
+}
+#endif /* MODULE_ZTIMER_HEAP */
+
+/* returns the offset of the first timer relative to clock->list.offset */
+static uint32_t _head_offset(const ztimer_clock_t *clock)
+{
+#if MODULE_ZTIMER_HEAP
+    if (_uses_heap(clock)) {
+        uint64_t target = _heap_key(clock->list.next);
+        uint64_t now = _heap_now(clock);
+        return (target > now) ? (uint32_t)(target - now) : 0;
+    }
+#endif
+    return clock->list.next->offset;
+}
+
 static unsigned _is_set(const ztimer_clock_t *clock, const ztimer_t *t)
 {
     if (!clock->list.next) {
         return 0;
     }
+#if MODULE_ZTIMER_HEAP
+    else if (_uses_heap(clock)) {
+        return t->base.prev != NULL;
+    }
+#endif
     else {
         return (t->base.next || &t->base == clock->last);
     }
@@ -235,6 +406,15 @@ static void _add_entry_to_list(ztimer_clock_t *clock, ztimer_base_t *entry)
     }
 #endif
 
+#if MODULE_ZTIMER_HEAP
+    if (_uses_heap(clock)) {
+        _heap_add(clock, entry);
+        DEBUG("_add_entry_to_list() %p heap target %" PRIu32 "\n",
+              (void *)entry, entry->offset);
+        return;
+    }
+#endif
+
     /* Jump past all entries which are set to an earlier target than the new entry */
     while (list->next) {
         ztimer_base_t *list_entry = list->next;
@@ -302,6 +482,13 @@ static uint32_t _ztimer_update_head_offset(ztimer_clock_t *clock)
     DEBUG(
         "clock %p: _ztimer_update_head_offset(): diff=%" PRIu32 " old head %p\n",
         (void *)clock, diff, (void *)entry);
+#if MODULE_ZTIMER_HEAP
+    if (_uses_heap(clock)) {
+        /* heap entries store absolute targets, only the base moves */
+        _heap_advance(clock, diff);
+        return now;
+    }
+#endif
     if (entry) {
         do {
             if (diff <= entry->offset) {
@@ -343,27 +530,36 @@ static bool _del_entry_from_list(ztimer_clock_t *clock, ztimer_base_t *entry)
 
     assert(_is_set(clock, (ztimer_t *)entry));
 
-    while (list->next) {
-        ztimer_base_t *list_entry = list->next;
-        if (list_entry == entry) {
-            if (entry == clock->last) {
-                /* if entry was the last timer, set the clocks last to the
-                 * previous entry, or NULL if that was the list ptr */
-                clock->last = (list == &clock->list) ? NULL : list;
-            }
+#if MODULE_ZTIMER_HEAP
+    if (_uses_heap(clock)) {
+        _heap_del(clock, entry);
+        was_removed = true;
+    }
+    else
+#endif
+    {
+        while (list->next) {
+            ztimer_base_t *list_entry = list->next;
+            if (list_entry == entry) {
+                if (entry == clock->last) {
+                    /* if entry was the last timer, set the clocks last to the
+                     * previous entry, or NULL if that was the list ptr */
+                    clock->last = (list == &clock->list) ? NULL : list;
+                }
 
-            list->next = entry->next;
-            if (list->next) {
-                list_entry = list->next;
-                list_entry->offset += entry->offset;
-            }
+                list->next = entry->next;
+                if (list->next) {
+                    list_entry = list->next;
+                    list_entry->offset += entry->offset;
+                }
 
-            was_removed = true;
-            /* reset the entry's next pointer so _is_set() considers it unset */
-            entry->next = NULL;
-            break;
+                was_removed = true;
+                /* reset the entry's next pointer so _is_set() considers it unset */
+                entry->next = NULL;
+                break;
+            }
+            list = list->next;
         }
-        list = list->next;
     }
 
 #if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
@@ -381,6 +577,22 @@ static ztimer_t *_now_next(ztimer_clock_t *clock)
 {
     ztimer_base_t *entry = clock->list.next;
 
+#if MODULE_ZTIMER_HEAP
+    if (_uses_heap(clock)) {
+        if (entry && (_head_offset(clock) == 0)) {
+            _heap_del(clock, entry);
+#if MODULE_PM_LAYERED && !MODULE_ZTIMER_ONDEMAND
+            if (!clock->list.next &&
+                clock->block_pm_mode != ZTIMER_CLOCK_NO_REQUIRED_PM_MODE) {
+                pm_unblock(clock->block_pm_mode);
+            }
+#endif
+            return (ztimer_t *)entry;
+        }
+        return NULL;
+    }
+#endif
+
     if (entry && (entry->offset == 0)) {
         clock->list.next = entry->next;
         if (!entry->next) {
@@ -409,7 +621,7 @@ static void _ztimer_update(ztimer_clock_t *clock)
     if (clock->max_value < UINT32_MAX) {
         if (clock->list.next) {
             clock->ops->set(clock,
-                            _min_u32(clock->list.next->offset,
+                            _min_u32(_head_offset(clock),
                                      clock->max_value >> 1));
         }
         else {
@@ -421,7 +633,7 @@ static void _ztimer_update(ztimer_clock_t *clock)
     }
     else {
         if (clock->list.next) {
-            clock->ops->set(clock, clock->list.next->offset);
+            clock->ops->set(clock, _head_offset(clock));
         }
         else {
             if (IS_USED(MODULE_ZTIMER_NOW64)) {
@@ -451,7 +663,7 @@ void ztimer_handler(ztimer_clock_t *clock)
         uint32_t now = ztimer_now(clock);
 
         if (clock->list.next) {
-            uint32_t target = clock->list.offset + clock->list.next->offset;
+            uint32_t target = clock->list.offset + _head_offset(clock);
             int32_t diff = (int32_t)(target - now);
             if (diff > 0) {
                 DEBUG("ztimer_handler(): %p postponing by %" PRIi32 "\n",
@@ -476,8 +688,16 @@ void ztimer_handler(ztimer_clock_t *clock)
 #endif
 
     if (clock->list.next) {
-        clock->list.offset += clock->list.next->offset;
-        clock->list.next->offset = 0;
+#if MODULE_ZTIMER_HEAP
+        if (_uses_heap(clock)) {
+            _heap_advance(clock, _head_offset(clock));
+        }
+        else
+#endif
+        {
+            clock->list.offset += clock->list.next->offset;
+            clock->list.next->offset = 0;
+        }
 
         ztimer_t *entry = _now_next(clock);
         while (entry) {
@@ -520,6 +740,18 @@ static void _ztimer_print(const ztimer_clock_t *clock)
     const ztimer_base_t *entry = &clock->list;
     uint32_t last_offset = 0;
 
+#if MODULE_ZTIMER_HEAP
+    if (_uses_heap(clock)) {
+        printf("heap base %" PRIu32 " root %p", clock->list.offset,
+               (void *)clock->list.next);
+        if (clock->list.next) {
+            printf(" in %" PRIu32, _head_offset(clock));
+        }
+        puts("");
+        return;
+    }
+#endif
+
     do {
         printf("0x%08x:%" PRIu32 "(%" PRIu32 ")%s", (unsigned)entry,
                entry->offset, entry->offset +
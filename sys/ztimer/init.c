@@ -350,6 +350,12 @@ void ztimer_init(void)
 #  else
     LOG_DEBUG("ztimer_init(): ZTIMER_USEC without conversion\n");
 #  endif
+#  if MODULE_ZTIMER_HEAP
+    if (IS_ACTIVE(CONFIG_ZTIMER_USEC_HEAP)) {
+        LOG_DEBUG("ztimer_init(): ZTIMER_USEC using pairing heap\n");
+        ztimer_clock_use_heap(ZTIMER_USEC);
+    }
+#  endif
 
     /* warm-up time if set and needed */
     if (IS_USED(MODULE_ZTIMER_AUTO_ADJUST) &&
@@ -402,6 +408,12 @@ void ztimer_init(void)
     ztimer_convert_frac_init(&_ztimer_convert_frac_msec, ZTIMER_MSEC_BASE,
                              FREQ_1KHZ, ZTIMER_MSEC_CONVERT_LOWER_FREQ);
 #  endif
+#  if MODULE_ZTIMER_HEAP
+    if (IS_ACTIVE(CONFIG_ZTIMER_MSEC_HEAP)) {
+        LOG_DEBUG("ztimer_init(): ZTIMER_MSEC using pairing heap\n");
+        ztimer_clock_use_heap(ZTIMER_MSEC);
+    }
+#  endif
 #  ifdef CONFIG_ZTIMER_MSEC_ADJUST
     LOG_DEBUG("ztimer_init(): ZTIMER_MSEC setting adjust value to %i\n",
               CONFIG_ZTIMER_MSEC_ADJUST);
@@ -416,5 +428,11 @@ void ztimer_init(void)
     ztimer_convert_frac_init(&_ztimer_convert_frac_sec, ZTIMER_SEC_BASE,
                              FREQ_1HZ, ZTIMER_SEC_CONVERT_LOWER_FREQ);
 #  endif
+#  if MODULE_ZTIMER_HEAP
+    if (IS_ACTIVE(CONFIG_ZTIMER_SEC_HEAP)) {
+        LOG_DEBUG("ztimer_init(): ZTIMER_SEC using pairing heap\n");
+        ztimer_clock_use_heap(ZTIMER_SEC);
+    }
+#  endif
 #endif
 }
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Route look-up benchmark for the NIB forwarding table
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef LOOKUPS
+#define LOOKUPS     (10000U)
+#endif
+
+#define IFACE       (6)
+
+static const unsigned _numof_routes[] = { 16, 256, 4096 };
+
+static const ipv6_addr_t _next_hop = { {
+    0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+} };
+
+/* even routes n are 2001:db8:<n>::/48, odd routes n are the more specific
+ * 2001:db8:<n - 1>:<n>::/64 */
+static void _route(ipv6_addr_t *addr, unsigned *len, unsigned n)
+{
+    unsigned base = n & ~1U;
+
+    ipv6_addr_from_str(addr, "2001:db8::");
+    addr->u8[4] = (base >> 8) & 0xff;
+    addr->u8[5] = base & 0xff;
+    *len = 48;
+    if (n & 1) {
+        addr->u8[6] = (n >> 8) & 0xff;
+        addr->u8[7] = n & 0xff;
+        *len = 64;
+    }
+}
+
+/* returns a destination address covered by route n */
+static void _dst(ipv6_addr_t *addr, unsigned n)
+{
+    unsigned len;
+
+    _route(addr, &len, n);
+    addr->u8[15] = (n & 0xff) | 1;
+}
+
+int main(void)
+{
+    unsigned added = 0;
+
+    puts("NIB forwarding table look-up benchmark");
+    printf("table size: %u, trie: %s\n", CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF,
+           IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_OFFL_TRIE) ? "yes" : "no");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_numof_routes); i++) {
+        const unsigned numof = _numof_routes[i];
+        gnrc_ipv6_nib_ft_t fte;
+        ipv6_addr_t dst;
+        uint32_t start, diff;
+
+        if (numof > CONFIG_GNRC_IPV6_NIB_OFFL_NUMOF) {
+            break;
+        }
+        for (; added < numof; added++) {
+            unsigned len;
+
+            _route(&dst, &len, added);
+            expect(gnrc_ipv6_nib_ft_add(&dst, len, &_next_hop, IFACE, 0) == 0);
+        }
+
+        /* sanity check: most specific route wins */
+        _dst(&dst, numof - 1);
+        expect(gnrc_ipv6_nib_ft_get(&dst, NULL, &fte) == 0);
+        expect(ipv6_addr_match_prefix(&fte.dst, &dst) >= fte.dst_len);
+        expect(fte.dst_len == 64);
+
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned n = 0; n < LOOKUPS; n++) {
+            _dst(&dst, (n * 7919) % numof);
+            gnrc_ipv6_nib_ft_get(&dst, NULL, &fte);
+        }
+        diff = ztimer_now(ZTIMER_USEC) - start;
+
+        printf("%4u routes: %u look-ups in %" PRIu32 " us (%" PRIu32 " ns/look-up)\n",
+               numof, LOOKUPS, diff, (uint32_t)(((uint64_t)diff * 1000) / LOOKUPS));
+    }
+
+    puts("done.");
+
+    return 0;
+}
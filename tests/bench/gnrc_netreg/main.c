@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Demultiplexing benchmark for the GNRC network protocol registry
+ *
+ * Measures the cost of finding all receivers of a packet, as done by
+ * @ref gnrc_netapi_dispatch_receive(), depending on the number of registered
+ * entries (e.g. bound UDP sockets).
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "msg.h"
+#include "net/gnrc/netreg.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef LOOKUPS
+#define LOOKUPS     (10000U)
+#endif
+
+/* entries are registered to ephemeral UDP ports */
+#define PORT_BASE   (49152U)
+#define TYPE        (GNRC_NETTYPE_UNDEF)
+
+static const unsigned _numof_entries[] = { 1, 16, 64, 256 };
+
+static gnrc_netreg_entry_t _entries[256];
+static gnrc_netreg_entry_t _second;
+static msg_t _msg_queue[2];
+
+static unsigned _demux(uint32_t port)
+{
+    unsigned numof = 0;
+
+    gnrc_netreg_acquire_shared();
+    for (gnrc_netreg_entry_t *e = gnrc_netreg_lookup(TYPE, port); e != NULL;
+         e = gnrc_netreg_getnext(e)) {
+        numof++;
+    }
+    gnrc_netreg_release_shared();
+
+    return numof;
+}
+
+int main(void)
+{
+    unsigned added = 0;
+
+    msg_init_queue(_msg_queue, ARRAY_SIZE(_msg_queue));
+
+    puts("netreg demultiplexing benchmark");
+    printf("hash table: %s\n", IS_USED(MODULE_GNRC_NETREG_HASH) ? "yes" : "no");
+
+    gnrc_netreg_init();
+    /* the first port has a second receiver */
+    gnrc_netreg_entry_init_pid(&_second, PORT_BASE, thread_getpid());
+    expect(gnrc_netreg_register(TYPE, &_second) == 0);
+    for (unsigned i = 0; i < ARRAY_SIZE(_numof_entries); i++) {
+        const unsigned numof = _numof_entries[i];
+        uint32_t start, hit, miss;
+
+        for (; added < numof; added++) {
+            gnrc_netreg_entry_init_pid(&_entries[added], PORT_BASE + added,
+                                       thread_getpid());
+            expect(gnrc_netreg_register(TYPE, &_entries[added]) == 0);
+        }
+        expect(_demux(PORT_BASE) == 2);
+        expect(_demux(PORT_BASE + numof) == 0);
+
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned n = 0; n < LOOKUPS; n++) {
+            _demux(PORT_BASE + ((n * 7919) % numof));
+        }
+        hit = ztimer_now(ZTIMER_USEC) - start;
+
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned n = 0; n < LOOKUPS; n++) {
+            _demux(PORT_BASE + numof + (n % 1024));
+        }
+        miss = ztimer_now(ZTIMER_USEC) - start;
+
+        printf("%3u entries: %" PRIu32 " ns/hit, %" PRIu32 " ns/miss\n", numof,
+               (uint32_t)(((uint64_t)hit * 1000) / LOOKUPS),
+               (uint32_t)(((uint64_t)miss * 1000) / LOOKUPS));
+    }
+
+    puts("done.");
+
+    return 0;
+}
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       GNRC TCP bulk transfer throughput benchmark
+ *
+ * The host is the peer: `bench_send` connects to a host server and sends,
+ * `bench_recv` accepts a connection from the host and receives.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "msg.h"
+#include "net/af.h"
+#include "net/gnrc/tcp.h"
+#include "shell.h"
+#include "ztimer.h"
+
+#define MAIN_QUEUE_SIZE     (8)
+#define BUFFER_SIZE         (8192)
+
+/* send and receive with a 10s timeout, so a stalled transfer ends */
+#define TIMEOUT_MS          (10U * MS_PER_SEC)
+
+static msg_t _main_msg_queue[MAIN_QUEUE_SIZE];
+static gnrc_tcp_tcb_t _tcb;
+static gnrc_tcp_tcb_queue_t _queue = GNRC_TCP_TCB_QUEUE_INIT;
+static uint8_t _buf[BUFFER_SIZE];
+
+static void _print_result(const char *what, size_t bytes, uint32_t start)
+{
+    uint32_t ms = ztimer_now(ZTIMER_MSEC) - start;
+
+    if (ms == 0) {
+        ms = 1;
+    }
+    printf("%s %u bytes in %" PRIu32 " ms: %" PRIu32 " kB/s\n",
+           what, (unsigned)bytes, ms, (uint32_t)(bytes / ms));
+}
+
+static int _bench_send(int argc, char **argv)
+{
+    gnrc_tcp_ep_t remote;
+    size_t total;
+    size_t sent = 0;
+    uint32_t start;
+    int res;
+
+    if (argc < 3) {
+        printf("usage: %s <[addr%%netif]:port> <bytes>\n", argv[0]);
+        return 1;
+    }
+    if (gnrc_tcp_ep_from_str(&remote, argv[1]) < 0) {
+        puts("invalid endpoint");
+        return 1;
+    }
+    total = atol(argv[2]);
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = '0' + (i % 10);
+    }
+
+    gnrc_tcp_tcb_init(&_tcb);
+    res = gnrc_tcp_open(&_tcb, &remote, 0);
+    if (res < 0) {
+        printf("gnrc_tcp_open: %d\n", res);
+        return 1;
+    }
+
+    start = ztimer_now(ZTIMER_MSEC);
+    while (sent < total) {
+        size_t len = ((total - sent) < sizeof(_buf)) ? (total - sent) : sizeof(_buf);
+        ssize_t ret = gnrc_tcp_send(&_tcb, _buf, len, TIMEOUT_MS);
+
+        if (ret <= 0) {
+            printf("gnrc_tcp_send: %d\n", (int)ret);
+            break;
+        }
+        sent += ret;
+    }
+    _print_result("sent", sent, start);
+    gnrc_tcp_close(&_tcb);
+    return (sent == total) ? 0 : 1;
+}
+
+static int _bench_recv(int argc, char **argv)
+{
+    gnrc_tcp_ep_t local;
+    gnrc_tcp_tcb_t *tcb = NULL;
+    size_t total;
+    size_t rcvd = 0;
+    uint32_t start;
+    int res;
+
+    if (argc < 3) {
+        printf("usage: %s <port> <bytes>\n", argv[0]);
+        return 1;
+    }
+    gnrc_tcp_ep_init(&local, AF_INET6, NULL, 0, atoi(argv[1]), 0);
+    total = atol(argv[2]);
+
+    gnrc_tcp_tcb_init(&_tcb);
+    res = gnrc_tcp_listen(&_queue, &_tcb, 1, &local);
+    if (res < 0) {
+        printf("gnrc_tcp_listen: %d\n", res);
+        return 1;
+    }
+    puts("listening");
+
+    res = gnrc_tcp_accept(&_queue, &tcb, GNRC_TCP_NO_TIMEOUT);
+    if (res < 0) {
+        printf("gnrc_tcp_accept: %d\n", res);
+        gnrc_tcp_stop_listen(&_queue);
+        return 1;
+    }
+
+    start = ztimer_now(ZTIMER_MSEC);
+    while (rcvd < total) {
+        ssize_t ret = gnrc_tcp_recv(tcb, _buf, sizeof(_buf), TIMEOUT_MS);
+
+        if (ret <= 0) {
+            printf("gnrc_tcp_recv: %d\n", (int)ret);
+            break;
+        }
+        rcvd += ret;
+    }
+    _print_result("received", rcvd, start);
+    gnrc_tcp_close(tcb);
+    gnrc_tcp_stop_listen(&_queue);
+    return (rcvd == total) ? 0 : 1;
+}
+
+static const shell_command_t _commands[] = {
+    { "bench_send", "send bytes to a host server", _bench_send },
+    { "bench_recv", "receive bytes from a host client", _bench_recv },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    msg_init_queue(_main_msg_queue, MAIN_QUEUE_SIZE);
+
+    puts("gnrc_tcp throughput benchmark");
+    printf("retransmit queue: %u, out-of-order queue: %u, window: %u\n",
+           CONFIG_GNRC_TCP_RETRANSMIT_QUEUE_SIZE,
+           CONFIG_GNRC_TCP_RCV_OOO_QUEUE_SIZE,
+           CONFIG_GNRC_TCP_DEFAULT_WINDOW);
+    printf("congestion control: %s\n",
+           IS_USED(MODULE_GNRC_TCP_CONGURE_RENO) ? "reno" :
+           IS_USED(MODULE_GNRC_TCP_CONGURE_QUIC) ? "quic" : "none");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
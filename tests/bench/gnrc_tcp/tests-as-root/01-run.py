@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2023 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import re
+import socket
+import sys
+import threading
+
+from testrunner import run
+
+TRANSFER_SIZE = 1024 * 1024
+PORT = 8080
+
+
+def get_host_address():
+    # Use the bridge the tap device is part of, if there is one
+    tap = os.environ["TAPDEV"]
+    bridge = re.search('master (.*) state',
+                       os.popen('bridge link show dev {}'.format(tap)).read())
+    interface = bridge.group(1).strip() if bridge else tap
+    addr = re.search('inet6 (.*)/64',
+                     os.popen('ip addr show dev {} scope link'.format(interface)).read())
+    return addr.group(1).strip(), interface
+
+
+def get_riot_netif(child):
+    child.sendline('ifconfig')
+    child.expect(r'Iface\s+(\d+)\s')
+    return child.match.group(1).strip()
+
+
+def get_riot_address(child):
+    child.sendline('ifconfig')
+    child.expect(r'(fe80:[0-9a-f:]+)\s')
+    return child.match.group(1).strip()
+
+
+def host_receive(sock, result):
+    conn, _ = sock.accept()
+    rcvd = 0
+    while True:
+        data = conn.recv(65536)
+        if not data:
+            break
+        rcvd += len(data)
+    conn.close()
+    result.append(rcvd)
+
+
+def test_send(child):
+    addr, _ = get_host_address()
+    netif = get_riot_netif(child)
+    result = []
+    with socket.socket(socket.AF_INET6, socket.SOCK_STREAM) as sock:
+        sock.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        sock.bind(('::', PORT))
+        sock.listen(1)
+        thread = threading.Thread(target=host_receive, args=(sock, result))
+        thread.start()
+        child.sendline('bench_send [{}%{}]:{} {}'.format(addr, netif, PORT, TRANSFER_SIZE))
+        child.expect(r'sent (\d+) bytes in \d+ ms: \d+ kB/s', timeout=120)
+        assert int(child.match.group(1)) == TRANSFER_SIZE
+        thread.join(timeout=30)
+    assert result == [TRANSFER_SIZE]
+
+
+def test_recv(child):
+    riot_addr = get_riot_address(child)
+    _, interface = get_host_address()
+    child.sendline('bench_recv {} {}'.format(PORT, TRANSFER_SIZE))
+    child.expect_exact('listening')
+    with socket.create_connection((riot_addr + '%' + interface, PORT)) as sock:
+        sock.sendall(b'0123456789' * (TRANSFER_SIZE // 10) +
+                     b'0' * (TRANSFER_SIZE % 10))
+        child.expect(r'received (\d+) bytes in \d+ ms: \d+ kB/s', timeout=120)
+        assert int(child.match.group(1)) == TRANSFER_SIZE
+
+
+def testfunc(child):
+    child.expect_exact('gnrc_tcp throughput benchmark')
+    child.expect(r'retransmit queue: \d+, out-of-order queue: \d+, window: \d+')
+    child.expect(r'congestion control: (reno|quic|none)')
+    test_send(child)
+    test_recv(child)
+
+
+if __name__ == '__main__':
+    sys.exit(run(testfunc, timeout=10))
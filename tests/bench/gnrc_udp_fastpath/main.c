@@ -0,0 +1,238 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Receive benchmark for UDP sockets over GNRC
+ *
+ * A mocked Ethernet device hands out the same UDP datagram for every
+ * receive event. `latency` is the time from the device interrupt until
+ * @ref sock_udp_recv() returns the datagram, `burst` the time per datagram
+ * when the device reports @ref BURST datagrams per interrupt. Compare builds
+ * with and without module `gnrc_udp_fastpath`.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "iolist.h"
+#include "kernel_defines.h"
+#include "net/ethernet.h"
+#include "net/gnrc.h"
+#include "net/gnrc/ipv6/nib.h"
+#include "net/gnrc/netif/ethernet.h"
+#include "net/inet_csum.h"
+#include "net/ipv6/hdr.h"
+#include "net/netdev_test.h"
+#include "net/protnum.h"
+#include "net/sock/udp.h"
+#include "net/udp.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+#include "ztimer.h"
+
+#ifndef ROUNDS
+#define ROUNDS          (1000U)
+#endif
+
+/* datagrams per interrupt, must fit into the mbox of the socket */
+#ifndef BURST
+#define BURST           (GNRC_SOCK_MBOX_SIZE)
+#endif
+
+#define PORT            (5683U)
+#define MAX_PAYLOAD     (1024U)
+
+static const unsigned _payload_sizes[] = { 16, 64, 256, MAX_PAYLOAD };
+
+static const uint8_t _mac[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+static const uint8_t _nbr_mac[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 };
+static const ipv6_addr_t _nbr_link_local = {
+    .u8 = { 0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x02 }
+};
+
+static netdev_test_t _netdev;
+static gnrc_netif_t _netif;
+static char _netif_stack[THREAD_STACKSIZE_DEFAULT];
+
+static uint8_t _frame[sizeof(ethernet_hdr_t) + sizeof(ipv6_hdr_t) +
+                      sizeof(udp_hdr_t) + MAX_PAYLOAD];
+static size_t _frame_len;
+static unsigned _burst;
+static sock_udp_t _sock;
+static uint8_t _buf[MAX_PAYLOAD];
+
+static int _get_device_type(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = NETDEV_TYPE_ETHERNET;
+    return sizeof(uint16_t);
+}
+
+static int _get_max_packet_size(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len == sizeof(uint16_t));
+    *((uint16_t *)value) = ETHERNET_DATA_LEN;
+    return sizeof(uint16_t);
+}
+
+static int _get_address(netdev_t *dev, void *value, size_t max_len)
+{
+    (void)dev;
+    expect(max_len >= sizeof(_mac));
+    memcpy(value, _mac, sizeof(_mac));
+    return sizeof(_mac);
+}
+
+static int _send(netdev_t *dev, const iolist_t *iolist)
+{
+    (void)dev;
+    /* discard neighbor discovery */
+    return iolist_size(iolist);
+}
+
+static int _recv(netdev_t *dev, char *buf, int len, void *info)
+{
+    (void)dev;
+    (void)info;
+    if (buf == NULL) {
+        return _frame_len;
+    }
+    expect((size_t)len >= _frame_len);
+    memcpy(buf, _frame, _frame_len);
+    return _frame_len;
+}
+
+static void _isr(netdev_t *dev)
+{
+    for (unsigned i = 0; i < _burst; i++) {
+        dev->event_callback(dev, NETDEV_EVENT_RX_COMPLETE);
+    }
+}
+
+static void _init_netif(void)
+{
+    netdev_test_setup(&_netdev, NULL);
+    netdev_test_set_get_cb(&_netdev, NETOPT_DEVICE_TYPE, _get_device_type);
+    netdev_test_set_get_cb(&_netdev, NETOPT_MAX_PDU_SIZE, _get_max_packet_size);
+    netdev_test_set_get_cb(&_netdev, NETOPT_ADDRESS, _get_address);
+    netdev_test_set_send_cb(&_netdev, _send);
+    netdev_test_set_recv_cb(&_netdev, _recv);
+    netdev_test_set_isr_cb(&_netdev, _isr);
+    expect(gnrc_netif_ethernet_create(&_netif, _netif_stack, sizeof(_netif_stack),
+                                      GNRC_NETIF_PRIO, "mock_eth",
+                                      &_netdev.netdev.netdev) == 0);
+
+    gnrc_ipv6_nib_init();
+    gnrc_ipv6_nib_init_iface(&_netif);
+    gnrc_ipv6_nib_iface_up(&_netif);
+    /* skip duplicate address detection */
+    expect(!ipv6_addr_is_unspecified(&_netif.ipv6.addrs[0]));
+    _netif.ipv6.addrs_flags[0] &= ~GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_MASK;
+    _netif.ipv6.addrs_flags[0] |= GNRC_NETIF_IPV6_ADDRS_FLAGS_STATE_VALID;
+}
+
+static void _build_frame(unsigned payload_len)
+{
+    ethernet_hdr_t *eth = (ethernet_hdr_t *)_frame;
+    ipv6_hdr_t *ipv6 = (ipv6_hdr_t *)(eth + 1);
+    udp_hdr_t *udp = (udp_hdr_t *)(ipv6 + 1);
+    uint16_t udp_len = sizeof(udp_hdr_t) + payload_len;
+
+    memcpy(eth->dst, _mac, sizeof(_mac));
+    memcpy(eth->src, _nbr_mac, sizeof(_nbr_mac));
+    eth->type = byteorder_htons(ETHERTYPE_IPV6);
+
+    memset(ipv6, 0, sizeof(*ipv6));
+    ipv6_hdr_set_version(ipv6);
+    ipv6->len = byteorder_htons(udp_len);
+    ipv6->nh = PROTNUM_UDP;
+    ipv6->hl = 64;
+    ipv6->src = _nbr_link_local;
+    ipv6->dst = _netif.ipv6.addrs[0];
+
+    udp->src_port = byteorder_htons(PORT);
+    udp->dst_port = byteorder_htons(PORT);
+    udp->length = byteorder_htons(udp_len);
+    udp->checksum = byteorder_htons(0);
+    for (unsigned i = 0; i < payload_len; i++) {
+        ((uint8_t *)(udp + 1))[i] = i;
+    }
+
+    uint16_t csum = ipv6_hdr_inet_csum(0, ipv6, PROTNUM_UDP, udp_len);
+    csum = ~inet_csum(csum, (uint8_t *)udp, udp_len);
+    udp->checksum = byteorder_htons(csum ? csum : 0xffff);
+
+    _frame_len = sizeof(*eth) + sizeof(*ipv6) + udp_len;
+}
+
+/* returns the number of received datagrams */
+static unsigned _trigger(unsigned burst)
+{
+    unsigned received = 0;
+
+    _burst = burst;
+    netdev_trigger_event_isr(&_netdev.netdev.netdev);
+    /* all network threads have a higher priority, so every datagram that
+     * was not dropped is already queued */
+    while (sock_udp_recv(&_sock, _buf, sizeof(_buf), 0, NULL) >= 0) {
+        received++;
+    }
+    return received;
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+
+    _init_netif();
+    local.port = PORT;
+    expect(sock_udp_create(&_sock, &local, NULL, 0) == 0);
+
+    puts("UDP receive benchmark");
+    printf("%s, %u rounds, burst of %u\n",
+           IS_USED(MODULE_GNRC_UDP_FASTPATH) ? "fast path" : "threaded",
+           ROUNDS, (unsigned)BURST);
+    puts("payload | latency[us] | burst[us] | delivered");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_payload_sizes); i++) {
+        const unsigned size = _payload_sizes[i];
+        unsigned delivered = 0;
+
+        _build_frame(size);
+
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        for (unsigned r = 0; r < ROUNDS; r++) {
+            expect(_trigger(1) == 1);
+        }
+        uint32_t latency = (ztimer_now(ZTIMER_USEC) - start) / ROUNDS;
+
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned r = 0; r < ROUNDS; r++) {
+            delivered += _trigger(BURST);
+        }
+        uint32_t diff = ztimer_now(ZTIMER_USEC) - start;
+        uint32_t per_datagram = delivered ? diff / delivered : 0;
+
+        printf("%7u | %11" PRIu32 " | %9" PRIu32 " | %u/%u\n", size, latency,
+               per_datagram, delivered, ROUNDS * (unsigned)BURST);
+    }
+
+    puts("DONE");
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       lwIP receive throughput benchmark
+ *
+ * The host sends UDP datagrams via a tap interface, `bench_recv` counts
+ * them until the host stops sending and prints the receive statistics of
+ * the interface.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lwip/netif/compat.h"
+#include "net/netif.h"
+#include "net/sock/udp.h"
+#include "shell.h"
+#include "ztimer.h"
+
+/* the transfer is over once the host did not send for this long */
+#define IDLE_TIMEOUT_US     (US_PER_SEC)
+
+static uint8_t _buf[1500];
+
+static void _print_stats(void)
+{
+    netif_t *iface = NULL;
+
+    while ((iface = netif_iter(iface))) {
+        lwip_netif_t *netif = (lwip_netif_t *)iface;
+
+        printf("rx dropped: %" PRIu32 ", no pbuf: %" PRIu32 "\n",
+               netif->rx_stats.dropped, netif->rx_stats.alloc_failed);
+    }
+}
+
+static int _bench_recv(int argc, char **argv)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+    sock_udp_t sock;
+    unsigned datagrams = 0;
+    size_t rcvd = 0;
+    uint32_t start = 0, last = 0;
+    int res;
+
+    if (argc < 2) {
+        printf("usage: %s <port>\n", argv[0]);
+        return 1;
+    }
+    local.port = atoi(argv[1]);
+    res = sock_udp_create(&sock, &local, NULL, 0);
+    if (res < 0) {
+        printf("sock_udp_create: %d\n", res);
+        return 1;
+    }
+    puts("listening");
+
+    while ((res = sock_udp_recv(&sock, _buf, sizeof(_buf),
+                                datagrams ? IDLE_TIMEOUT_US : SOCK_NO_TIMEOUT,
+                                NULL)) >= 0) {
+        last = ztimer_now(ZTIMER_MSEC);
+        if (datagrams++ == 0) {
+            start = last;
+        }
+        rcvd += res;
+    }
+    sock_udp_close(&sock);
+
+    uint32_t ms = (last - start) ? (last - start) : 1;
+    printf("received %u datagrams, %u bytes in %" PRIu32 " ms: %" PRIu32 " kB/s\n",
+           datagrams, (unsigned)rcvd, ms, (uint32_t)(rcvd / ms));
+    _print_stats();
+    return 0;
+}
+
+static const shell_command_t _commands[] = {
+    { "bench_recv", "receive UDP datagrams from the host", _bench_recv },
+    { NULL, NULL, NULL }
+};
+
+int main(void)
+{
+    puts("lwIP receive throughput benchmark");
+
+    char line_buf[SHELL_DEFAULT_BUFSIZE];
+    shell_run(_commands, line_buf, SHELL_DEFAULT_BUFSIZE);
+
+    return 0;
+}
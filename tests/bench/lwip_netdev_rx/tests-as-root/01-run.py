@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2023 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import os
+import re
+import socket
+import sys
+
+from testrunner import run
+
+PORT = 4000
+DATAGRAMS = 2000
+# the largest payload does not fit into a single pbuf of the pool
+PAYLOAD_SIZES = (64, 512, 1232)
+
+
+def get_host_interface():
+    # Use the bridge the tap device is part of, if there is one
+    tap = os.environ["TAPDEV"]
+    bridge = re.search('master (.*) state',
+                       os.popen('bridge link show dev {}'.format(tap)).read())
+    return bridge.group(1).strip() if bridge else tap
+
+
+def get_riot_address(child):
+    child.sendline('ifconfig')
+    child.expect(r'inet6 addr: (fe80:[0-9a-f:]+)\s')
+    return child.match.group(1).strip()
+
+
+def test_recv(child, riot_addr, interface, size):
+    child.sendline('bench_recv {}'.format(PORT))
+    child.expect_exact('listening')
+    addr = socket.getaddrinfo('{}%{}'.format(riot_addr, interface), PORT,
+                              socket.AF_INET6, socket.SOCK_DGRAM)[0][4]
+    with socket.socket(socket.AF_INET6, socket.SOCK_DGRAM) as sock:
+        for _ in range(DATAGRAMS):
+            sock.sendto(bytes(size), addr)
+    child.expect(r'received (\d+) datagrams, (\d+) bytes in \d+ ms: \d+ kB/s',
+                 timeout=30)
+    datagrams = int(child.match.group(1))
+    assert 0 < datagrams <= DATAGRAMS
+    assert int(child.match.group(2)) == datagrams * size
+    child.expect(r'rx dropped: \d+, no pbuf: \d+')
+
+
+def testfunc(child):
+    child.expect_exact('lwIP receive throughput benchmark')
+    riot_addr = get_riot_address(child)
+    interface = get_host_interface()
+    for size in PAYLOAD_SIZES:
+        test_recv(child, riot_addr, interface, size)
+
+
+if __name__ == '__main__':
+    sys.exit(run(testfunc, timeout=10))
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Next hop look-up benchmark for the FIB
+ *
+ * Half of the routes are /64 prefixes, the other half are host routes within
+ * these prefixes. Every second look-up misses all of them and is answered by
+ * the default route.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "kernel_defines.h"
+#include "net/fib.h"
+#include "test_utils/expect.h"
+#include "universal_address.h"
+#include "ztimer.h"
+
+#ifndef LOOKUPS
+#define LOOKUPS     (10000U)
+#endif
+
+#define IFACE       (6)
+#define ADDR_SIZE   (16U)
+
+static const unsigned _numof_routes[] = { 64, 256, 1024, 4096 };
+
+static fib_entry_t _entries[FIB_ROUTES + 1];
+static fib_table_t _table = {
+    .data.entries = _entries,
+    .table_type = FIB_TABLE_TYPE_SH,
+    .size = ARRAY_SIZE(_entries),
+    .mtx_access = MUTEX_INIT,
+};
+
+static void _next_hop(uint8_t *addr, unsigned n)
+{
+    memset(addr, 0, ADDR_SIZE);
+    addr[0] = 0xfe;
+    addr[1] = 0x80;
+    addr[15] = (n % FIB_NEXT_HOPS) + 1;
+}
+
+/* even routes n are 2001:db8:0:<n>::/64, odd routes n are the host routes
+ * 2001:db8:0:<n - 1>::<n>, returns the prefix length */
+static unsigned _route(uint8_t *addr, unsigned n)
+{
+    unsigned base = n & ~1U;
+
+    memset(addr, 0, ADDR_SIZE);
+    addr[0] = 0x20;
+    addr[1] = 0x01;
+    addr[2] = 0x0d;
+    addr[3] = 0xb8;
+    addr[6] = (base >> 8) & 0xff;
+    addr[7] = base & 0xff;
+    if (n & 1) {
+        addr[14] = (n >> 8) & 0xff;
+        addr[15] = n & 0xff;
+        return ADDR_SIZE * 8;
+    }
+    return 64;
+}
+
+/* returns a destination address covered by route n */
+static void _dst(uint8_t *addr, unsigned n)
+{
+    _route(addr, n);
+    if (!(n & 1)) {
+        /* outside of all host routes */
+        addr[13] = 0xff;
+    }
+}
+
+static int _get(const uint8_t *dst, uint8_t *next_hop)
+{
+    kernel_pid_t iface;
+    size_t next_hop_size = ADDR_SIZE;
+    uint32_t next_hop_flags;
+
+    return fib_get_next_hop(&_table, &iface, next_hop, &next_hop_size,
+                            &next_hop_flags, (uint8_t *)dst, ADDR_SIZE, 0);
+}
+
+int main(void)
+{
+    uint8_t dst[ADDR_SIZE];
+    uint8_t next_hop[ADDR_SIZE];
+    uint8_t expected[ADDR_SIZE];
+    unsigned added = 0;
+
+    puts("FIB look-up benchmark");
+    printf("table size: %u, buckets: %u\n", FIB_ROUTES, CONFIG_FIB_BUCKETS);
+
+    fib_init(&_table);
+
+    /* default route ::/0 */
+    memset(dst, 0, sizeof(dst));
+    _next_hop(next_hop, FIB_NEXT_HOPS - 1);
+    expect(fib_add_entry(&_table, IFACE, dst, ADDR_SIZE, 0, next_hop, ADDR_SIZE,
+                         0, (uint32_t)FIB_LIFETIME_NO_EXPIRE) == 0);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_numof_routes); i++) {
+        const unsigned numof = _numof_routes[i];
+        uint32_t start, diff;
+
+        if (numof > FIB_ROUTES) {
+            break;
+        }
+        for (; added < numof; added++) {
+            unsigned len = _route(dst, added);
+
+            _next_hop(next_hop, added);
+            expect(fib_add_entry(&_table, IFACE, dst, ADDR_SIZE,
+                                 (uint32_t)len << FIB_FLAG_NET_PREFIX_SHIFT,
+                                 next_hop, ADDR_SIZE, 0,
+                                 (uint32_t)FIB_LIFETIME_NO_EXPIRE) == 0);
+        }
+
+        /* sanity check: most specific route wins, misses take the default */
+        for (unsigned n = numof - 2; n < numof; n++) {
+            _dst(dst, n);
+            _next_hop(expected, n);
+            expect(_get(dst, next_hop) == 0);
+            expect(memcmp(next_hop, expected, ADDR_SIZE) == 0);
+        }
+        dst[0] = 0xfd;
+        _next_hop(expected, FIB_NEXT_HOPS - 1);
+        expect(_get(dst, next_hop) == 0);
+        expect(memcmp(next_hop, expected, ADDR_SIZE) == 0);
+
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned n = 0; n < LOOKUPS; n++) {
+            _dst(dst, (n * 7919) % numof);
+            if (n & 1) {
+                dst[0] = 0xfd;
+            }
+            _get(dst, next_hop);
+        }
+        diff = ztimer_now(ZTIMER_USEC) - start;
+
+        printf("%4u routes: %u look-ups in %" PRIu32 " us (%" PRIu32 " ns/look-up)\n",
+               numof, LOOKUPS, diff, (uint32_t)(((uint64_t)diff * 1000) / LOOKUPS));
+    }
+
+    puts("done.");
+
+    return 0;
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for the Internet Checksum
+ *
+ * Checksums @ref TRANSFER_SIZE bytes in payloads of different sizes with
+ * @ref inet_csum and with the former byte-wise implementation as baseline.
+ * `unaligned` passes buffers starting at an odd address.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "kernel_defines.h"
+#include "net/inet_csum.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef TRANSFER_SIZE
+#define TRANSFER_SIZE   (64U * 1024U)
+#endif
+
+#define MAX_PAYLOAD     (1500U)
+
+static const unsigned _payload_sizes[] = { 64, 128, 256, 512, 1024, MAX_PAYLOAD };
+
+static uint8_t _buf[MAX_PAYLOAD + 4] __attribute__((aligned(4)));
+
+/* inet_csum() as it was before summing whole words */
+static uint16_t _bytewise(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if (len & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        uint16_t carry = csum >> 16;
+        csum = (csum & 0xffff) + carry;
+    }
+    return csum;
+}
+
+static const struct {
+    const char *name;
+    uint16_t (*csum)(uint16_t sum, const uint8_t *buf, uint16_t len);
+    unsigned offset;
+} _impls[] = {
+    { "bytewise", _bytewise, 0 },
+    { "inet_csum", inet_csum, 0 },
+    { "unaligned", inet_csum, 1 },
+};
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = i * 7;
+    }
+
+    puts("Internet Checksum benchmark");
+    printf("%u bytes per run\n", TRANSFER_SIZE);
+    puts("variant   | payload | time[us] | MB/s");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_impls); i++) {
+        const uint8_t *buf = &_buf[_impls[i].offset];
+
+        for (unsigned j = 0; j < ARRAY_SIZE(_payload_sizes); j++) {
+            const unsigned size = _payload_sizes[j];
+            unsigned done = 0;
+            uint16_t sum = 0;
+
+            uint32_t start = ztimer_now(ZTIMER_USEC);
+            for (; done + size <= TRANSFER_SIZE; done += size) {
+                sum = _impls[i].csum(sum, buf, size);
+            }
+            uint32_t diff = ztimer_now(ZTIMER_USEC) - start;
+
+            expect(_bytewise(0, buf, size) == inet_csum(0, buf, size));
+
+            /* bytes per us are MB/s, print with two decimals */
+            uint32_t centi = diff ? ((uint64_t)done * 100) / diff : 0;
+            printf("%-9s | %7u | %8" PRIu32 " | %" PRIu32 ".%02" PRIu32 "\n",
+                   _impls[i].name, size, diff, centi / 100, centi % 100);
+        }
+    }
+
+    puts("DONE");
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for the CRC implementations
+ *
+ * Checksums @ref TRANSFER_SIZE bytes with each CRC variant, passing the data
+ * in buffers of different sizes to the incremental interface.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "checksum/crc.h"
+#include "kernel_defines.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef TRANSFER_SIZE
+#define TRANSFER_SIZE   (64U * 1024U)
+#endif
+
+static const unsigned _buf_sizes[] = { 64, 512, 4096 };
+
+static const crc_algo_t _crc8 = CRC_ALGO_CRC8(0x31, 0xff);
+static const crc_algo_t _ucrc16 = CRC_ALGO_UCRC16_BE(0x1021, 0xffff);
+
+static const struct {
+    const char *name;
+    const crc_algo_t *algo;
+} _algos[] = {
+    { "crc8", &_crc8 },
+    { "ucrc16", &_ucrc16 },
+    { "crc16-kermit", &crc_algo_crc16_ccitt_kermit },
+    { "crc16-false", &crc_algo_crc16_ccitt_false },
+    { "crc32", &crc_algo_crc32 },
+};
+
+static uint8_t _buf[4096];
+
+static const char *_impl(void)
+{
+    if (IS_USED(MODULE_CRC32_SLICING)) {
+        return "slicing";
+    }
+    if (IS_USED(MODULE_CRC32_FAST)) {
+        return "fast";
+    }
+    return "bitwise";
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = i * 7;
+    }
+
+    puts("CRC benchmark");
+    printf("implementation: %s, %u bytes per run\n", _impl(), TRANSFER_SIZE);
+    puts("variant      | buffer | time[us] | MB/s");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_algos); i++) {
+        uint32_t check = 0;
+
+        for (unsigned j = 0; j < ARRAY_SIZE(_buf_sizes); j++) {
+            const unsigned size = _buf_sizes[j];
+            crc_ctx_t ctx;
+
+            crc_init(&ctx, _algos[i].algo);
+            uint32_t start = ztimer_now(ZTIMER_USEC);
+            for (unsigned done = 0; done < TRANSFER_SIZE; done += size) {
+                crc_update(&ctx, &_buf[done % sizeof(_buf)], size);
+            }
+            uint32_t diff = ztimer_now(ZTIMER_USEC) - start;
+
+            /* the same data is checksummed with every buffer size */
+            if (j == 0) {
+                check = crc_finish(&ctx);
+            }
+            expect(crc_finish(&ctx) == check);
+
+            /* bytes per us are MB/s, print with two decimals */
+            uint32_t centi = diff ? ((uint64_t)TRANSFER_SIZE * 100) / diff : 0;
+            printf("%-12s | %6u | %8" PRIu32 " | %" PRIu32 ".%02" PRIu32 "\n",
+                   _algos[i].name, size, diff, centi / 100, centi % 100);
+        }
+    }
+
+    puts("DONE");
+
+    return 0;
+}
@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for AES-128 in different modes
+ *
+ * Encrypts @ref TRANSFER_SIZE bytes in messages of different sizes.
+ * `block` calls @ref cipher_encrypt for every block and is the baseline for
+ * `ecb`, which passes all blocks of a message to the cipher at once. `ccm`
+ * uses a 13 byte nonce, 8 bytes of additional data and an 8 byte MAC, like
+ * IEEE 802.15.4 link layer security.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "crypto/aes.h"
+#include "crypto/ciphers.h"
+#include "crypto/modes/ccm.h"
+#include "crypto/modes/ctr.h"
+#include "crypto/modes/ecb.h"
+#include "kernel_defines.h"
+#include "periph_conf.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef TRANSFER_SIZE
+#define TRANSFER_SIZE   (16U * 1024U)
+#endif
+
+#define MAX_MSG_SIZE    (1024U)
+#define MAC_LEN         (8U)
+#define NONCE_LEN       (13U)
+
+static const unsigned _msg_sizes[] = { 16, 64, 128, MAX_MSG_SIZE };
+
+static const uint8_t _key[16] = {
+    0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+    0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+
+static const uint8_t _nonce[16] = {
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff
+};
+
+static cipher_t _cipher;
+static uint8_t _in[MAX_MSG_SIZE];
+static uint8_t _out[MAX_MSG_SIZE + MAC_LEN];
+
+static int _block(const uint8_t *in, size_t len, uint8_t *out)
+{
+    for (size_t i = 0; i < len; i += AES_BLOCK_SIZE) {
+        if (cipher_encrypt(&_cipher, &in[i], &out[i]) != 1) {
+            return -1;
+        }
+    }
+    return len;
+}
+
+static int _ecb(const uint8_t *in, size_t len, uint8_t *out)
+{
+    return cipher_encrypt_ecb(&_cipher, in, len, out);
+}
+
+static int _ctr(const uint8_t *in, size_t len, uint8_t *out)
+{
+    uint8_t ctr[16];
+
+    memcpy(ctr, _nonce, sizeof(ctr));
+    return cipher_encrypt_ctr(&_cipher, ctr, 0, in, len, out);
+}
+
+static int _ccm(const uint8_t *in, size_t len, uint8_t *out)
+{
+    return cipher_encrypt_ccm(&_cipher, _nonce, 8, MAC_LEN, 15 - NONCE_LEN,
+                              _nonce, NONCE_LEN, in, len, out) - MAC_LEN;
+}
+
+static const struct {
+    const char *name;
+    int (*encrypt)(const uint8_t *in, size_t len, uint8_t *out);
+} _modes[] = {
+    { "block", _block },
+    { "ecb", _ecb },
+    { "ctr", _ctr },
+    { "ccm", _ccm },
+};
+
+static uint32_t _run(unsigned mode, unsigned size)
+{
+    unsigned done = 0;
+
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    while (done < TRANSFER_SIZE) {
+        expect(_modes[mode].encrypt(_in, size, _out) == (int)size);
+        done += size;
+    }
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+int main(void)
+{
+    static uint8_t check[sizeof(_out)];
+
+    for (unsigned i = 0; i < sizeof(_in); i++) {
+        _in[i] = i * 7;
+    }
+    expect(cipher_init(&_cipher, CIPHER_AES, _key, sizeof(_key)) == 1);
+
+    printf("AES benchmark (%s)\n",
+           IS_USED(MODULE_CRYPTO_AES_BITSLICED) ? "bitsliced" : "T-table");
+    printf("%u bytes per run, core clock %" PRIu32 " Hz\n", TRANSFER_SIZE,
+           (uint32_t)CLOCK_CORECLOCK);
+    puts("mode      | buffer | time[us] | kB/s   | cycles/B");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_modes); i++) {
+        for (unsigned j = 0; j < ARRAY_SIZE(_msg_sizes); j++) {
+            const unsigned size = _msg_sizes[j];
+
+            uint32_t diff = _run(i, size);
+            /* every message is the same, so is its encryption */
+            memcpy(check, _out, sizeof(check));
+            _run(i, size);
+            expect(memcmp(check, _out, sizeof(check)) == 0);
+
+            uint32_t kbps = diff ? ((uint64_t)TRANSFER_SIZE * 1000) / diff : 0;
+            /* cycles per byte, with one decimal */
+            uint32_t deci = ((uint64_t)diff * (CLOCK_CORECLOCK / 100000U)) /
+                            TRANSFER_SIZE;
+            printf("%-9s | %6u | %8" PRIu32 " | %6" PRIu32 " | %" PRIu32
+                   ".%" PRIu32 "\n", _modes[i].name, size, diff, kbps,
+                   deci / 10, deci % 10);
+        }
+    }
+
+    puts("DONE");
+
+    return 0;
+}
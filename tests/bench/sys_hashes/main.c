@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput benchmark for the SHA-2 and SHA-3 implementations
+ *
+ * Hashes @ref TRANSFER_SIZE bytes with each hash function, passing the data
+ * in buffers of different sizes to the incremental interface. The odd buffer
+ * sizes start the updates at unaligned positions.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "hashes/sha224.h"
+#include "hashes/sha256.h"
+#include "hashes/sha3.h"
+#include "kernel_defines.h"
+#include "periph_conf.h"
+#include "test_utils/expect.h"
+#include "ztimer.h"
+
+#ifndef TRANSFER_SIZE
+#define TRANSFER_SIZE   (32U * 1024U)
+#endif
+
+static const unsigned _buf_sizes[] = { 16, 64, 67, 1024 };
+
+static union {
+    sha224_context_t sha224;
+    sha256_context_t sha256;
+    keccak_state_t sha3;
+} _ctx;
+
+static void _sha224_init(void)
+{
+    sha224_init(&_ctx.sha224);
+}
+
+static void _sha224_update(const void *data, size_t len)
+{
+    sha224_update(&_ctx.sha224, data, len);
+}
+
+static void _sha224_final(void *digest)
+{
+    sha224_final(&_ctx.sha224, digest);
+}
+
+static void _sha256_init(void)
+{
+    sha256_init(&_ctx.sha256);
+}
+
+static void _sha256_update(const void *data, size_t len)
+{
+    sha256_update(&_ctx.sha256, data, len);
+}
+
+static void _sha256_final(void *digest)
+{
+    sha256_final(&_ctx.sha256, digest);
+}
+
+static void _sha3_256_init(void)
+{
+    sha3_256_init(&_ctx.sha3);
+}
+
+static void _sha3_512_init(void)
+{
+    sha3_512_init(&_ctx.sha3);
+}
+
+static void _sha3_update(const void *data, size_t len)
+{
+    sha3_update(&_ctx.sha3, data, len);
+}
+
+static void _sha3_256_final(void *digest)
+{
+    sha3_256_final(&_ctx.sha3, digest);
+}
+
+static void _sha3_512_final(void *digest)
+{
+    sha3_512_final(&_ctx.sha3, digest);
+}
+
+static const struct {
+    const char *name;
+    void (*init)(void);
+    void (*update)(const void *data, size_t len);
+    void (*final)(void *digest);
+    unsigned digest_len;
+} _algos[] = {
+    { "sha224", _sha224_init, _sha224_update, _sha224_final, SHA224_DIGEST_LENGTH },
+    { "sha256", _sha256_init, _sha256_update, _sha256_final, SHA256_DIGEST_LENGTH },
+    { "sha3-256", _sha3_256_init, _sha3_update, _sha3_256_final, SHA3_256_DIGEST_LENGTH },
+    { "sha3-512", _sha3_512_init, _sha3_update, _sha3_512_final, SHA3_512_DIGEST_LENGTH },
+};
+
+/* one more byte, so every buffer size fits at more than one offset */
+static uint8_t _buf[1024 + 1];
+
+static uint32_t _run(unsigned algo, unsigned size, uint8_t *digest)
+{
+    unsigned done = 0;
+
+    _algos[algo].init();
+    uint32_t start = ztimer_now(ZTIMER_USEC);
+    while (done < TRANSFER_SIZE) {
+        unsigned len = (TRANSFER_SIZE - done) < size ? (TRANSFER_SIZE - done) : size;
+        _algos[algo].update(&_buf[done % (sizeof(_buf) - size)], len);
+        done += len;
+    }
+    _algos[algo].final(digest);
+    return ztimer_now(ZTIMER_USEC) - start;
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        _buf[i] = i * 7;
+    }
+
+    puts("hashes benchmark");
+    printf("%u bytes per run, core clock %" PRIu32 " Hz\n", TRANSFER_SIZE,
+           (uint32_t)CLOCK_CORECLOCK);
+    puts("function | buffer | time[us] | kB/s   | cycles/B");
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_algos); i++) {
+        for (unsigned j = 0; j < ARRAY_SIZE(_buf_sizes); j++) {
+            const unsigned size = _buf_sizes[j];
+            uint8_t digest[SHA3_512_DIGEST_LENGTH];
+            uint8_t check[SHA3_512_DIGEST_LENGTH];
+
+            uint32_t diff = _run(i, size, digest);
+            /* the same input must give the same digest on every run */
+            _run(i, size, check);
+            expect(memcmp(check, digest, _algos[i].digest_len) == 0);
+
+            uint32_t kbps = diff ? ((uint64_t)TRANSFER_SIZE * 1000) / diff : 0;
+            /* cycles per byte, with one decimal */
+            uint32_t deci = ((uint64_t)diff * (CLOCK_CORECLOCK / 100000U)) /
+                            TRANSFER_SIZE;
+            printf("%-8s | %6u | %8" PRIu32 " | %6" PRIu32 " | %" PRIu32
+                   ".%" PRIu32 "\n", _algos[i].name, size, diff, kbps,
+                   deci / 10, deci % 10);
+        }
+    }
+
+    puts("DONE");
+
+    return 0;
+}
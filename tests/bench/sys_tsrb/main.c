@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Throughput and interrupt latency benchmark for tsrb
+ *
+ * Compares the bulk functions of tsrb and the zero-copy span API with a
+ * byte-by-byte reference implementation (which tsrb used before). For each
+ * variant the worst-case duration of a single call that runs with interrupts
+ * disabled is reported, as that is the added interrupt latency.
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "kernel_defines.h"
+#include "macros/utils.h"
+#include "test_utils/expect.h"
+#include "tsrb.h"
+#include "ztimer.h"
+
+#ifndef TRANSFER_SIZE
+#define TRANSFER_SIZE   (64U * 1024U)
+#endif
+
+#define BUF_SIZE        (1024U)
+
+static const unsigned _chunk_sizes[] = { 16, 64, 256 };
+
+static uint8_t _buf[BUF_SIZE];
+static uint8_t _in[256];
+static uint8_t _out[256];
+
+typedef struct {
+    uint32_t total;     /**< time for the whole transfer */
+    uint32_t max_irq;   /**< longest call with IRQs disabled */
+} _result_t;
+
+typedef void (*_transfer_t)(tsrb_t *rb, unsigned chunk, _result_t *res);
+
+/* byte-by-byte reference as tsrb used to implement tsrb_add() and
+ * tsrb_get() */
+static int _ref_add(tsrb_t *rb, const uint8_t *src, size_t n)
+{
+    size_t tmp = n;
+    unsigned irq_state = irq_disable();
+    while (tmp && ((rb->writes - rb->reads) != rb->size)) {
+        rb->buf[rb->writes++ & (rb->size - 1)] = *src++;
+        tmp--;
+    }
+    irq_restore(irq_state);
+    return (n - tmp);
+}
+
+static int _ref_get(tsrb_t *rb, uint8_t *dst, size_t n)
+{
+    size_t tmp = n;
+    unsigned irq_state = irq_disable();
+    while (tmp && (rb->reads != rb->writes)) {
+        *dst++ = rb->buf[rb->reads++ & (rb->size - 1)];
+        tmp--;
+    }
+    irq_restore(irq_state);
+    return (n - tmp);
+}
+
+static inline void _track(_result_t *res, uint32_t start)
+{
+    uint32_t diff = ztimer_now(ZTIMER_USEC) - start;
+
+    if (diff > res->max_irq) {
+        res->max_irq = diff;
+    }
+}
+
+static void _transfer_ref(tsrb_t *rb, unsigned chunk, _result_t *res)
+{
+    for (unsigned done = 0; done < TRANSFER_SIZE; done += chunk) {
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        expect(_ref_add(rb, _in, chunk) == (int)chunk);
+        _track(res, start);
+        start = ztimer_now(ZTIMER_USEC);
+        expect(_ref_get(rb, _out, chunk) == (int)chunk);
+        _track(res, start);
+    }
+}
+
+static void _transfer_bulk(tsrb_t *rb, unsigned chunk, _result_t *res)
+{
+    for (unsigned done = 0; done < TRANSFER_SIZE; done += chunk) {
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        expect(tsrb_add(rb, _in, chunk) == (int)chunk);
+        _track(res, start);
+        start = ztimer_now(ZTIMER_USEC);
+        expect(tsrb_get(rb, _out, chunk) == (int)chunk);
+        _track(res, start);
+    }
+}
+
+/* only the index updates run with IRQs disabled, so only they are tracked */
+static void _transfer_span(tsrb_t *rb, unsigned chunk, _result_t *res)
+{
+    for (unsigned done = 0; done < TRANSFER_SIZE; done += chunk) {
+        unsigned left = chunk;
+
+        while (left) {
+            uint8_t *dst;
+            uint32_t start = ztimer_now(ZTIMER_USEC);
+            size_t n = MIN(tsrb_write_span(rb, &dst), left);
+            _track(res, start);
+            memcpy(dst, &_in[chunk - left], n);
+            start = ztimer_now(ZTIMER_USEC);
+            tsrb_write_commit(rb, n);
+            _track(res, start);
+            left -= n;
+        }
+        left = chunk;
+        while (left) {
+            const uint8_t *src;
+            uint32_t start = ztimer_now(ZTIMER_USEC);
+            size_t n = MIN(tsrb_read_span(rb, &src), left);
+            _track(res, start);
+            memcpy(&_out[chunk - left], src, n);
+            start = ztimer_now(ZTIMER_USEC);
+            tsrb_read_commit(rb, n);
+            _track(res, start);
+            left -= n;
+        }
+    }
+}
+
+static void _run(const char *name, _transfer_t transfer, unsigned chunk)
+{
+    tsrb_t rb;
+    _result_t res = { 0 };
+    uint32_t start;
+
+    /* offset the indices so chunks wrap around the end of the buffer */
+    tsrb_init(&rb, _buf, sizeof(_buf));
+    rb.reads = rb.writes = chunk / 2;
+    memset(_out, 0, sizeof(_out));
+    start = ztimer_now(ZTIMER_USEC);
+    transfer(&rb, chunk, &res);
+    /* avoid dividing by zero on boards where the whole run is that fast */
+    res.total = MAX(ztimer_now(ZTIMER_USEC) - start, 1U);
+    expect(memcmp(_in, _out, chunk) == 0);
+    expect(tsrb_empty(&rb));
+
+    printf("%-5s | %5u | %8" PRIu32 " | %8" PRIu32 " | %6" PRIu32 "\n",
+           name, chunk, res.total,
+           (uint32_t)(((uint64_t)TRANSFER_SIZE * 1000U) / res.total),
+           res.max_irq);
+}
+
+int main(void)
+{
+    for (unsigned i = 0; i < sizeof(_in); i++) {
+        _in[i] = i;
+    }
+
+    puts("tsrb benchmark");
+    printf("transferring %u bytes through a %u byte ringbuffer\n",
+           TRANSFER_SIZE, BUF_SIZE);
+    puts("impl. | chunk | time[us] | kB/s     | max. IRQ-off[us]");
+    for (unsigned i = 0; i < ARRAY_SIZE(_chunk_sizes); i++) {
+        _run("byte", _transfer_ref, _chunk_sizes[i]);
+        _run("bulk", _transfer_bulk, _chunk_sizes[i]);
+        _run("span", _transfer_span, _chunk_sizes[i]);
+    }
+    puts("DONE");
+    return 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2023 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("tsrb benchmark\r\n")
+    child.expect(r"transferring \d+ bytes through a \d+ byte ringbuffer\r\n")
+    child.expect_exact("impl. | chunk | time[us] | kB/s     | max. IRQ-off[us]\r\n")
+    while child.expect([r"(byte|bulk|span)\s+\|\s+\d+ \|\s+\d+ \|\s+\d+ \|\s+\d+\r\n",
+                        r"DONE\r\n"]) == 0:
+        pass
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
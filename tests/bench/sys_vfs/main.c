@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Path lookup benchmark for the VFS
+ *
+ * Mounts several ConstFS instances at nested mount points and measures the
+ * time of open + stat + close and of stat alone for files on each of them.
+ *
+ * @}
+ */
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <sys/stat.h>
+
+#include "fs/constfs.h"
+#include "kernel_defines.h"
+#include "test_utils/expect.h"
+#include "vfs.h"
+#include "ztimer.h"
+
+#ifndef ITERATIONS
+#define ITERATIONS      (1000U)
+#endif
+
+static const uint8_t _data[] = "0123456789abcdef";
+
+static const constfs_file_t _files[] = {
+    { .path = "/log0.txt", .data = _data, .size = sizeof(_data) },
+    { .path = "/log1.txt", .data = _data, .size = sizeof(_data) },
+    { .path = "/log2.txt", .data = _data, .size = sizeof(_data) },
+    { .path = "/log3.txt", .data = _data, .size = sizeof(_data) },
+};
+
+static const constfs_t _fs = {
+    .files = _files,
+    .nfiles = ARRAY_SIZE(_files),
+};
+
+static vfs_mount_t _mounts[] = {
+    { .mount_point = "/const", .fs = &constfs_file_system, .private_data = (void *)&_fs },
+    { .mount_point = "/nvm", .fs = &constfs_file_system, .private_data = (void *)&_fs },
+    { .mount_point = "/nvm/logs", .fs = &constfs_file_system, .private_data = (void *)&_fs },
+    { .mount_point = "/sd0", .fs = &constfs_file_system, .private_data = (void *)&_fs },
+    { .mount_point = "/sd0/data/2023", .fs = &constfs_file_system, .private_data = (void *)&_fs },
+};
+
+static const char *_paths[] = {
+    "/const/log0.txt",
+    "/nvm/log1.txt",
+    "/nvm/logs/log2.txt",
+    "/sd0/log3.txt",
+    "/sd0/data/2023/log0.txt",
+};
+
+int main(void)
+{
+    puts("VFS benchmark");
+    printf("stat cache: %s, %u iterations\n",
+           IS_USED(MODULE_VFS_STAT_CACHE) ? "yes" : "no", ITERATIONS);
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_mounts); i++) {
+        expect(vfs_mount(&_mounts[i]) == 0);
+    }
+
+    puts("path                     | open+stat+close[us] | stat[us]");
+    for (unsigned i = 0; i < ARRAY_SIZE(_paths); i++) {
+        struct stat buf;
+
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        for (unsigned n = 0; n < ITERATIONS; n++) {
+            int fd = vfs_open(_paths[i], O_RDONLY, 0);
+            expect(fd >= 0);
+            expect(vfs_stat(_paths[i], &buf) == 0);
+            vfs_close(fd);
+        }
+        uint32_t open_stat_close = ztimer_now(ZTIMER_USEC) - start;
+
+        start = ztimer_now(ZTIMER_USEC);
+        for (unsigned n = 0; n < ITERATIONS; n++) {
+            expect(vfs_stat(_paths[i], &buf) == 0);
+        }
+        uint32_t stat = ztimer_now(ZTIMER_USEC) - start;
+
+        /* print with two decimals */
+        open_stat_close = (open_stat_close * 100) / ITERATIONS;
+        stat = (stat * 100) / ITERATIONS;
+        printf("%-24s | %15" PRIu32 ".%02" PRIu32 " | %5" PRIu32 ".%02" PRIu32 "\n",
+               _paths[i], open_stat_close / 100, open_stat_close % 100,
+               stat / 100, stat % 100);
+    }
+
+    puts("DONE");
+
+    return 0;
+}
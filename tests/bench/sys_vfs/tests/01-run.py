@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2023 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("VFS benchmark\r\n")
+    child.expect(r"stat cache: (yes|no), \d+ iterations\r\n")
+    child.expect_exact("path                     | open+stat+close[us] | stat[us]\r\n")
+    while child.expect([r"/[\w/.]+\s+\|\s+\d+\.\d{2} \|\s+\d+\.\d{2}\r\n",
+                        r"DONE\r\n"]) == 0:
+        pass
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc, timeout=120))
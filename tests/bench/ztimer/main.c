@@ -91,6 +91,45 @@ static void _print_result(const char *desc, unsigned n, uint32_t total)
     printf("%30s %8"PRIu32" / %u = %"PRIu32"\n", desc, total, n, total/n);
 }
 
+/* simple LCG, so that the scaling benchmark does not depend on the random
+ * module and is reproducible */
+static uint32_t _lcg_state;
+
+static unsigned _lcg_next(unsigned mod)
+{
+    _lcg_state = _lcg_state * 1103515245 + 12345;
+    return (_lcg_state >> 16) % mod;
+}
+
+/* set 'num' timers to random targets, then remove them in random order */
+static void _bench_scaling(unsigned num)
+{
+    char desc[32];
+    uint32_t before, diff;
+    unsigned offset;
+
+    _lcg_state = num;
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < num; n++) {
+        ztimer_set(ZTIMER, &_timers[n], BASE + SPREAD * _lcg_next(num));
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    snprintf(desc, sizeof(desc), "set() %u random", num);
+    _print_result(desc, num, diff);
+
+    /* walking with a stride coprime to num visits every timer exactly once */
+    offset = _lcg_next(num);
+    before = ztimer_now(ZTIMER_USEC);
+    for (unsigned n = 0; n < num; n++) {
+        _timer_remove((offset + (uint32_t)n * 7919) % num);
+    }
+    diff = ztimer_now(ZTIMER_USEC) - before;
+
+    snprintf(desc, sizeof(desc), "remove() %u random", num);
+    _print_result(desc, num, diff);
+}
+
 int main(void)
 {
     puts("ztimer benchmark application.\n");
@@ -288,6 +327,16 @@ int main(void)
     _print_result("ztimer_now()", REPEAT, diff);
     expect(!_triggers);
 
+    /*
+     * test setting and removing an increasing number of timers with random
+     * targets in random order
+     *
+     */
+    for (n = 10; n <= NUMOF_TIMERS; n *= 10) {
+        _bench_scaling(n);
+        expect(!_triggers);
+    }
+
     _print_result("sizeof(ztimer_t)", NUMOF_TIMERS, sizeof(_timers));
 
     puts("done.");
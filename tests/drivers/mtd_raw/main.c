@@ -29,7 +29,10 @@
 #include "shell.h"
 #include "board.h"
 #include "macros/units.h"
+#include "macros/utils.h"
 #include "test_utils/expect.h"
+#include "timex.h"
+#include "ztimer.h"
 
 static mtd_dev_t *_get_dev(int argc, char **argv)
 {
@@ -424,6 +427,84 @@ static int cmd_test(int argc, char **argv)
     return 0;
 }
 
+static void _print_rate(const char *op, uint64_t bytes, uint32_t usec)
+{
+    usec = MAX(usec, 1U);
+    printf("%s: %" PRIu32 " bytes in %" PRIu32 " us (%" PRIu32 " kiB/s)\n",
+           op, (uint32_t)bytes, usec,
+           (uint32_t)((bytes * US_PER_SEC) / usec / KiB(1)));
+}
+
+static int cmd_bench(int argc, char **argv)
+{
+    mtd_dev_t *dev = _get_dev(argc, argv);
+    uint32_t sector, rounds = 10;
+
+    if (argc < 2 || dev == NULL) {
+        printf("usage: %s <dev> [rounds] [sector]\n", argv[0]);
+        return -1;
+    }
+
+    if (argc > 2) {
+        rounds = atoi(argv[2]);
+    }
+
+    if (argc > 3) {
+        sector = atoi(argv[3]);
+    } else {
+        sector = dev->sector_count - 1;
+    }
+
+    if (sector >= dev->sector_count) {
+        printf("%s: invalid sector: %" PRIu32 "\n", argv[0], sector);
+        return -1;
+    }
+
+    uint8_t *buffer = malloc(dev->page_size);
+
+    if (buffer == NULL) {
+        puts("out of memory");
+        return -1;
+    }
+
+    uint32_t page_0 = dev->pages_per_sector * sector;
+    uint64_t sector_size = (uint64_t)dev->pages_per_sector * dev->page_size;
+    uint32_t t_erase = 0, t_write = 0, t_read = 0;
+
+    puts("[START]");
+
+    memset(buffer, 0x5a, dev->page_size);
+    for (uint32_t i = 0; i < rounds; i++) {
+        uint32_t start = ztimer_now(ZTIMER_USEC);
+        expect(mtd_erase_sector(dev, sector, 1) == 0);
+        t_erase += ztimer_now(ZTIMER_USEC) - start;
+
+        start = ztimer_now(ZTIMER_USEC);
+        for (uint32_t page = 0; page < dev->pages_per_sector; page++) {
+            expect(mtd_write_page_raw(dev, buffer, page_0 + page, 0,
+                                      dev->page_size) == 0);
+        }
+        t_write += ztimer_now(ZTIMER_USEC) - start;
+
+        start = ztimer_now(ZTIMER_USEC);
+        for (uint32_t page = 0; page < dev->pages_per_sector; page++) {
+            expect(mtd_read_page(dev, buffer, page_0 + page, 0,
+                                 dev->page_size) == 0);
+        }
+        t_read += ztimer_now(ZTIMER_USEC) - start;
+    }
+
+    _print_rate("erase", sector_size * rounds, t_erase);
+    _print_rate("write", sector_size * rounds, t_write);
+    _print_rate("read", sector_size * rounds, t_read);
+
+    puts("[SUCCESS]");
+
+    free(buffer);
+
+    return 0;
+}
+
 static const shell_command_t shell_commands[] = {
     { "info", "Print properties of the MTD device", cmd_info },
     { "power", "Turn the MTD device on/off", cmd_power },
@@ -439,6 +520,7 @@ static const shell_command_t shell_commands[] = {
     { "erase", "Erase a region of memory on the MTD device", cmd_erase },
     { "erase_sector", "Erase a sector of memory on the MTD device", cmd_erase_sector },
     { "test", "Erase & write test data to the last two sectors", cmd_test },
+    { "bench", "Measure erase, write and read throughput on the last sector", cmd_bench },
     { NULL, NULL, NULL }
 };
 
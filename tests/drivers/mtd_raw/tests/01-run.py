@@ -18,6 +18,11 @@ def testfunc(child):
         child.sendline("test " + str(dev))
         child.expect_exact("[START]")
         child.expect_exact("[SUCCESS]")
+        child.sendline("bench " + str(dev) + " 1")
+        child.expect_exact("[START]")
+        for op in ("erase", "write", "read"):
+            child.expect(op + r": \d+ bytes in \d+ us \(\d+ kiB/s\)")
+        child.expect_exact("[SUCCESS]")
 
 
 if __name__ == "__main__":
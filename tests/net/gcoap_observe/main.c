@@ -0,0 +1,302 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the Observe registrations of gcoap
+ *
+ * Clients on the loopback interface register with the gcoap server for a set
+ * of resources. With a single index bucket (see Makefile), all resources share
+ * one chain of the Observe registration index.
+ *
+ * @}
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "net/gcoap.h"
+#include "net/sock/udp.h"
+#include "test_utils/expect.h"
+#include "timex.h"
+
+#define OBS_CLIENTS         (3U)
+#define OBS_RESOURCES       (3U)
+#define OBS_TIMEOUT_US      (100U * US_PER_MS)
+#define OBS_CLIENT_PORT     (61616U)
+
+static ssize_t _obs_handler(coap_pkt_t *pdu, uint8_t *buf, size_t len,
+                            coap_request_ctx_t *ctx)
+{
+    (void)ctx;
+    gcoap_resp_init(pdu, buf, len, COAP_CODE_CONTENT);
+    return coap_opt_finish(pdu, COAP_OPT_FINISH_NONE);
+}
+
+static const coap_resource_t obs_resources[] = {
+    { .path = "/obs/a", .methods = COAP_GET, .handler = _obs_handler },
+    { .path = "/obs/b", .methods = COAP_GET, .handler = _obs_handler },
+    { .path = "/obs/c", .methods = COAP_GET, .handler = _obs_handler },
+};
+
+static gcoap_listener_t obs_listener = {
+    .resources     = &obs_resources[0],
+    .resources_len = ARRAY_SIZE(obs_resources),
+    .link_encoder  = NULL,
+    .next          = NULL
+};
+
+static sock_udp_t _obs_clients[OBS_CLIENTS];
+static uint16_t _obs_msg_id;
+
+static const sock_udp_ep_t _obs_server = {
+    .family = AF_INET6,
+    .addr   = { .ipv6 = { [15] = 1 } },     /* ::1 */
+    .port   = CONFIG_GCOAP_PORT,
+};
+
+static void _obs_set_up(void)
+{
+    for (unsigned i = 0; i < OBS_CLIENTS; i++) {
+        sock_udp_ep_t local = { .family = AF_INET6, .port = OBS_CLIENT_PORT + i };
+
+        expect(sock_udp_create(&_obs_clients[i], &local, NULL, 0) == 0);
+    }
+}
+
+/* The token identifies the registration: client, resource and a variant to
+ * re-register with a different token. */
+static void _obs_token(uint8_t *token, unsigned client, unsigned res,
+                       unsigned variant)
+{
+    token[0] = 0xc0 | client;
+    token[1] = (variant << 4) | res;
+}
+
+/* Returns the Observe value of the response, -1 if it had none and -2 if no
+ * valid response arrived */
+static int _obs_request(unsigned client, unsigned res, unsigned variant,
+                        uint32_t observe)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    uint8_t token[2];
+    coap_pkt_t pdu;
+    uint8_t *pos;
+    ssize_t len;
+
+    _obs_token(token, client, res, variant);
+    len = coap_build_hdr((coap_hdr_t *)buf, COAP_TYPE_NON, token, sizeof(token),
+                         COAP_METHOD_GET, _obs_msg_id++);
+    pos = buf + len;
+    pos += coap_opt_put_uint(pos, 0, COAP_OPT_OBSERVE, observe);
+    pos += coap_opt_put_uri_path(pos, COAP_OPT_OBSERVE, obs_resources[res].path);
+    if (sock_udp_send(&_obs_clients[client], buf, pos - buf, &_obs_server) < 0) {
+        return -2;
+    }
+
+    len = sock_udp_recv(&_obs_clients[client], buf, sizeof(buf), OBS_TIMEOUT_US,
+                        NULL);
+    if ((len <= 0) || (coap_parse(&pdu, buf, len) < 0) ||
+        (coap_get_code_raw(&pdu) != COAP_CODE_CONTENT) ||
+        (coap_get_token_len(&pdu) != sizeof(token)) ||
+        memcmp(coap_get_token(&pdu), token, sizeof(token))) {
+        return -2;
+    }
+    return coap_has_observe(&pdu) ? (int)coap_get_observe(&pdu) : -1;
+}
+
+static size_t _obs_notify_all(unsigned res)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+
+    if (gcoap_obs_init(&pdu, buf, sizeof(buf), &obs_resources[res])
+            != GCOAP_OBS_INIT_OK) {
+        return 0;
+    }
+    ssize_t len = coap_opt_finish(&pdu, COAP_OPT_FINISH_PAYLOAD);
+
+    pdu.payload[0] = 'a' + res;
+    return gcoap_obs_notify_all(buf, len + 1, &obs_resources[res]);
+}
+
+/* Returns the second byte of the token of the notification received, -1 if
+ * none arrived and -2 if it was not a valid notification for the client */
+static int _obs_notification(unsigned client)
+{
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+    const uint8_t *token;
+    ssize_t len;
+
+    len = sock_udp_recv(&_obs_clients[client], buf, sizeof(buf), OBS_TIMEOUT_US,
+                        NULL);
+    if (len <= 0) {
+        return -1;
+    }
+    if ((coap_parse(&pdu, buf, len) < 0) || !coap_has_observe(&pdu) ||
+        (coap_get_token_len(&pdu) != 2)) {
+        return -2;
+    }
+    token = coap_get_token(&pdu);
+    if ((token[0] != (0xc0 | client)) || (pdu.payload_len != 1) ||
+        (pdu.payload[0] != 'a' + (token[1] & 0xf))) {
+        return -2;
+    }
+    return token[1];
+}
+
+/* Deregisters every token the tests may have used */
+static void _obs_tear_down(void)
+{
+    for (unsigned client = 0; client < OBS_CLIENTS; client++) {
+        for (unsigned res = 0; res < OBS_RESOURCES; res++) {
+            for (unsigned variant = 0; variant < 2; variant++) {
+                _obs_request(client, res, variant, COAP_OBS_DEREGISTER);
+            }
+        }
+        sock_udp_close(&_obs_clients[client]);
+    }
+}
+
+/*
+ * A registration is confirmed with an Observe option in the response, and
+ * only the registered resource has an observer.
+ */
+static void test_gcoap__obs_register(void)
+{
+    TEST_ASSERT(_obs_request(0, 0, 0, COAP_OBS_REGISTER) >= 0);
+
+    TEST_ASSERT_EQUAL_INT(1, _obs_notify_all(0));
+    TEST_ASSERT_EQUAL_INT(0x00, _obs_notification(0));
+
+    uint8_t buf[CONFIG_GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+    TEST_ASSERT_EQUAL_INT(GCOAP_OBS_INIT_UNUSED,
+                          gcoap_obs_init(&pdu, buf, sizeof(buf), &obs_resources[1]));
+    TEST_ASSERT_EQUAL_INT(GCOAP_OBS_INIT_OK,
+                          gcoap_obs_init(&pdu, buf, sizeof(buf), &obs_resources[0]));
+    ssize_t len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    TEST_ASSERT_EQUAL_INT(0, gcoap_obs_notify_all(buf, len, &obs_resources[1]));
+    TEST_ASSERT_EQUAL_INT(-1, _obs_notification(0));
+}
+
+/*
+ * Re-registering with the same token keeps a single registration. A new token
+ * from the same client replaces the old one.
+ */
+static void test_gcoap__obs_reregister(void)
+{
+    TEST_ASSERT(_obs_request(0, 0, 0, COAP_OBS_REGISTER) >= 0);
+    TEST_ASSERT(_obs_request(0, 0, 0, COAP_OBS_REGISTER) >= 0);
+    TEST_ASSERT_EQUAL_INT(1, _obs_notify_all(0));
+    TEST_ASSERT_EQUAL_INT(0x00, _obs_notification(0));
+    TEST_ASSERT_EQUAL_INT(-1, _obs_notification(0));
+
+    TEST_ASSERT(_obs_request(0, 0, 1, COAP_OBS_REGISTER) >= 0);
+    TEST_ASSERT_EQUAL_INT(1, _obs_notify_all(0));
+    TEST_ASSERT_EQUAL_INT(0x10, _obs_notification(0));
+    TEST_ASSERT_EQUAL_INT(-1, _obs_notification(0));
+
+    /* the token moves to another resource that nobody observes yet */
+    TEST_ASSERT(_obs_request(0, 1, 1, COAP_OBS_REGISTER) >= 0);
+    TEST_ASSERT_EQUAL_INT(0, _obs_notify_all(0));
+    TEST_ASSERT_EQUAL_INT(1, _obs_notify_all(1));
+    TEST_ASSERT_EQUAL_INT(0x11, _obs_notification(0));
+}
+
+/*
+ * Deregistering removes only the registration of that client. The number of
+ * observers per resource is limited.
+ */
+static void test_gcoap__obs_deregister(void)
+{
+    TEST_ASSERT(_obs_request(0, 0, 0, COAP_OBS_REGISTER) >= 0);
+    TEST_ASSERT(_obs_request(1, 0, 0, COAP_OBS_REGISTER) >= 0);
+    /* CONFIG_GCOAP_OBS_RESOURCE_OBSERVERS_MAX reached */
+    TEST_ASSERT_EQUAL_INT(-1, _obs_request(2, 0, 0, COAP_OBS_REGISTER));
+    TEST_ASSERT_EQUAL_INT(2, _obs_notify_all(0));
+    TEST_ASSERT_EQUAL_INT(0x00, _obs_notification(0));
+    TEST_ASSERT_EQUAL_INT(0x00, _obs_notification(1));
+    TEST_ASSERT_EQUAL_INT(-1, _obs_notification(2));
+
+    TEST_ASSERT_EQUAL_INT(-1, _obs_request(0, 0, 0, COAP_OBS_DEREGISTER));
+    TEST_ASSERT_EQUAL_INT(1, _obs_notify_all(0));
+    TEST_ASSERT_EQUAL_INT(-1, _obs_notification(0));
+    TEST_ASSERT_EQUAL_INT(0x00, _obs_notification(1));
+
+    /* the slot is free again */
+    TEST_ASSERT(_obs_request(2, 0, 0, COAP_OBS_REGISTER) >= 0);
+    TEST_ASSERT_EQUAL_INT(-1, _obs_request(1, 0, 0, COAP_OBS_DEREGISTER));
+    TEST_ASSERT_EQUAL_INT(1, _obs_notify_all(0));
+    TEST_ASSERT_EQUAL_INT(-1, _obs_notification(1));
+    TEST_ASSERT_EQUAL_INT(0x00, _obs_notification(2));
+
+    TEST_ASSERT_EQUAL_INT(-1, _obs_request(2, 0, 0, COAP_OBS_DEREGISTER));
+    TEST_ASSERT_EQUAL_INT(0, _obs_notify_all(0));
+}
+
+/*
+ * gcoap_obs_notify_all() notifies the observers of one resource only, although
+ * the registrations of all resources share an index bucket.
+ */
+static void test_gcoap__obs_notify_all(void)
+{
+    gcoap_obs_stats_t before, after;
+    static const unsigned observers[] = { 2, 2, 1 };
+
+    for (unsigned res = 0; res < OBS_RESOURCES; res++) {
+        TEST_ASSERT(_obs_request(0, res, 0, COAP_OBS_REGISTER) >= 0);
+    }
+    TEST_ASSERT(_obs_request(1, 0, 0, COAP_OBS_REGISTER) >= 0);
+    TEST_ASSERT(_obs_request(1, 1, 0, COAP_OBS_REGISTER) >= 0);
+
+    gcoap_obs_get_stats(&before);
+    for (unsigned res = 0; res < OBS_RESOURCES; res++) {
+        TEST_ASSERT_EQUAL_INT(observers[res], _obs_notify_all(res));
+        TEST_ASSERT_EQUAL_INT(res, _obs_notification(0));
+        if (observers[res] > 1) {
+            TEST_ASSERT_EQUAL_INT(res, _obs_notification(1));
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(-1, _obs_notification(0));
+    TEST_ASSERT_EQUAL_INT(-1, _obs_notification(1));
+    gcoap_obs_get_stats(&after);
+
+    TEST_ASSERT_EQUAL_INT(OBS_RESOURCES, after.bursts - before.bursts);
+    TEST_ASSERT_EQUAL_INT(5, after.notifications - before.notifications);
+}
+
+static Test *tests_gcoap_obs(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_gcoap__obs_register),
+        new_TestFixture(test_gcoap__obs_reregister),
+        new_TestFixture(test_gcoap__obs_deregister),
+        new_TestFixture(test_gcoap__obs_notify_all),
+    };
+
+    EMB_UNIT_TESTCALLER(gcoap_obs_tests, _obs_set_up, _obs_tear_down, fixtures);
+
+    return (Test *)&gcoap_obs_tests;
+}
+
+int main(void)
+{
+    gcoap_register_listener(&obs_listener);
+
+    TESTS_START();
+    TESTS_RUN(tests_gcoap_obs());
+    TESTS_END();
+
+    return 0;
+}
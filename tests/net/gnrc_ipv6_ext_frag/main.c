@@ -19,6 +19,7 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <string.h>
@@ -26,10 +27,13 @@
 #include "byteorder.h"
 #include "clist.h"
 #include "embUnit.h"
+#include "macros/utils.h"
+#include "msg.h"
 #include "net/ipv6/addr.h"
 #include "net/ipv6/ext/frag.h"
 #include "net/protnum.h"
 #include "net/gnrc.h"
+#include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/ext.h"
 #include "net/gnrc/ipv6/ext/frag.h"
 #include "net/gnrc/ipv6/hdr.h"
@@ -41,6 +45,7 @@
 #include "random.h"
 #include "shell.h"
 #include "test_utils/expect.h"
+#include "thread.h"
 #include "xtimer.h"
 
 #define TEST_SAMPLE         "This is a test. Failure might sometimes be an " \
@@ -75,11 +80,24 @@
 #define TEST_FRAG3_OFFSET   (48U)
 #define TEST_PAYLOAD_LEN    (21U)
 #define TEST_HL             (64U)
+#define TEST_MSG_QUEUE_SIZE (8U)
+#define TEST_MSG_TYPE_FILL  (0x7e57U)
+#define TEST_BURST_MTU      (128U)
+/* fragmentable part per fragment: path MTU - IPv6 header - fragment header */
+#define TEST_BURST_FRAG_LEN (TEST_BURST_MTU - sizeof(ipv6_hdr_t) - \
+                             sizeof(ipv6_ext_frag_t))
+#define TEST_BURST_FRAGS    (2 * CONFIG_GNRC_IPV6_EXT_FRAG_SEND_BURST + 1)
+/* UDP payload, so the last of TEST_BURST_FRAGS fragments is half-full */
+#define TEST_BURST_PAYLOAD_LEN  (((TEST_BURST_FRAGS - 1) * TEST_BURST_FRAG_LEN) + \
+                                 (TEST_BURST_FRAG_LEN / 2) - sizeof(udp_hdr_t))
 
 extern int udp_cmd(int argc, char **argv);
 /* shell_test_cmd is used to test weird snip configurations,
  * the rest can just use udp_cmd */
 static int shell_test_cmd(int argc, char **argv);
+static gnrc_pktsnip_t *_build_udp_packet(const ipv6_addr_t *dst,
+                                         unsigned payload_size,
+                                         gnrc_pktsnip_t *payload);
 
 static netdev_test_t mock_netdev;
 static gnrc_netif_t *eth_netif, *mock_netif;
@@ -87,6 +105,8 @@ static gnrc_netif_t _netif;
 static ipv6_addr_t *local_addr;
 static char mock_netif_stack[THREAD_STACKSIZE_DEFAULT];
 static char line_buf[SHELL_DEFAULT_BUFSIZE];
+static msg_t _main_msg_queue[TEST_MSG_QUEUE_SIZE];
+static kernel_pid_t _ipv6_pid = KERNEL_PID_UNDEF;
 
 static const ipv6_addr_t _src = { .u8 = TEST_SRC };
 static const ipv6_addr_t _dst = { .u8 = TEST_DST };
@@ -97,6 +117,14 @@ static const uint8_t _test_frag3[] = TEST_FRAG3;
 
 static void tear_down_tests(void)
 {
+    msg_t msg;
+
+    /* drop what test_ipv6_ext_frag_send_burst() left in the message queue */
+    while (msg_try_receive(&msg) > 0) {}
+    if (_ipv6_pid != KERNEL_PID_UNDEF) {
+        gnrc_ipv6_pid = _ipv6_pid;
+        _ipv6_pid = KERNEL_PID_UNDEF;
+    }
     gnrc_ipv6_ext_frag_init();
     gnrc_pktbuf_init();
 }
@@ -248,14 +276,11 @@ static void test_ipv6_ext_frag_reass_in_order(void)
     TEST_ASSERT_NOT_NULL(ptr);
     ptr = ptr->next;
     TEST_ASSERT_NOT_NULL(ptr);
+    /* adjacent limits are merged */
     TEST_ASSERT_EQUAL_INT(0, ptr->start);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET / 8, ptr->end);
-    TEST_ASSERT_NOT_NULL(ptr->next);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET / 8, ptr->start);
     TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->end);
     TEST_ASSERT(((clist_node_t *)ptr) == rbuf->limits.next);
+    TEST_ASSERT_EQUAL_INT(2, rbuf->frags);
     TEST_ASSERT(memcmp(_exp_payload, rbuf->pkt->data, rbuf->pkt->size) == 0);
 
     /* prepare 3rd fragment */
@@ -354,14 +379,11 @@ static void test_ipv6_ext_frag_reass_out_of_order(void)
     TEST_ASSERT_NOT_NULL(ptr);
     ptr = ptr->next;
     TEST_ASSERT_NOT_NULL(ptr);
+    /* adjacent limits are merged */
     TEST_ASSERT_EQUAL_INT(TEST_FRAG2_OFFSET / 8, ptr->start);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->end);
-    ptr = ptr->next;
-    TEST_ASSERT_NOT_NULL(ptr);
-    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->start);
     TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload) / 8, ptr->end);
-    TEST_ASSERT_NOT_NULL(ptr->next);
     TEST_ASSERT(((clist_node_t *)ptr) == rbuf->limits.next);
+    TEST_ASSERT_EQUAL_INT(2, rbuf->frags);
     TEST_ASSERT(memcmp(&_exp_payload[TEST_FRAG2_OFFSET],
                        (uint8_t *)rbuf->pkt->data + TEST_FRAG2_OFFSET,
                        rbuf->pkt->size - TEST_FRAG2_OFFSET) == 0);
@@ -479,6 +501,176 @@ static void test_ipv6_ext_frag_reass_one_frag(void)
     gnrc_pktbuf_is_empty();
 }
 
+static gnrc_pktsnip_t *_build_frag(const uint8_t *data, size_t size,
+                                   unsigned offset, bool more)
+{
+    gnrc_pktsnip_t *ipv6_snip = gnrc_ipv6_hdr_build(NULL, &_src, &_dst);
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(ipv6_snip, data, size,
+                                          GNRC_NETTYPE_UNDEF);
+    ipv6_hdr_t *ipv6 = ipv6_snip->data;
+    ipv6_ext_frag_t *frag = pkt->data;
+
+    ipv6->nh = PROTNUM_IPV6_EXT_FRAG;
+    ipv6->hl = TEST_HL;
+    ipv6->len = byteorder_htons(pkt->size);
+    frag->nh = PROTNUM_UDP;
+    frag->resv = 0U;
+    ipv6_ext_frag_set_offset(frag, offset);
+    if (more) {
+        ipv6_ext_frag_set_more(frag);
+    }
+    frag->id = byteorder_htonl(TEST_ID);
+    return pkt;
+}
+
+static void test_ipv6_ext_frag_reass_duplicate(void)
+{
+    gnrc_pktsnip_t *pkt;
+    gnrc_ipv6_ext_frag_rbuf_t *rbuf;
+    gnrc_ipv6_ext_frag_limits_t *ptr;
+
+    pkt = _build_frag(_test_frag1, sizeof(_test_frag1), TEST_FRAG1_OFFSET,
+                      true);
+    TEST_ASSERT_NULL(gnrc_ipv6_ext_frag_reass(pkt));
+    pkt = _build_frag(_test_frag2, sizeof(_test_frag2), TEST_FRAG2_OFFSET,
+                      true);
+    TEST_ASSERT_NULL(gnrc_ipv6_ext_frag_reass(pkt));
+    /* 1st fragment again, now within the merged limits of 1st and 2nd */
+    pkt = _build_frag(_test_frag1, sizeof(_test_frag1), TEST_FRAG1_OFFSET,
+                      true);
+    TEST_ASSERT_NOT_NULL((rbuf = gnrc_ipv6_ext_frag_rbuf_get(pkt->next->data,
+                                                             TEST_ID)));
+    TEST_ASSERT_NULL(gnrc_ipv6_ext_frag_reass(pkt));
+    TEST_ASSERT_EQUAL_INT(2, rbuf->frags);
+    ptr = (gnrc_ipv6_ext_frag_limits_t *)rbuf->limits.next;
+    TEST_ASSERT_NOT_NULL(ptr);
+    TEST_ASSERT(ptr->next == ptr);
+    TEST_ASSERT_EQUAL_INT(0, ptr->start);
+    TEST_ASSERT_EQUAL_INT(TEST_FRAG3_OFFSET / 8, ptr->end);
+
+    pkt = _build_frag(_test_frag3, sizeof(_test_frag3), TEST_FRAG3_OFFSET,
+                      false);
+    TEST_ASSERT_NOT_NULL((pkt = gnrc_ipv6_ext_frag_reass(pkt)));
+    TEST_ASSERT_NULL(rbuf->ipv6);
+    TEST_ASSERT_EQUAL_INT(sizeof(_exp_payload), pkt->size);
+    TEST_ASSERT(memcmp(_exp_payload, pkt->data, pkt->size) == 0);
+    gnrc_pktbuf_release(pkt);
+    gnrc_pktbuf_is_empty();
+}
+
+/**
+ * @brief   Receives the messages of one fragmentation round
+ *
+ * @param[out] snd_buf  The send buffer of the GNRC_IPV6_EXT_FRAG_CONTINUE
+ *                      message, NULL if there was none.
+ * @param[in,out] offset    The offset the next fragment is expected at.
+ *
+ * @return  Number of fragments received.
+ * @return  -1 if a fragment with an unexpected offset was received.
+ * @return  -2 if a message followed the GNRC_IPV6_EXT_FRAG_CONTINUE message.
+ */
+static int _recv_burst(gnrc_ipv6_ext_frag_send_t **snd_buf, unsigned *offset)
+{
+    msg_t msg;
+    int frags = 0;
+
+    *snd_buf = NULL;
+    while (msg_try_receive(&msg) > 0) {
+        gnrc_pktsnip_t *frag;
+
+        if (*snd_buf != NULL) {
+            return -2;
+        }
+        switch (msg.type) {
+        case GNRC_IPV6_EXT_FRAG_SEND:
+            /* netif header -> IPv6 header -> fragment header -> payload */
+            frag = msg.content.ptr;
+            if (ipv6_ext_frag_get_offset(frag->next->next->data) != *offset) {
+                gnrc_pktbuf_release(frag);
+                return -1;
+            }
+            *offset += gnrc_pkt_len(frag->next->next->next);
+            gnrc_pktbuf_release(frag);
+            frags++;
+            break;
+        case GNRC_IPV6_EXT_FRAG_CONTINUE:
+            *snd_buf = msg.content.ptr;
+            break;
+        default:
+            /* TEST_MSG_TYPE_FILL */
+            break;
+        }
+    }
+    return frags;
+}
+
+static void test_ipv6_ext_frag_send_burst(void)
+{
+    gnrc_ipv6_ext_frag_stats_t *stats = gnrc_ipv6_ext_frag_stats();
+    gnrc_ipv6_ext_frag_stats_t exp;
+    gnrc_ipv6_ext_frag_send_t *snd_buf = NULL;
+    ipv6_addr_t *prev_local_addr = local_addr;
+    ipv6_addr_t src = _src;
+    gnrc_pktsnip_t *pkt;
+    unsigned offset = 0, sent = 0, rounds = 0;
+
+    /* cancel the reassembly garbage collection of the previous tests, its
+     * message would be queued to this thread in between the fragments */
+    gnrc_ipv6_ext_frag_init();
+    TEST_ASSERT_NOT_NULL(stats);
+    TEST_ASSERT(CONFIG_GNRC_IPV6_EXT_FRAG_SEND_BURST > 1);
+    TEST_ASSERT(CONFIG_GNRC_IPV6_EXT_FRAG_SEND_BURST < (TEST_MSG_QUEUE_SIZE - 1));
+    exp = *stats;
+    local_addr = &src;
+    pkt = _build_udp_packet(&_dst, TEST_BURST_PAYLOAD_LEN, NULL);
+    local_addr = prev_local_addr;
+    TEST_ASSERT_NOT_NULL(pkt);
+    /* queue the fragments to this thread instead of gnrc_ipv6, so the
+     * fragments of every round can be counted */
+    _ipv6_pid = gnrc_ipv6_pid;
+    gnrc_ipv6_pid = thread_getpid();
+    do {
+        /* every other round the queue is nearly full, so only one fragment
+         * is sent and the remaining slot is left for the continue message */
+        bool nearly_full = (rounds % 2) == 1;
+        unsigned burst = (nearly_full) ? 1 : CONFIG_GNRC_IPV6_EXT_FRAG_SEND_BURST;
+        int frags;
+
+        if (nearly_full) {
+            for (unsigned i = 0; i < (TEST_MSG_QUEUE_SIZE - 2); i++) {
+                msg_t msg = { .type = TEST_MSG_TYPE_FILL };
+
+                TEST_ASSERT_EQUAL_INT(1, msg_send_to_self(&msg));
+            }
+        }
+        if (rounds == 0) {
+            gnrc_ipv6_ext_frag_send_pkt(pkt, TEST_BURST_MTU);
+        }
+        else {
+            gnrc_ipv6_ext_frag_send(snd_buf);
+        }
+        rounds++;
+        frags = _recv_burst(&snd_buf, &offset);
+        TEST_ASSERT_EQUAL_INT(MIN(burst, TEST_BURST_FRAGS - sent), frags);
+        sent += frags;
+        /* the datagram is continued in a later round until all is sent */
+        TEST_ASSERT((sent < TEST_BURST_FRAGS) == (snd_buf != NULL));
+    } while (snd_buf != NULL);
+    gnrc_ipv6_pid = _ipv6_pid;
+    _ipv6_pid = KERNEL_PID_UNDEF;
+
+    TEST_ASSERT_EQUAL_INT(TEST_BURST_PAYLOAD_LEN + sizeof(udp_hdr_t), offset);
+    /* full bursts alternate with single fragments */
+    TEST_ASSERT_EQUAL_INT(3, rounds);
+    exp.sent_fragments += TEST_BURST_FRAGS;
+    exp.sent_datagrams++;
+    exp.bursts += rounds;
+    TEST_ASSERT_EQUAL_INT(exp.sent_fragments, stats->sent_fragments);
+    TEST_ASSERT_EQUAL_INT(exp.sent_datagrams, stats->sent_datagrams);
+    TEST_ASSERT_EQUAL_INT(exp.bursts, stats->bursts);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
 static void run_unittests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -490,6 +682,8 @@ static void run_unittests(void)
         new_TestFixture(test_ipv6_ext_frag_reass_out_of_order),
         new_TestFixture(test_ipv6_ext_frag_reass_out_of_order_rbuf_full),
         new_TestFixture(test_ipv6_ext_frag_reass_one_frag),
+        new_TestFixture(test_ipv6_ext_frag_reass_duplicate),
+        new_TestFixture(test_ipv6_ext_frag_send_burst),
     };
 
     EMB_UNIT_TESTCALLER(ipv6_ext_frag_tests, NULL, tear_down_tests, fixtures);
@@ -678,6 +872,7 @@ static const shell_command_t shell_commands[] = {
 
 int main(void)
 {
+    msg_init_queue(_main_msg_queue, TEST_MSG_QUEUE_SIZE);
     eth_netif = gnrc_netif_iter(NULL);
     /* create mock netif to test forwarding too large fragments */
     netdev_test_setup(&mock_netdev, 0);
@@ -0,0 +1,238 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the slab implementation of the GNRC packet buffer
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "kernel_defines.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/pktbuf.h"
+
+#define LARGE_PKT_SIZE      (1280U)
+#define SMALL_PKT_NUMOF     (12U)
+#define STRESS_ROUNDS       (10000U)
+
+static uint8_t _data[CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE];
+
+static uint32_t _lcg_state;
+
+static uint32_t _lcg(void)
+{
+    _lcg_state = (_lcg_state * 1103515245U) + 12345U;
+    return _lcg_state >> 8;
+}
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+    for (unsigned i = 0; i < sizeof(_data); i++) {
+        _data[i] = i & 0xff;
+    }
+}
+
+static void tear_down(void)
+{
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_slab_add__success(void)
+{
+    static const size_t sizes[] = {
+        1, CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE,
+        CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE + 1,
+        CONFIG_GNRC_PKTBUF_SLAB_MEDIUM_SIZE,
+        CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE,
+    };
+
+    for (unsigned i = 0; i < ARRAY_SIZE(sizes); i++) {
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _data, sizes[i],
+                                              GNRC_NETTYPE_UNDEF);
+
+        TEST_ASSERT_NOT_NULL(pkt);
+        TEST_ASSERT_EQUAL_INT(sizes[i], pkt->size);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(_data, pkt->data, sizes[i]));
+        TEST_ASSERT_EQUAL_INT(0, (uintptr_t)pkt->data % 8);
+        TEST_ASSERT(gnrc_pktbuf_is_sane());
+        gnrc_pktbuf_release(pkt);
+    }
+}
+
+static void test_pktbuf_slab_add__too_large(void)
+{
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL,
+                                     CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE + 1,
+                                     GNRC_NETTYPE_UNDEF));
+}
+
+static void test_pktbuf_slab_add__fallback(void)
+{
+    gnrc_pktsnip_t *pkt = NULL;
+
+    /* exhausting the small class must not make small allocations fail */
+    for (unsigned i = 0; i <= CONFIG_GNRC_PKTBUF_SLAB_SMALL_NUMOF; i++) {
+        gnrc_pktsnip_t *tmp = gnrc_pktbuf_add(pkt, _data, 8, GNRC_NETTYPE_UNDEF);
+
+        TEST_ASSERT_NOT_NULL(tmp);
+        pkt = tmp;
+    }
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+}
+
+static void test_pktbuf_slab_mark__aligned(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _data, LARGE_PKT_SIZE,
+                                          GNRC_NETTYPE_UNDEF);
+    gnrc_pktsnip_t *hdr;
+    void *data;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    TEST_ASSERT_NOT_NULL((hdr = gnrc_pktbuf_mark(pkt, 40, GNRC_NETTYPE_UNDEF)));
+    /* no data was moved */
+    TEST_ASSERT(hdr->data == data);
+    TEST_ASSERT(pkt->data == ((uint8_t *)data) + 40);
+    TEST_ASSERT_EQUAL_INT(LARGE_PKT_SIZE - 40, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data + 40, pkt->data, pkt->size));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+}
+
+static void test_pktbuf_slab_mark__unaligned(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _data, LARGE_PKT_SIZE,
+                                          GNRC_NETTYPE_UNDEF);
+    gnrc_pktsnip_t *hdr;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    TEST_ASSERT_NOT_NULL((hdr = gnrc_pktbuf_mark(pkt, 13, GNRC_NETTYPE_UNDEF)));
+    TEST_ASSERT_EQUAL_INT(13, hdr->size);
+    TEST_ASSERT_EQUAL_INT(LARGE_PKT_SIZE - 13, pkt->size);
+    TEST_ASSERT_EQUAL_INT(0, (uintptr_t)pkt->data % 8);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data, hdr->data, hdr->size));
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data + 13, pkt->data, pkt->size));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+}
+
+static void test_pktbuf_slab_realloc_data(void)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _data, 10, GNRC_NETTYPE_UNDEF);
+    void *data;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    /* grows within its block */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 20));
+    TEST_ASSERT(pkt->data == data);
+    /* needs a larger block */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, LARGE_PKT_SIZE));
+    TEST_ASSERT(pkt->data != data);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(_data, pkt->data, 10));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 100));
+    TEST_ASSERT_EQUAL_INT(100, pkt->size);
+    TEST_ASSERT_EQUAL_INT(ENOMEM, gnrc_pktbuf_realloc_data(pkt,
+                                    CONFIG_GNRC_PKTBUF_SLAB_LARGE_SIZE + 1));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+}
+
+/* Interleaves small packets (as e.g. ACKs or CoAP messages) with full-MTU
+ * datagrams for a while. A full-MTU datagram must always fit as long as
+ * less than CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF of them are held, no matter
+ * how fragmented the rest of the packet buffer is. */
+static void test_pktbuf_slab_fragmentation_stress(void)
+{
+    gnrc_pktsnip_t *small[SMALL_PKT_NUMOF] = { NULL };
+    gnrc_pktsnip_t *large[CONFIG_GNRC_PKTBUF_SLAB_LARGE_NUMOF] = { NULL };
+
+    _lcg_state = 0x2a;
+    for (unsigned round = 0; round < STRESS_ROUNDS; round++) {
+        unsigned i = _lcg() % SMALL_PKT_NUMOF;
+        unsigned j = _lcg() % ARRAY_SIZE(large);
+
+        if (small[i] != NULL) {
+            gnrc_pktbuf_release(small[i]);
+            small[i] = NULL;
+        }
+        else {
+            size_t size = 1 + (_lcg() % CONFIG_GNRC_PKTBUF_SLAB_SMALL_SIZE);
+
+            small[i] = gnrc_pktbuf_add(NULL, _data, size, GNRC_NETTYPE_UNDEF);
+            TEST_ASSERT_NOT_NULL(small[i]);
+            if ((size > 8) && (_lcg() & 1)) {
+                TEST_ASSERT_NOT_NULL(gnrc_pktbuf_mark(small[i], size / 2,
+                                                      GNRC_NETTYPE_UNDEF));
+            }
+        }
+        if (large[j] != NULL) {
+            if (_lcg() & 1) {
+                gnrc_pktbuf_release(large[j]);
+                large[j] = NULL;
+            }
+        }
+        else {
+            large[j] = gnrc_pktbuf_add(NULL, NULL, LARGE_PKT_SIZE,
+                                       GNRC_NETTYPE_UNDEF);
+            TEST_ASSERT_NOT_NULL(large[j]);
+            TEST_ASSERT_NOT_NULL(gnrc_pktbuf_mark(large[j], 40,
+                                                  GNRC_NETTYPE_UNDEF));
+        }
+        TEST_ASSERT(gnrc_pktbuf_is_sane());
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(small); i++) {
+        gnrc_pktbuf_release(small[i]);
+    }
+    for (unsigned j = 0; j < ARRAY_SIZE(large); j++) {
+        gnrc_pktbuf_release(large[j]);
+    }
+#ifdef DEVELHELP
+    gnrc_pktbuf_stats();
+#endif
+}
+
+static Test *tests_gnrc_pktbuf_slab(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_pktbuf_slab_add__success),
+        new_TestFixture(test_pktbuf_slab_add__too_large),
+        new_TestFixture(test_pktbuf_slab_add__fallback),
+        new_TestFixture(test_pktbuf_slab_mark__aligned),
+        new_TestFixture(test_pktbuf_slab_mark__unaligned),
+        new_TestFixture(test_pktbuf_slab_realloc_data),
+        new_TestFixture(test_pktbuf_slab_fragmentation_stress),
+    };
+
+    EMB_UNIT_TESTCALLER(tests, set_up, tear_down, fixtures);
+
+    return (Test *)&tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_gnrc_pktbuf_slab());
+    TESTS_END();
+
+    return 0;
+}
@@ -18,11 +18,15 @@
  * @}
  */
 
+#include <assert.h>
+
 #include "embUnit.h"
+#include "macros/utils.h"
 #include "net/gnrc/pktbuf.h"
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/sixlowpan/frag.h"
 #include "net/gnrc/sixlowpan/frag/rb.h"
+#include "net/gnrc/sixlowpan/frag/stats.h"
 #include "xtimer.h"
 
 #define TEST_NETIF_HDR_SRC      { 0xb3, 0x47, 0x60, 0x49, \
@@ -34,6 +38,20 @@
 #define TEST_PAGE               (0)
 #define TEST_RECEIVE_TIMEOUT    (100U)
 #define TEST_GC_TIMEOUT         (CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US + TEST_RECEIVE_TIMEOUT)
+#define TEST_LATENCY_US         (10000U)
+#define TEST_COLLIDING_NUMOF    (4U)
+
+/* tests/net/gnrc_sixlowpan_frag_rb_small builds this file with
+ * RBUF_HASH_SIZE and RBUF_INT_SIZE set, so all entries collide in one bucket
+ * of the look-up table, and the intervals of three incomplete datagrams with
+ * 3, 3, and 2 fragments fill the interval pool */
+#if defined(RBUF_HASH_SIZE) && defined(RBUF_INT_SIZE)
+#define TEST_SMALL_RBUF         (1)
+static_assert(RBUF_HASH_SIZE == 1, "RBUF_HASH_SIZE must be 1");
+static_assert(RBUF_INT_SIZE == 8, "RBUF_INT_SIZE must be 8");
+static_assert(CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE >= TEST_COLLIDING_NUMOF,
+              "CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_SIZE too small");
+#endif
 
 /* test date taken from an experimental run (uncompressed ICMPv6 echo reply with
  * 300 byte payload)*/
@@ -639,6 +657,212 @@ static void test_rbuf_gc__timed(void)
     _check_pktbuf(NULL);
 }
 
+static gnrc_sixlowpan_frag_rb_t *_add_fragment(uint8_t *fragment, size_t size,
+                                               uint16_t tag, size_t offset)
+{
+    gnrc_pktsnip_t *pkt;
+
+    _set_fragment_tag(fragment, tag);
+    pkt = gnrc_pktbuf_add(NULL, fragment, size, GNRC_NETTYPE_SIXLOWPAN);
+    if (pkt == NULL) {
+        return NULL;
+    }
+    return gnrc_sixlowpan_frag_rb_add(&_test_netif_hdr.hdr, pkt, offset,
+                                      TEST_PAGE);
+}
+
+#ifdef TEST_SMALL_RBUF
+static unsigned _ints_count(const gnrc_sixlowpan_frag_rb_t *entry)
+{
+    unsigned count = 0;
+
+    for (gnrc_sixlowpan_frag_rb_int_t *i = entry->super.ints; i; i = i->next) {
+        count++;
+    }
+    return count;
+}
+
+/* entry 0 has the same tag as entry 1, but another destination */
+static void _set_colliding_dst(unsigned i)
+{
+    static const uint8_t other_dst[] = TEST_NETIF_HDR_DST;
+
+    if (i == 0) {
+        gnrc_netif_hdr_set_dst_addr(&_test_netif_hdr.hdr, (uint8_t *)other_dst,
+                                    sizeof(other_dst));
+    }
+    else {
+        gnrc_netif_hdr_set_dst_addr(&_test_netif_hdr.hdr,
+                                    (uint8_t *)_test_netif_hdr_dst,
+                                    sizeof(_test_netif_hdr_dst));
+    }
+}
+
+static inline uint16_t _colliding_tag(unsigned i)
+{
+    return TEST_TAG + ((i == 0) ? 0 : (i - 1));
+}
+
+static void test_rbuf_add__colliding_entries(void)
+{
+    /* with two fragments each the entries fill, but don't exceed, the
+     * interval pool */
+    gnrc_sixlowpan_frag_rb_t *entries[TEST_COLLIDING_NUMOF];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(entries); i++) {
+        _set_colliding_dst(i);
+        TEST_ASSERT_NOT_NULL((entries[i] = _add_fragment(
+                _fragment1, sizeof(_fragment1), _colliding_tag(i),
+                TEST_FRAGMENT1_OFFSET
+            )));
+        for (unsigned j = 0; j < i; j++) {
+            TEST_ASSERT(entries[i] != entries[j]);
+        }
+    }
+    /* subsequent fragments find their entry in the shared bucket */
+    for (unsigned i = 0; i < ARRAY_SIZE(entries); i++) {
+        _set_colliding_dst(i);
+        TEST_ASSERT(entries[i] == _add_fragment(_fragment2, sizeof(_fragment2),
+                                                _colliding_tag(i),
+                                                TEST_FRAGMENT2_OFFSET));
+        TEST_ASSERT_EQUAL_INT(2, _ints_count(entries[i]));
+    }
+    TEST_ASSERT(!gnrc_sixlowpan_frag_rb_exists(&_test_netif_hdr.hdr,
+                                               TEST_TAG + ARRAY_SIZE(entries)));
+    /* removing an entry from the middle of the bucket keeps the others */
+    _set_colliding_dst(1);
+    gnrc_sixlowpan_frag_rb_rm_by_datagram(&_test_netif_hdr.hdr,
+                                          _colliding_tag(1));
+    for (unsigned i = 0; i < ARRAY_SIZE(entries); i++) {
+        _set_colliding_dst(i);
+        TEST_ASSERT(((i == 1) ? NULL : entries[i]) ==
+                    gnrc_sixlowpan_frag_rb_get_by_datagram(&_test_netif_hdr.hdr,
+                                                           _colliding_tag(i)));
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(entries); i++) {
+        if (i != 1) {
+            /* releasing pkt to check if packet buffer is empty in the end */
+            gnrc_pktbuf_release(entries[i]->pkt);
+        }
+    }
+    _check_pktbuf(NULL);
+}
+
+static void test_rbuf_add__reclaim_ints(void)
+{
+    static const struct {
+        uint8_t *data;
+        size_t size;
+        size_t offset;
+    } frags[] = {
+        { _fragment1, sizeof(_fragment1), TEST_FRAGMENT1_OFFSET },
+        { _fragment2, sizeof(_fragment2), TEST_FRAGMENT2_OFFSET },
+        { _fragment3, sizeof(_fragment3), TEST_FRAGMENT3_OFFSET },
+    };
+    static const unsigned frags_num[] = { 3, 3, 2 };
+    gnrc_sixlowpan_frag_rb_t *entries[ARRAY_SIZE(frags_num)];
+
+    /* fill the interval pool, see RBUF_INT_SIZE */
+    for (unsigned e = 0; e < ARRAY_SIZE(entries); e++) {
+        for (unsigned f = 0; f < frags_num[e]; f++) {
+            TEST_ASSERT_NOT_NULL((entries[e] = _add_fragment(
+                    frags[f].data, frags[f].size, TEST_TAG + e, frags[f].offset
+                )));
+        }
+        TEST_ASSERT_EQUAL_INT(frags_num[e], _ints_count(entries[e]));
+    }
+    /* the next fragment of the newest datagram frees the intervals of the
+     * oldest one */
+    TEST_ASSERT(entries[2] == _add_fragment(frags[2].data, frags[2].size,
+                                            TEST_TAG + 2, frags[2].offset));
+    TEST_ASSERT_EQUAL_INT(3, _ints_count(entries[2]));
+    TEST_ASSERT(!gnrc_sixlowpan_frag_rb_exists(&_test_netif_hdr.hdr, TEST_TAG));
+    TEST_ASSERT(gnrc_sixlowpan_frag_rb_exists(&_test_netif_hdr.hdr,
+                                              TEST_TAG + 1));
+    TEST_ASSERT_EQUAL_INT(3, _ints_count(entries[1]));
+    /* releasing pkt to check if packet buffer is empty in the end */
+    gnrc_pktbuf_release(entries[1]->pkt);
+    _check_pktbuf(entries[2]);
+}
+#endif  /* TEST_SMALL_RBUF */
+
+static void test_rbuf_gc__reordered(void)
+{
+    gnrc_sixlowpan_frag_rb_t *entries[3];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(entries); i++) {
+        TEST_ASSERT_NOT_NULL((entries[i] = _add_fragment(
+                _fragment1, sizeof(_fragment1), TEST_TAG + i,
+                TEST_FRAGMENT1_OFFSET
+            )));
+    }
+    /* a subsequent fragment moves the first entry to the end of the expiry
+     * list */
+    TEST_ASSERT(entries[0] == _add_fragment(_fragment2, sizeof(_fragment2),
+                                            TEST_TAG, TEST_FRAGMENT2_OFFSET));
+    /* set arrival of the other entries CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US
+     * into the past */
+    for (unsigned i = 1; i < ARRAY_SIZE(entries); i++) {
+        entries[i]->super.arrival -= CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US + 1;
+    }
+    gnrc_sixlowpan_frag_rb_gc();
+    TEST_ASSERT(gnrc_sixlowpan_frag_rb_exists(&_test_netif_hdr.hdr, TEST_TAG));
+    for (unsigned i = 1; i < ARRAY_SIZE(entries); i++) {
+        TEST_ASSERT(!gnrc_sixlowpan_frag_rb_exists(&_test_netif_hdr.hdr,
+                                                   TEST_TAG + i));
+    }
+    _check_pktbuf(entries[0]);
+}
+
+static int _reassemble(uint16_t tag, uint32_t latency_us)
+{
+    gnrc_sixlowpan_frag_rb_t *entry;
+
+    if (_add_fragment(_fragment1, sizeof(_fragment1), tag,
+                      TEST_FRAGMENT1_OFFSET) == NULL) {
+        return -1;
+    }
+    xtimer_usleep(latency_us);
+    if ((_add_fragment(_fragment2, sizeof(_fragment2), tag,
+                       TEST_FRAGMENT2_OFFSET) == NULL) ||
+        (_add_fragment(_fragment3, sizeof(_fragment3), tag,
+                       TEST_FRAGMENT3_OFFSET) == NULL) ||
+        ((entry = _add_fragment(_fragment4, sizeof(_fragment4), tag,
+                                TEST_FRAGMENT4_OFFSET)) == NULL)) {
+        return -1;
+    }
+    /* nobody is registered for the datagram, so it is released */
+    if (gnrc_sixlowpan_frag_rb_dispatch_when_complete(
+            entry, &_test_netif_hdr.hdr) <= 0) {
+        return -1;
+    }
+    return 0;
+}
+
+static void test_rbuf_dispatch_when_complete__latency(void)
+{
+    gnrc_sixlowpan_frag_stats_t *stats = gnrc_sixlowpan_frag_stats_get();
+    unsigned datagrams = stats->datagrams;
+    uint64_t latency_sum = stats->latency_sum;
+    uint32_t latency_max = stats->latency_max;
+    uint32_t latency;
+
+    TEST_ASSERT_EQUAL_INT(0, _reassemble(TEST_TAG, 2 * TEST_LATENCY_US));
+    latency = stats->latency_sum - latency_sum;
+    TEST_ASSERT(latency >= (2 * TEST_LATENCY_US));
+    TEST_ASSERT(latency < CONFIG_GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US);
+    latency_max = MAX(latency_max, latency);
+    TEST_ASSERT_EQUAL_INT(latency_max, stats->latency_max);
+    latency_sum = stats->latency_sum;
+    /* a faster reassembly adds to the sum, but keeps the maximum */
+    TEST_ASSERT_EQUAL_INT(0, _reassemble(TEST_TAG + 1, TEST_LATENCY_US));
+    latency = stats->latency_sum - latency_sum;
+    TEST_ASSERT(latency >= TEST_LATENCY_US);
+    TEST_ASSERT_EQUAL_INT(MAX(latency_max, latency), stats->latency_max);
+    TEST_ASSERT_EQUAL_INT(datagrams + 2, stats->datagrams);
+    _check_pktbuf(NULL);
+}
+
 static void run_unittests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -656,6 +880,12 @@ static void run_unittests(void)
         new_TestFixture(test_rbuf_rm),
         new_TestFixture(test_rbuf_gc__manually),
         new_TestFixture(test_rbuf_gc__timed),
+#ifdef TEST_SMALL_RBUF
+        new_TestFixture(test_rbuf_add__colliding_entries),
+        new_TestFixture(test_rbuf_add__reclaim_ints),
+#endif
+        new_TestFixture(test_rbuf_gc__reordered),
+        new_TestFixture(test_rbuf_dispatch_when_complete__latency),
     };
 
     EMB_UNIT_TESTCALLER(sixlo_frag_tests, _set_up, NULL, fixtures);
@@ -16,7 +16,7 @@
 
 #define MAIN_QUEUE_SIZE (8)
 #define TCB_QUEUE_SIZE (1)
-#define BUFFER_SIZE (2049)
+#define BUFFER_SIZE (8193)
 
 static msg_t main_msg_queue[MAIN_QUEUE_SIZE];
 static gnrc_tcp_tcb_t tcbs[TCB_QUEUE_SIZE];
@@ -15,7 +15,7 @@ import base64
 from scapy.all import Ether, IPv6, TCP, raw, sendp
 
 from helpers import Runner, RiotTcpServer, RiotTcpClient, HostTcpServer, HostTcpClient, \
-                    generate_port_number, sudo_guard
+                    ScapyTcpPeer, generate_port_number, sudo_guard
 
 # Custom NO_TIMEOUT constant. Note: the value must match
 # with CUSTOM_GNRC_TCP_NO_TIMEOUT from the makefile
@@ -670,6 +670,109 @@ def test_connection_listen_accept_cycle(child, iterations=10):
                     riot_srv.abort()
 
 
+@Runner(timeout=10)
+def test_gnrc_tcp_retransmission(child):
+    """ This test verifies that an unacknowledged segment is retransmitted
+        unchanged and that gnrc_tcp_send returns once it was acknowledged.
+    """
+    # Setup RIOT as server
+    with RiotTcpServer(child, generate_port_number()) as riot_srv:
+        with ScapyTcpPeer(riot_srv) as peer:
+            child.sendline('gnrc_tcp_accept 2000')
+            peer.connect()
+            child.expect_exact('gnrc_tcp_accept: returns 0')
+
+            # Send data from RIOT and withhold the acknowledgment
+            data = '0123456789'
+            riot_srv._setup_internal_buffer()
+            riot_srv._write_data_to_internal_buffer(data)
+            child.sendline('gnrc_tcp_send 0 {}'.format(len(data)))
+
+            seg = peer.receive_segment()
+            assert bytes(seg.payload) == data.encode('utf-8')
+
+            # The retransmission timeout is at least one second
+            rexmit = peer.receive_segment(timeout=3)
+            assert rexmit.seq == seg.seq
+            assert bytes(rexmit.payload) == bytes(seg.payload)
+
+            # Acknowledge the retransmission to complete gnrc_tcp_send
+            peer.acknowledge(rexmit)
+            child.expect_exact('gnrc_tcp_send: sent {}'.format(len(data)))
+
+            riot_srv.abort()
+
+
+@Runner(timeout=10)
+def test_gnrc_tcp_out_of_order_reassembly(child):
+    """ This test verifies that a segment arriving before the missing data is
+        held and delivered in order once the gap is filled.
+    """
+    # Setup RIOT as server
+    with RiotTcpServer(child, generate_port_number()) as riot_srv:
+        with ScapyTcpPeer(riot_srv) as peer:
+            child.sendline('gnrc_tcp_accept 2000')
+            peer.connect()
+            child.expect_exact('gnrc_tcp_accept: returns 0')
+
+            # Send the second half first, RIOT answers with a duplicate ACK
+            data = '0123456789'
+            half = len(data) // 2
+            peer.send_segment('PA', payload=data[half:].encode('utf-8'), seq=peer.seq + half)
+            ack = peer.receive_segment(data_only=False)
+            assert ack.ack == peer.seq
+
+            # Fill the gap, RIOT acknowledges both segments at once
+            peer.send_segment('PA', payload=data[:half].encode('utf-8'))
+            ack = peer.receive_segment(data_only=False)
+            assert ack.ack == (peer.seq + len(data)) & 0xffffffff
+            peer.seq = ack.ack
+
+            # Both segments are delivered in order
+            riot_srv.receive(timeout_ms=1000, sent_payload=data)
+
+            riot_srv.abort()
+
+
+@Runner(timeout=20)
+def test_gnrc_tcp_congestion_window_growth(child):
+    """ This test verifies that the number of segments sent without waiting for
+        an acknowledgment grows during slow start.
+    """
+    # Setup RIOT as server
+    with RiotTcpServer(child, generate_port_number()) as riot_srv:
+        with ScapyTcpPeer(riot_srv) as peer:
+            child.sendline('gnrc_tcp_accept 2000')
+            peer.connect()
+            child.expect_exact('gnrc_tcp_accept: returns 0')
+
+            # Send several full sized segments worth of data from RIOT
+            data = '0123456789' * 800
+            assert riot_srv._setup_internal_buffer() >= len(data)
+            riot_srv._write_data_to_internal_buffer(data)
+            child.sendline('gnrc_tcp_send 0 {}'.format(len(data)))
+
+            # Count the segments of each round trip, acknowledge each of them
+            received = b''
+            rounds = []
+            while len(received) < len(data):
+                segs = peer.receive_segments()
+                assert segs
+                rounds.append(len(segs))
+
+                for seg in segs:
+                    # No segment was lost, so none may be retransmitted
+                    assert seg.seq == peer.ack
+                    received += bytes(seg.payload)
+                    peer.acknowledge(seg)
+
+            child.expect_exact('gnrc_tcp_send: sent {}'.format(len(data)))
+            assert received == data.encode('utf-8')
+            assert len(rounds) > 1 and rounds[1] > rounds[0]
+
+            riot_srv.abort()
+
+
 if __name__ == '__main__':
     sudo_guard(uses_scapy=True)
 
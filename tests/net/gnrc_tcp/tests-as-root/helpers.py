@@ -8,10 +8,14 @@
 import sys
 import os
 import re
+import queue
 import socket
 import random
+import threading
 import testrunner
 
+from scapy.all import Ether, IPv6, TCP, AsyncSniffer, get_if_hwaddr, sendp
+
 
 class Runner:
     def __init__(self, timeout, echo=False, skip=False):
@@ -305,6 +309,101 @@ class RiotTcpClient(_RiotTcpNode):
         self.opened = True
 
 
+class ScapyTcpPeer:
+    """ TCP peer built from raw frames. It allows tests to withhold
+        acknowledgments and to send segments out of order.
+    """
+    def __init__(self, target, mss=1220, window=65535):
+        # Construct HostTcpClient to lookup node properties
+        host_cli = HostTcpClient(target)
+        host_cli.close()
+
+        self.interface = host_cli.interface
+        self.address = host_cli.address
+        self.mac = get_if_hwaddr(self.interface)
+        self.target_addr = target.address
+        self.target_mac = target.mac
+        self.target_port = int(target.listen_port)
+        self.port = generate_port_number()
+        self.mss = mss
+        self.window = window
+        self.seq = random.randint(0, 0xffffffff)
+        self.ack = 0
+        self.segments = queue.Queue()
+        self.sniffer = None
+        self._rst_rule = 'OUTPUT -p tcp --sport {} --tcp-flags RST RST -j DROP'.format(
+            self.port
+        )
+
+    def __enter__(self):
+        # The host kernel doesn't know this connection, keep it from resetting it
+        os.system('ip6tables -I ' + self._rst_rule)
+
+        started = threading.Event()
+        self.sniffer = AsyncSniffer(
+            iface=self.interface, store=False, prn=self.segments.put,
+            lfilter=self._from_target, started_callback=started.set
+        )
+        self.sniffer.start()
+        started.wait(timeout=5)
+        return self
+
+    def __exit__(self, _1, _2, _3):
+        self.sniffer.stop()
+        os.system('ip6tables -D ' + self._rst_rule)
+
+    def connect(self):
+        self.send_segment('S', options=[('MSS', self.mss)])
+        syn_ack = self.receive_segment(data_only=False)
+        assert syn_ack.flags == 'SA'
+        assert syn_ack.ack == (self.seq + 1) & 0xffffffff
+
+        self.seq = syn_ack.ack
+        self.ack = (syn_ack.seq + 1) & 0xffffffff
+        self.send_segment('A')
+
+    def send_segment(self, flags, payload=b'', seq=None, options=None):
+        tcp_hdr = TCP(
+            sport=self.port, dport=self.target_port, flags=flags,
+            seq=self.seq if seq is None else seq & 0xffffffff,
+            ack=self.ack if 'A' in flags else 0, window=self.window,
+            options=options or []
+        )
+        sendp(
+            Ether(src=self.mac, dst=self.target_mac) /
+            IPv6(src=self.address, dst=self.target_addr) / tcp_hdr / payload,
+            iface=self.interface, verbose=0
+        )
+
+    def receive_segment(self, timeout=1, data_only=True):
+        while True:
+            seg = self.segments.get(timeout=timeout)[TCP]
+            if not data_only or len(seg.payload) > 0:
+                return seg
+
+    def receive_segments(self, quiet=0.3):
+        """ Receive data segments until no new one arrives for quiet seconds """
+        segs = []
+        try:
+            while True:
+                segs.append(self.receive_segment(timeout=quiet))
+        except queue.Empty:
+            return segs
+
+    def acknowledge(self, seg):
+        self.ack = (seg.seq + len(seg.payload)) & 0xffffffff
+        self.send_segment('A')
+
+    def _from_target(self, pkt):
+        return (
+            IPv6 in pkt and TCP in pkt and
+            socket.inet_pton(socket.AF_INET6, pkt[IPv6].src) ==
+            socket.inet_pton(socket.AF_INET6, self.target_addr) and
+            pkt[TCP].sport == self.target_port and
+            pkt[TCP].dport == self.port
+        )
+
+
 def generate_port_number():
     return random.randint(1024, 65535)
 
@@ -0,0 +1,31 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Runs the checksum unittests with `crc16_slicing` and
+ *              `crc32_slicing`
+ *
+ * @}
+ */
+
+#include "embUnit.h"
+
+#include "tests-checksum.h"
+
+int main(void)
+{
+    TESTS_START();
+    tests_checksum();
+    TESTS_END();
+
+    return 0;
+}
@@ -9,6 +9,7 @@
 #include <string.h>
 #include <limits.h>
 
+#include "container.h"
 #include "embUnit.h"
 #include "crypto/aes.h"
 #include "tests-crypto.h"
@@ -41,6 +42,31 @@ static uint8_t TEST_1_ENC[] = {
     0x59, 0x0f, 0x87, 0x91, 0xEF, 0xB0, 0xF8, 0x16
 };
 
+/* FIPS-197, Appendix C: the same plaintext with 128, 192 and 256 bit keys */
+static const uint8_t FIPS_197_KEY[] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+};
+
+static const uint8_t FIPS_197_INP[] = {
+    0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+    0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+};
+
+static const struct {
+    uint8_t key_size;
+    uint8_t enc[AES_BLOCK_SIZE];
+} FIPS_197_VECTORS[] = {
+    { 16, { 0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+            0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a } },
+    { 24, { 0xdd, 0xa9, 0x7c, 0xa4, 0x86, 0x4c, 0xdf, 0xe0,
+            0x6e, 0xaf, 0x70, 0xa0, 0xec, 0x0d, 0x71, 0x91 } },
+    { 32, { 0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf,
+            0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60, 0x89 } },
+};
+
 static void test_crypto_aes_encrypt(void)
 {
     cipher_context_t ctx;
@@ -87,6 +113,32 @@ static void test_crypto_aes_decrypt(void)
                                      AES_BLOCK_SIZE), "wrong plaintext");
 }
 
+static void test_crypto_aes_fips_197(void)
+{
+    cipher_context_t ctx;
+    int err;
+    uint8_t data[AES_BLOCK_SIZE];
+
+    for (unsigned i = 0; i < ARRAY_SIZE(FIPS_197_VECTORS); i++) {
+        if (FIPS_197_VECTORS[i].key_size > CIPHERS_MAX_KEY_SIZE) {
+            /* key size not enabled */
+            continue;
+        }
+        err = aes_init(&ctx, FIPS_197_KEY, FIPS_197_VECTORS[i].key_size);
+        TEST_ASSERT_EQUAL_INT(1, err);
+
+        err = aes_encrypt(&ctx, FIPS_197_INP, data);
+        TEST_ASSERT_EQUAL_INT(1, err);
+        TEST_ASSERT_MESSAGE(1 == compare(FIPS_197_VECTORS[i].enc, data,
+                                         AES_BLOCK_SIZE), "wrong ciphertext");
+
+        err = aes_decrypt(&ctx, FIPS_197_VECTORS[i].enc, data);
+        TEST_ASSERT_EQUAL_INT(1, err);
+        TEST_ASSERT_MESSAGE(1 == compare(FIPS_197_INP, data,
+                                         AES_BLOCK_SIZE), "wrong plaintext");
+    }
+}
+
 static void test_crypto_aes_init_key_length(void)
 {
     cipher_context_t ctx;
@@ -105,6 +157,7 @@ Test *tests_crypto_aes_tests(void)
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_aes_encrypt),
         new_TestFixture(test_crypto_aes_decrypt),
+        new_TestFixture(test_crypto_aes_fips_197),
         new_TestFixture(test_crypto_aes_init_key_length),
     };
 
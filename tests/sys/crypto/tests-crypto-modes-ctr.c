@@ -14,6 +14,7 @@
 
 #include "embUnit.h"
 #include "crypto/ciphers.h"
+#include "crypto/helper.h"
 #include "crypto/modes/ctr.h"
 #include "tests-crypto.h"
 
@@ -246,11 +247,43 @@ static void test_crypto_modes_ctr_decrypt(void)
                     TEST_CIPHER_LEN, TEST_PLAIN, TEST_PLAIN_LEN);
 }
 
+static void test_crypto_modes_ctr_encrypt_partial(void)
+{
+    cipher_t cipher;
+    int len, err, cmp;
+    uint8_t ctr[16], expected_ctr[16], data[64];
+
+    err = cipher_init(&cipher, CIPHER_AES, TEST_1_KEY, TEST_1_KEY_LEN);
+    TEST_ASSERT_EQUAL_INT(1, err);
+
+    /* two and a half blocks, then the rest of the third block and one more:
+     * the counter is advanced past the partial block */
+    memcpy(ctr, TEST_COUNTER, 16);
+    len = cipher_encrypt_ctr(&cipher, ctr, 0, TEST_PLAIN, 40, data);
+    TEST_ASSERT_EQUAL_INT(40, len);
+
+    memcpy(expected_ctr, TEST_COUNTER, 16);
+    for (unsigned i = 0; i < 3; i++) {
+        crypto_block_inc_ctr(expected_ctr, 16);
+    }
+    cmp = compare(expected_ctr, ctr, 16);
+    TEST_ASSERT_MESSAGE(1 == cmp, "wrong counter");
+
+    len = cipher_encrypt_ctr(&cipher, ctr, 0, &TEST_PLAIN[48], 16, &data[48]);
+    TEST_ASSERT_EQUAL_INT(16, len);
+
+    cmp = compare(TEST_1_CIPHER, data, 40);
+    TEST_ASSERT_MESSAGE(1 == cmp, "wrong ciphertext");
+    cmp = compare(&TEST_1_CIPHER[48], &data[48], 16);
+    TEST_ASSERT_MESSAGE(1 == cmp, "wrong ciphertext");
+}
+
 Test *tests_crypto_modes_ctr_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_crypto_modes_ctr_encrypt),
-        new_TestFixture(test_crypto_modes_ctr_decrypt)
+        new_TestFixture(test_crypto_modes_ctr_decrypt),
+        new_TestFixture(test_crypto_modes_ctr_encrypt_partial)
     };
 
     EMB_UNIT_TESTCALLER(crypto_modes_ctr_tests, NULL, NULL, fixtures);
@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       AES test vectors for the bitsliced implementation
+ *
+ * The test cases are shared with tests/sys/crypto.
+ *
+ * @}
+ */
+
+#include "tests-crypto.h"
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_crypto_aes_tests());
+    TESTS_RUN(tests_crypto_modes_ecb_tests());
+    TESTS_RUN(tests_crypto_modes_ctr_tests());
+    TESTS_RUN(tests_crypto_modes_ccm_tests());
+    TESTS_END();
+    return 0;
+}
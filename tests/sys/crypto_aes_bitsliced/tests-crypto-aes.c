@@ -0,0 +1 @@
+../crypto/tests-crypto-aes.c
\ No newline at end of file
@@ -0,0 +1 @@
+../crypto/tests-crypto-modes-ccm.c
\ No newline at end of file
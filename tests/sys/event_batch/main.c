@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for batched event handling
+ *
+ * @}
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "event.h"
+#include "macros/math.h"
+#include "mutex.h"
+#include "test_utils/expect.h"
+#include "thread.h"
+
+#define EVENTS_NUMOF    (5U)
+#define BURST_NUMOF     (20U)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+
+static event_queue_t _queue;
+static event_queue_t _loop_queue = EVENT_QUEUE_INIT_DETACHED;
+static unsigned _handled[EVENTS_NUMOF];
+static unsigned _reposts;
+static unsigned _burst_handled;
+static mutex_t _burst_done = MUTEX_INIT_LOCKED;
+
+static void _handler(event_t *event);
+static void _repost_handler(event_t *event);
+static void _burst_handler(event_t *event);
+
+static event_t _events[EVENTS_NUMOF] = {
+    { .handler = _handler }, { .handler = _handler }, { .handler = _handler },
+    { .handler = _handler }, { .handler = _handler },
+};
+static event_t _repost = { .handler = _repost_handler };
+static event_t _burst[BURST_NUMOF];
+
+static void _handler(event_t *event)
+{
+    _handled[event - _events]++;
+}
+
+static void _repost_handler(event_t *event)
+{
+    /* the event is no longer pending when its handler is called */
+    if (++_reposts < 2) {
+        event_post(&_queue, event);
+    }
+}
+
+static void _burst_handler(event_t *event)
+{
+    (void)event;
+    if (++_burst_handled == BURST_NUMOF) {
+        mutex_unlock(&_burst_done);
+    }
+}
+
+static void *_loop_thread(void *arg)
+{
+    (void)arg;
+    event_queue_claim(&_loop_queue);
+    event_loop_batched(&_loop_queue);
+    return NULL;
+}
+
+static void test_get_batch(void)
+{
+    event_t *batch[3];
+    event_queue_stats_t stats;
+
+    event_queue_init(&_queue);
+    for (unsigned i = 0; i < EVENTS_NUMOF; i++) {
+        event_post(&_queue, &_events[i]);
+    }
+    expect(event_get_batch(&_queue, batch, ARRAY_SIZE(batch)) == 3);
+    for (unsigned i = 0; i < ARRAY_SIZE(batch); i++) {
+        expect(batch[i] == &_events[i]);
+    }
+    /* events of a batch are still pending */
+    event_post(&_queue, &_events[0]);
+    event_cancel(&_queue, &_events[1]);
+    event_dispatch_batch(batch, 3);
+    expect(_handled[0] == 1);
+    expect(_handled[1] == 0);
+    expect(_handled[2] == 1);
+
+    expect(event_get_batch(&_queue, batch, ARRAY_SIZE(batch)) == 2);
+    expect(batch[0] == &_events[3]);
+    expect(batch[1] == &_events[4]);
+    event_dispatch_batch(batch, 2);
+    expect(event_get_batch(&_queue, batch, ARRAY_SIZE(batch)) == 0);
+    expect(event_get(&_queue) == NULL);
+
+    event_queue_get_stats(&_queue, &stats);
+    expect(stats.depth == 0);
+    expect(stats.depth_max == EVENTS_NUMOF);
+    expect(stats.batches == 2);
+    expect(stats.events == EVENTS_NUMOF);
+    expect(stats.batch_max == 3);
+}
+
+static void test_repost(void)
+{
+    event_t *batch[2];
+
+    event_post(&_queue, &_repost);
+    expect(event_get_batch(&_queue, batch, ARRAY_SIZE(batch)) == 1);
+    event_dispatch_batch(batch, 1);
+    expect(_reposts == 1);
+    expect(event_get_batch(&_queue, batch, ARRAY_SIZE(batch)) == 1);
+    event_dispatch_batch(batch, 1);
+    expect(_reposts == 2);
+    expect(event_get(&_queue) == NULL);
+}
+
+static void test_loop_batched(void)
+{
+    event_queue_stats_t stats;
+
+    /* the event loop runs with lower priority, so the whole burst is queued
+     * before it gets to run */
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN + 1, 0,
+                  _loop_thread, NULL, "batched");
+    for (unsigned i = 0; i < BURST_NUMOF; i++) {
+        _burst[i].handler = _burst_handler;
+        event_post(&_loop_queue, &_burst[i]);
+    }
+    mutex_lock(&_burst_done);
+
+    event_queue_get_stats(&_loop_queue, &stats);
+    printf("burst: %" PRIu32 " events in %" PRIu32 " batches\n",
+           stats.events, stats.batches);
+    expect(stats.events == BURST_NUMOF);
+    expect(stats.batch_max <= CONFIG_EVENT_LOOP_BATCH_SIZE);
+    expect(stats.batches ==
+           DIV_ROUND_UP(BURST_NUMOF, CONFIG_EVENT_LOOP_BATCH_SIZE));
+}
+
+int main(void)
+{
+    test_get_batch();
+    test_repost();
+    test_loop_batched();
+
+    puts("[SUCCESS]");
+
+    return 0;
+}
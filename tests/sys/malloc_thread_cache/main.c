@@ -0,0 +1,290 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the thread-cached small-object allocator
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "container.h"
+#include "malloc_thread_cache.h"
+#include "thread.h"
+#include "thread_cache.h"
+
+#define MIN_SIZE    MALLOC_THREAD_CACHE_MIN_SIZE
+#define MAX_SIZE    MALLOC_THREAD_CACHE_MAX_SIZE
+#define BATCH       CONFIG_MALLOC_THREAD_CACHE_BATCH
+#define LIMIT       CONFIG_MALLOC_THREAD_CACHE_LIMIT
+
+/* The tests for the caches run in a thread of their own, so its cache starts
+ * empty. That thread has a higher priority than main, thread_create() returns
+ * once it exited. */
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static void *_blocks[LIMIT + 1];
+static malloc_thread_cache_thread_stats_t _snap[3];
+static malloc_thread_cache_class_stats_t _class_snap;
+
+static void _run(thread_task_func_t task)
+{
+    memset(_snap, 0, sizeof(_snap));
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1, 0,
+                  task, NULL, "cache");
+}
+
+static void _snapshot(unsigned idx)
+{
+    malloc_thread_cache_thread_stats(thread_getpid(), &_snap[idx]);
+}
+
+static void test_size_classes(void)
+{
+    for (unsigned cls = 0; cls < CONFIG_MALLOC_THREAD_CACHE_CLASSES; cls++) {
+        size_t size = MIN_SIZE << cls;
+        /* smallest request of the class */
+        void *lower = malloc((cls == 0) ? 1 : (size / 2) + 1);
+        void *upper = malloc(size);
+
+        TEST_ASSERT_NOT_NULL(lower);
+        TEST_ASSERT_NOT_NULL(upper);
+        TEST_ASSERT_EQUAL_INT(size, thread_cache_block_size(lower));
+        TEST_ASSERT_EQUAL_INT(size, thread_cache_block_size(upper));
+        free(lower);
+        free(upper);
+    }
+
+    void *large = malloc(MAX_SIZE + 1);
+
+    TEST_ASSERT_NOT_NULL(large);
+    TEST_ASSERT_EQUAL_INT(0, thread_cache_block_size(large));
+    free(large);
+}
+
+static void test_realloc(void)
+{
+    uint8_t *ptr = malloc(MIN_SIZE / 2);
+    uint8_t *tmp;
+    /* compare addresses only, ptr must not be used after realloc() */
+    uintptr_t addr = (uintptr_t)ptr;
+
+    TEST_ASSERT_NOT_NULL(ptr);
+    memset(ptr, 0x5a, MIN_SIZE / 2);
+
+    /* growing within the size class keeps the block */
+    tmp = realloc(ptr, MIN_SIZE);
+    TEST_ASSERT((uintptr_t)tmp == addr);
+    ptr = tmp;
+    memset(ptr + (MIN_SIZE / 2), 0xa5, MIN_SIZE / 2);
+
+    /* growing into the next size class moves the data */
+    tmp = realloc(ptr, MIN_SIZE + 1);
+    TEST_ASSERT_NOT_NULL(tmp);
+    TEST_ASSERT((uintptr_t)tmp != addr);
+    TEST_ASSERT_EQUAL_INT(2 * MIN_SIZE, thread_cache_block_size(tmp));
+    ptr = tmp;
+    addr = (uintptr_t)ptr;
+    for (unsigned i = 0; i < MIN_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((i < (MIN_SIZE / 2)) ? 0x5a : 0xa5, ptr[i]);
+    }
+
+    /* shrinking keeps the block */
+    tmp = realloc(ptr, 1);
+    TEST_ASSERT((uintptr_t)tmp == addr);
+    ptr = tmp;
+
+    /* growing beyond the largest size class moves the data to the C library */
+    tmp = realloc(ptr, MAX_SIZE + 1);
+    TEST_ASSERT_NOT_NULL(tmp);
+    TEST_ASSERT_EQUAL_INT(0, thread_cache_block_size(tmp));
+    ptr = tmp;
+    for (unsigned i = 0; i < MIN_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((i < (MIN_SIZE / 2)) ? 0x5a : 0xa5, ptr[i]);
+    }
+    free(ptr);
+}
+
+static void *_refill_task(void *arg)
+{
+    (void)arg;
+
+    /* the first allocation takes a batch from the global free list */
+    _blocks[0] = malloc(MIN_SIZE);
+    _snapshot(0);
+
+    /* the rest of the batch is served from the cache */
+    for (unsigned i = 0; i < _snap[0].cached; i++) {
+        _blocks[i + 1] = malloc(MIN_SIZE);
+    }
+    _snapshot(1);
+
+    /* the cache ran empty, so the next allocation refills it */
+    _blocks[_snap[0].cached + 1] = malloc(MIN_SIZE);
+    _snapshot(2);
+
+    for (unsigned i = 0; i < (unsigned)_snap[0].cached + 2; i++) {
+        free(_blocks[i]);
+    }
+    return NULL;
+}
+
+static void test_refill(void)
+{
+    _run(_refill_task);
+
+    TEST_ASSERT_EQUAL_INT(1, _snap[0].allocs);
+    TEST_ASSERT_EQUAL_INT(0, _snap[0].cache_hits);
+    TEST_ASSERT_EQUAL_INT(1, _snap[0].refills);
+    TEST_ASSERT(_snap[0].cached < BATCH);
+
+    TEST_ASSERT_EQUAL_INT(_snap[0].cached, _snap[1].cache_hits);
+    TEST_ASSERT_EQUAL_INT(1, _snap[1].refills);
+    TEST_ASSERT_EQUAL_INT(0, _snap[1].cached);
+
+    TEST_ASSERT_EQUAL_INT(2, _snap[2].refills);
+    TEST_ASSERT_EQUAL_INT(0, _snap[2].fallbacks);
+}
+
+static void *_flush_task(void *arg)
+{
+    (void)arg;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_blocks); i++) {
+        _blocks[i] = malloc(MIN_SIZE);
+    }
+    _snapshot(0);
+    for (unsigned i = 0; i < ARRAY_SIZE(_blocks); i++) {
+        free(_blocks[i]);
+    }
+    _snapshot(1);
+    return NULL;
+}
+
+static void test_flush(void)
+{
+    unsigned cached, flushes = 0;
+
+    _run(_flush_task);
+
+    /* replay the frees: a batch goes back whenever the limit is exceeded */
+    cached = _snap[0].cached;
+    for (unsigned i = 0; i < ARRAY_SIZE(_blocks); i++) {
+        if (++cached > LIMIT) {
+            cached -= BATCH;
+            flushes++;
+        }
+    }
+    TEST_ASSERT(flushes > 0);
+    TEST_ASSERT_EQUAL_INT(0, _snap[0].flushes);
+    TEST_ASSERT_EQUAL_INT(flushes, _snap[1].flushes);
+    TEST_ASSERT_EQUAL_INT(cached, _snap[1].cached);
+    TEST_ASSERT(_snap[1].cached <= LIMIT);
+}
+
+static void *_exit_task(void *arg)
+{
+    (void)arg;
+
+    _blocks[0] = malloc(2 * MIN_SIZE);
+    free(_blocks[0]);
+    _snapshot(0);
+    malloc_thread_cache_class_stats(1, &_class_snap);
+    return NULL;
+}
+
+static void test_flush_on_thread_exit(void)
+{
+    malloc_thread_cache_class_stats_t before, after;
+
+    malloc_thread_cache_class_stats(1, &before);
+    _run(_exit_task);
+    malloc_thread_cache_class_stats(1, &after);
+
+    /* the thread cached the block it freed and the rest of its batch ... */
+    TEST_ASSERT(_snap[0].cached > 0);
+    TEST_ASSERT_EQUAL_INT(before.free_cached + _snap[0].cached,
+                          _class_snap.free_cached);
+    /* ... which are back in the global free list after it exited */
+    TEST_ASSERT_EQUAL_INT(before.free_cached, after.free_cached);
+    TEST_ASSERT_EQUAL_INT(_class_snap.free_global + _snap[0].cached,
+                          after.free_global);
+    TEST_ASSERT_EQUAL_INT(after.slabs, _class_snap.slabs);
+}
+
+static void *_stats_task(void *arg)
+{
+    (void)arg;
+
+    /* store the blocks globally, so the compiler doesn't elide the calls */
+    _blocks[0] = malloc(MIN_SIZE);
+    _blocks[1] = malloc(MAX_SIZE + 1);
+
+    _snapshot(0);
+    free(_blocks[0]);
+    free(_blocks[1]);
+    _snapshot(1);
+    return NULL;
+}
+
+static void test_stats(void)
+{
+    _run(_stats_task);
+
+    TEST_ASSERT_EQUAL_INT(2, _snap[0].allocs);
+    TEST_ASSERT_EQUAL_INT(1, _snap[0].fallbacks);
+    TEST_ASSERT_EQUAL_INT(0, _snap[0].frees);
+    TEST_ASSERT_EQUAL_INT(2, _snap[1].frees);
+    TEST_ASSERT_EQUAL_INT(_snap[0].cached + 1, _snap[1].cached);
+
+    for (unsigned cls = 0; cls < CONFIG_MALLOC_THREAD_CACHE_CLASSES; cls++) {
+        malloc_thread_cache_class_stats_t stats;
+
+        TEST_ASSERT_EQUAL_INT(0, malloc_thread_cache_class_stats(cls, &stats));
+        TEST_ASSERT_EQUAL_INT(MIN_SIZE << cls, stats.size);
+        TEST_ASSERT_EQUAL_INT(stats.slabs * (CONFIG_MALLOC_THREAD_CACHE_SLAB_SIZE / stats.size),
+                              stats.blocks);
+        TEST_ASSERT(stats.free_global + stats.free_cached <= stats.blocks);
+    }
+    TEST_ASSERT_EQUAL_INT(-EINVAL,
+                          malloc_thread_cache_class_stats(CONFIG_MALLOC_THREAD_CACHE_CLASSES,
+                                                          &_class_snap));
+}
+
+Test *tests_malloc_thread_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_size_classes),
+        new_TestFixture(test_realloc),
+        new_TestFixture(test_refill),
+        new_TestFixture(test_flush),
+        new_TestFixture(test_flush_on_thread_exit),
+        new_TestFixture(test_stats),
+    };
+
+    EMB_UNIT_TESTCALLER(malloc_thread_cache_tests, NULL, NULL, fixtures);
+
+    return (Test *)&malloc_thread_cache_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_malloc_thread_cache_tests());
+    TESTS_END();
+
+    return 0;
+}
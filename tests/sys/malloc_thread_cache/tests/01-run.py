@@ -0,0 +1,14 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2023 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+
+from testrunner import run_check_unittests
+
+if __name__ == "__main__":
+    sys.exit(run_check_unittests())
@@ -31,7 +31,8 @@ sign_manifest() {
 
 # random invalid data files
 echo foo > "${MANIFEST_DIR}/file1.bin"
-echo bar > "${MANIFEST_DIR}/file2.bin"
+# large enough to be fetched in several chunks
+head -c 1000 /dev/urandom > "${MANIFEST_DIR}/file2.bin"
 
 # random valid cbor (manifest but not signed, missing cose auth)
 gen_manifest "${MANIFEST_DIR}/manifest0.bin" 1 "${MANIFEST_DIR}/file1.bin:$((0x1000))" "${MANIFEST_DIR}/file2.bin:$((0x2000))"
@@ -102,10 +102,21 @@ static void test_suit_manifest_01_manifests(void)
     }
 }
 
+static void test_suit_manifest_02_fetch_stats(void)
+{
+    suit_fetch_stats_t stats;
+
+    /* the last payload fetched by the manifests above */
+    suit_fetch_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(sizeof(file2_bin), stats.total);
+    TEST_ASSERT_EQUAL_INT(sizeof(file2_bin), stats.received);
+}
+
 Test *tests_suit_manifest(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_suit_manifest_01_manifests),
+        new_TestFixture(test_suit_manifest_02_fetch_stats),
     };
 
     EMB_UNIT_TESTCALLER(suit_manifest_tests, NULL, NULL, fixtures);
@@ -0,0 +1,270 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Tests the results of vfs_stat() after the file system was
+ *              modified, with and without module `vfs_stat_cache`
+ *
+ * @}
+ */
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "container.h"
+#include "embUnit.h"
+#include "vfs.h"
+
+/* number of calls to the file system expected for a vfs_stat() that may be
+ * answered from the cache */
+#define CACHED_CALLS    (IS_USED(MODULE_VFS_STAT_CACHE) ? 0 : 1)
+
+/* a file system with two files in its root directory */
+typedef struct {
+    char name[4];
+    bool exists;
+    size_t size;
+} _file_t;
+
+static _file_t _files[2];
+static unsigned _stat_calls;
+/* called by the file system in the middle of a stat operation */
+static void (*_stat_hook)(void);
+
+static _file_t *_find(const char *name)
+{
+    for (unsigned i = 0; i < ARRAY_SIZE(_files); i++) {
+        if (_files[i].exists && !strcmp(_files[i].name, name)) {
+            return &_files[i];
+        }
+    }
+    return NULL;
+}
+
+static int _open(vfs_file_t *filp, const char *name, int flags, mode_t mode)
+{
+    (void)mode;
+    _file_t *file = _find(name);
+
+    if ((file == NULL) && (flags & O_CREAT)) {
+        for (unsigned i = 0; i < ARRAY_SIZE(_files); i++) {
+            if (!_files[i].exists) {
+                file = &_files[i];
+                strcpy(file->name, name);
+                file->exists = true;
+                file->size = 0;
+                break;
+            }
+        }
+    }
+    if (file == NULL) {
+        return -ENOENT;
+    }
+    filp->private_data.ptr = file;
+    return 0;
+}
+
+static ssize_t _write(vfs_file_t *filp, const void *src, size_t nbytes)
+{
+    (void)src;
+    _file_t *file = filp->private_data.ptr;
+
+    file->size += nbytes;
+    return nbytes;
+}
+
+static int _stat(vfs_mount_t *mountp, const char *restrict path,
+                 struct stat *restrict buf)
+{
+    (void)mountp;
+    _file_t *file = _find(path);
+
+    _stat_calls++;
+    if (file != NULL) {
+        buf->st_mode = S_IFREG;
+        buf->st_size = file->size;
+    }
+    if (_stat_hook != NULL) {
+        void (*hook)(void) = _stat_hook;
+        _stat_hook = NULL;
+        hook();
+    }
+    return (file != NULL) ? 0 : -ENOENT;
+}
+
+static int _unlink(vfs_mount_t *mountp, const char *name)
+{
+    (void)mountp;
+    _file_t *file = _find(name);
+
+    if (file == NULL) {
+        return -ENOENT;
+    }
+    file->exists = false;
+    return 0;
+}
+
+static int _rename(vfs_mount_t *mountp, const char *from_path, const char *to_path)
+{
+    (void)mountp;
+    _file_t *file = _find(from_path);
+
+    if ((file == NULL) || (_find(to_path) != NULL)) {
+        return -ENOENT;
+    }
+    strcpy(file->name, to_path);
+    return 0;
+}
+
+static const vfs_file_ops_t _file_ops = {
+    .open  = _open,
+    .write = _write,
+};
+
+static const vfs_file_system_ops_t _fs_ops = {
+    .stat   = _stat,
+    .unlink = _unlink,
+    .rename = _rename,
+};
+
+static const vfs_file_system_t _file_system = {
+    .f_op  = &_file_ops,
+    .fs_op = &_fs_ops,
+};
+
+static vfs_mount_t _test_vfs_mount = {
+    .mount_point = "/sc",
+    .fs = &_file_system,
+};
+
+static void setup(void)
+{
+    memset(_files, 0, sizeof(_files));
+    strcpy(_files[0].name, "/a");
+    _files[0].exists = true;
+    _stat_calls = 0;
+    _stat_hook = NULL;
+    vfs_mount(&_test_vfs_mount);
+}
+
+static void teardown(void)
+{
+    vfs_umount(&_test_vfs_mount, false);
+}
+
+static void test_vfs_stat_cache_hit(void)
+{
+    struct stat buf;
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_stat("/sc/a", &buf));
+    TEST_ASSERT_EQUAL_INT(1, _stat_calls);
+    TEST_ASSERT_EQUAL_INT(0, vfs_stat("/sc/a", &buf));
+    TEST_ASSERT_EQUAL_INT(1 + CACHED_CALLS, _stat_calls);
+    TEST_ASSERT(S_ISREG(buf.st_mode));
+
+    /* "does not exist" is cached as well */
+    TEST_ASSERT_EQUAL_INT(-ENOENT, vfs_stat("/sc/b", &buf));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, vfs_stat("/sc/b", &buf));
+    TEST_ASSERT_EQUAL_INT(2 + (2 * CACHED_CALLS), _stat_calls);
+}
+
+static void test_vfs_stat_cache_write(void)
+{
+    struct stat buf;
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_stat("/sc/a", &buf));
+    TEST_ASSERT_EQUAL_INT(0, buf.st_size);
+
+    int fd = vfs_open("/sc/a", O_WRONLY, 0);
+    TEST_ASSERT(fd >= 0);
+    TEST_ASSERT_EQUAL_INT(3, vfs_write(fd, "abc", 3));
+    /* the file is still open */
+    TEST_ASSERT_EQUAL_INT(0, vfs_stat("/sc/a", &buf));
+    TEST_ASSERT_EQUAL_INT(3, buf.st_size);
+    TEST_ASSERT_EQUAL_INT(3, vfs_write(fd, "def", 3));
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+    TEST_ASSERT_EQUAL_INT(0, vfs_stat("/sc/a", &buf));
+    TEST_ASSERT_EQUAL_INT(6, buf.st_size);
+
+    /* creating a file */
+    TEST_ASSERT_EQUAL_INT(-ENOENT, vfs_stat("/sc/b", &buf));
+    fd = vfs_open("/sc/b", O_WRONLY | O_CREAT, 0);
+    TEST_ASSERT(fd >= 0);
+    TEST_ASSERT_EQUAL_INT(0, vfs_stat("/sc/b", &buf));
+    TEST_ASSERT_EQUAL_INT(0, vfs_close(fd));
+}
+
+static void test_vfs_stat_cache_unlink(void)
+{
+    struct stat buf;
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_stat("/sc/a", &buf));
+    TEST_ASSERT_EQUAL_INT(0, vfs_unlink("/sc/a"));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, vfs_stat("/sc/a", &buf));
+}
+
+static void test_vfs_stat_cache_rename(void)
+{
+    struct stat buf;
+
+    TEST_ASSERT_EQUAL_INT(0, vfs_stat("/sc/a", &buf));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, vfs_stat("/sc/b", &buf));
+    TEST_ASSERT_EQUAL_INT(0, vfs_rename("/sc/a", "/sc/b"));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, vfs_stat("/sc/a", &buf));
+    TEST_ASSERT_EQUAL_INT(0, vfs_stat("/sc/b", &buf));
+}
+
+static void _unlink_a(void)
+{
+    vfs_unlink("/sc/a");
+}
+
+/* the file is removed while the file system answers a vfs_stat(): its result
+ * is already outdated and must not be cached */
+static void test_vfs_stat_cache_modified_during_stat(void)
+{
+    struct stat buf;
+
+    _stat_hook = _unlink_a;
+    TEST_ASSERT_EQUAL_INT(0, vfs_stat("/sc/a", &buf));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, vfs_stat("/sc/a", &buf));
+    TEST_ASSERT_EQUAL_INT(2, _stat_calls);
+}
+
+static Test *tests_vfs_stat_cache_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_vfs_stat_cache_hit),
+        new_TestFixture(test_vfs_stat_cache_write),
+        new_TestFixture(test_vfs_stat_cache_unlink),
+        new_TestFixture(test_vfs_stat_cache_rename),
+        new_TestFixture(test_vfs_stat_cache_modified_during_stat),
+    };
+
+    EMB_UNIT_TESTCALLER(vfs_stat_cache_tests, setup, teardown, fixtures);
+
+    return (Test *)&vfs_stat_cache_tests;
+}
+
+int main(void)
+{
+    TESTS_START();
+    TESTS_RUN(tests_vfs_stat_cache_tests());
+    TESTS_END();
+
+    return 0;
+}
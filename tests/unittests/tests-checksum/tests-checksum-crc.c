@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <stdint.h>
+
+#include "embUnit.h"
+#include "kernel_defines.h"
+
+#include "checksum/crc.h"
+#include "checksum/crc32.h"
+
+#include "tests-checksum.h"
+
+static const crc_algo_t _crc8 = CRC_ALGO_CRC8(0x07, 0x00);
+static const crc_algo_t _ucrc16_be = CRC_ALGO_UCRC16_BE(0x1021, 0xffff);
+static const crc_algo_t _ucrc16_le = CRC_ALGO_UCRC16_LE(0x8408, 0x0000);
+
+static const struct {
+    const crc_algo_t *algo;
+    uint32_t check;     /* checksum of "123456789" */
+} _algos[] = {
+    { &crc_algo_crc32, 0xcbf43926 },
+    { &crc_algo_crc16_ccitt_kermit, 0x2189 },
+    { &crc_algo_crc16_ccitt_mcrf4xx, 0x6f91 },
+    { &crc_algo_crc16_ccitt_false, 0x29b1 },
+    { &crc_algo_crc16_ccitt_aug, 0xe5cc },
+    { &_crc8, 0xf4 },
+    { &_ucrc16_be, 0x29b1 },
+    { &_ucrc16_le, 0x2189 },
+};
+
+static uint8_t _buf[301];
+
+static void _fill_buf(void)
+{
+    uint32_t state = 0x2a;
+
+    for (unsigned i = 0; i < sizeof(_buf); i++) {
+        state = (state * 1103515245U) + 12345U;
+        _buf[i] = state >> 16;
+    }
+}
+
+static void test_checksum_crc_calc(void)
+{
+    static const char check[] = "123456789";
+
+    for (unsigned i = 0; i < ARRAY_SIZE(_algos); i++) {
+        TEST_ASSERT_EQUAL_INT(_algos[i].check,
+                              crc_calc(_algos[i].algo, check, sizeof(check) - 1));
+    }
+}
+
+static void test_checksum_crc_update__chunks(void)
+{
+    _fill_buf();
+    for (unsigned i = 0; i < ARRAY_SIZE(_algos); i++) {
+        const crc_algo_t *algo = _algos[i].algo;
+        crc_ctx_t ctx;
+        size_t pos = 0;
+
+        crc_init(&ctx, algo);
+        /* chunks of 1, 2, 3, ... bytes to hit all alignments and tails */
+        for (size_t chunk = 1; pos < sizeof(_buf); chunk++) {
+            size_t len = (sizeof(_buf) - pos < chunk) ? sizeof(_buf) - pos
+                                                      : chunk;
+
+            crc_update(&ctx, &_buf[pos], len);
+            pos += len;
+        }
+        TEST_ASSERT_EQUAL_INT(crc_calc(algo, _buf, sizeof(_buf)),
+                              crc_finish(&ctx));
+    }
+}
+
+static void test_checksum_crc32_update(void)
+{
+    uint32_t crc;
+
+    _fill_buf();
+    crc = crc32(_buf, 13);
+    crc = crc32_update(crc, &_buf[13], sizeof(_buf) - 13);
+    TEST_ASSERT_EQUAL_INT(crc32(_buf, sizeof(_buf)), crc);
+    TEST_ASSERT_EQUAL_INT(crc32(_buf, sizeof(_buf)),
+                          crc_calc(&crc_algo_crc32, _buf, sizeof(_buf)));
+}
+
+Test *tests_checksum_crc_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_checksum_crc_calc),
+        new_TestFixture(test_checksum_crc_update__chunks),
+        new_TestFixture(test_checksum_crc32_update),
+    };
+
+    EMB_UNIT_TESTCALLER(checksum_crc_tests, NULL, NULL, fixtures);
+
+    return (Test *)&checksum_crc_tests;
+}
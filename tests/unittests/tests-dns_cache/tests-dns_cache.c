@@ -6,6 +6,7 @@
  * directory for more details.
  */
 
+#include <errno.h>
 #include <stdint.h>
 #include <string.h>
 #include "net/af.h"
@@ -51,11 +52,66 @@ static void test_dns_cache_add_ttl0(void)
     TEST_ASSERT_EQUAL_INT(0, dns_cache_query("example.com", &addr_out, AF_INET6));
 }
 
+static void test_dns_cache_add_negative(void)
+{
+    ipv6_addr_t addr_in = IPV6_ADDR_ALL_NODES_IF_LOCAL;
+    ipv6_addr_t addr_out;
+
+    /* no AAAA record, but the name may still have an A record */
+    dns_cache_add_negative("example.org", AF_INET6, 1);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, dns_cache_query("example.org", &addr_out, AF_INET6));
+    TEST_ASSERT_EQUAL_INT(0, dns_cache_query("example.org", &addr_out, AF_INET));
+
+    /* an address replaces the negative entry */
+    dns_cache_add("example.org", &addr_in, sizeof(addr_in), 1);
+    TEST_ASSERT_EQUAL_INT(sizeof(addr_out), dns_cache_query("example.org", &addr_out, AF_INET6));
+
+    /* the name does not exist at all */
+    dns_cache_add_negative("example.org", AF_UNSPEC, 1);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, dns_cache_query("example.org", &addr_out, AF_INET6));
+    TEST_ASSERT_EQUAL_INT(-ENOENT, dns_cache_query("example.org", &addr_out, AF_INET));
+
+    ztimer_sleep(ZTIMER_USEC, 2000000);
+    TEST_ASSERT_EQUAL_INT(0, dns_cache_query("example.org", &addr_out, AF_INET6));
+}
+
+static void test_dns_cache_prefetch(void)
+{
+    ipv6_addr_t addr_in = IPV6_ADDR_ALL_NODES_IF_LOCAL;
+    ipv6_addr_t addr_out;
+    dns_cache_stats_t before, after;
+    bool prefetch;
+
+    dns_cache_get_stats(&before);
+    dns_cache_add("example.net", &addr_in, sizeof(addr_in),
+                  CONFIG_DNS_CACHE_PREFETCH_THRESHOLD + 60);
+    TEST_ASSERT_EQUAL_INT(sizeof(addr_out),
+                          dns_cache_query_prefetch("example.net", &addr_out, AF_INET6, &prefetch));
+    TEST_ASSERT(!prefetch);
+
+    /* only the first client is asked to refresh an entry about to expire */
+    dns_cache_add("example.net", &addr_in, sizeof(addr_in), 1);
+    TEST_ASSERT_EQUAL_INT(sizeof(addr_out),
+                          dns_cache_query_prefetch("example.net", &addr_out, AF_INET6, &prefetch));
+    TEST_ASSERT(prefetch);
+    TEST_ASSERT_EQUAL_INT(sizeof(addr_out),
+                          dns_cache_query_prefetch("example.net", &addr_out, AF_INET6, &prefetch));
+    TEST_ASSERT(!prefetch);
+
+    dns_cache_get_stats(&after);
+    TEST_ASSERT_EQUAL_INT(3, after.hits - before.hits);
+    TEST_ASSERT_EQUAL_INT(1, after.prefetches - before.prefetches);
+
+    dns_cache_add("example.net", &addr_in, sizeof(addr_in), 0);
+}
+
 Test *tests_dns_cache_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(test_dns_cache_add),
         new_TestFixture(test_dns_cache_add_ttl0),
+        new_TestFixture(test_dns_cache_add_negative),
+        new_TestFixture(test_dns_cache_prefetch),
     };
 
     EMB_UNIT_TESTCALLER(dns_cache_tests, NULL, NULL, fixtures);
@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2023 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include "net/af.h"
+#include "net/dns.h"
+
+#include "net/dns/msg.h"
+
+#include "tests-dns_msg.h"
+
+#define BE32(x)         (((x) >> 24) & 0xff), (((x) >> 16) & 0xff), \
+                        (((x) >> 8) & 0xff), ((x) & 0xff)
+
+#define RCODE_NOERROR   (0x0)
+#define RCODE_NXDOMAIN  (0x3)
+
+/* response header with one question */
+#define HDR(rcode, ancount, nscount) \
+    0x12, 0x34, 0x81, 0x80 | (rcode), 0x00, 0x01, \
+    0x00, (ancount), 0x00, (nscount), 0x00, 0x00
+
+/* AAAA query for example.org, "org" starts at offset 20 */
+#define QUESTION \
+    7, 'e', 'x', 'a', 'm', 'p', 'l', 'e', 3, 'o', 'r', 'g', 0, \
+    0x00, DNS_TYPE_AAAA, 0x00, DNS_CLASS_IN
+
+#define PTR_EXAMPLE     0xc0, 0x0c
+#define PTR_ORG         0xc0, 0x14
+
+/* SOA record for org, all names are compressed */
+#define SOA_RDLEN       (33U)
+#define SOA(ttl, minimum) \
+    PTR_ORG, 0x00, DNS_TYPE_SOA, 0x00, DNS_CLASS_IN, BE32(ttl), \
+    0x00, SOA_RDLEN, \
+    3, 'n', 's', '1', PTR_ORG, \
+    4, 'h', 'o', 's', 't', PTR_ORG, \
+    BE32(1U), BE32(7200U), BE32(900U), BE32(1209600U), BE32(minimum)
+
+/* NS record for org */
+#define NS(ttl) \
+    PTR_ORG, 0x00, 2, 0x00, DNS_CLASS_IN, BE32(ttl), \
+    0x00, 6, 3, 'n', 's', '1', PTR_ORG
+
+/* offset of the first resource record */
+#define RR_OFFSET       (12U + 17U)
+
+static uint8_t _addr[IN6ADDRSZ];
+
+static int _parse(const uint8_t *buf, size_t len, uint32_t *ttl)
+{
+    *ttl = UINT32_MAX;
+    return dns_msg_parse_reply(buf, len, AF_INET6, _addr, ttl);
+}
+
+static void test_dns_msg_parse_reply_aaaa(void)
+{
+    static const uint8_t msg[] = {
+        HDR(RCODE_NOERROR, 1, 0), QUESTION,
+        PTR_EXAMPLE, 0x00, DNS_TYPE_AAAA, 0x00, DNS_CLASS_IN, BE32(300U),
+        0x00, IN6ADDRSZ,
+        0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    };
+    uint32_t ttl;
+
+    TEST_ASSERT_EQUAL_INT(IN6ADDRSZ, _parse(msg, sizeof(msg), &ttl));
+    TEST_ASSERT_EQUAL_INT(300, ttl);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(&msg[sizeof(msg) - IN6ADDRSZ], _addr,
+                                    IN6ADDRSZ));
+}
+
+/* the negative TTL is the minimum of the TTL and the MINIMUM field of the SOA
+ * record, RFC 2308, section 5 */
+static void test_dns_msg_negative_ttl(void)
+{
+    static const uint8_t minimum_lower[] = {
+        HDR(RCODE_NXDOMAIN, 0, 1), QUESTION, SOA(3600U, 900U),
+    };
+    static const uint8_t ttl_lower[] = {
+        HDR(RCODE_NXDOMAIN, 0, 1), QUESTION, SOA(60U, 900U),
+    };
+    static const uint8_t nodata[] = {
+        HDR(RCODE_NOERROR, 0, 1), QUESTION, SOA(3600U, 120U),
+    };
+    uint32_t ttl;
+
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _parse(minimum_lower, sizeof(minimum_lower), &ttl));
+    TEST_ASSERT_EQUAL_INT(900, ttl);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _parse(ttl_lower, sizeof(ttl_lower), &ttl));
+    TEST_ASSERT_EQUAL_INT(60, ttl);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _parse(nodata, sizeof(nodata), &ttl));
+    TEST_ASSERT_EQUAL_INT(120, ttl);
+}
+
+/* records before the SOA record are skipped, including their compressed and
+ * uncompressed owner names */
+static void test_dns_msg_negative_ttl_skip_records(void)
+{
+    static const uint8_t msg[] = {
+        HDR(RCODE_NXDOMAIN, 0, 3), QUESTION,
+        NS(3600U),
+        /* uncompressed owner name */
+        3, 'o', 'r', 'g', 0, 0x00, 2, 0x00, DNS_CLASS_IN, BE32(3600U),
+        0x00, 2, PTR_ORG,
+        SOA(3600U, 300U),
+    };
+    static const uint8_t no_soa[] = {
+        HDR(RCODE_NOERROR, 0, 1), QUESTION, NS(3600U),
+    };
+    uint32_t ttl;
+
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _parse(msg, sizeof(msg), &ttl));
+    TEST_ASSERT_EQUAL_INT(300, ttl);
+    /* a NODATA response without SOA record looks like a referral */
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, _parse(no_soa, sizeof(no_soa), &ttl));
+}
+
+/* an owner name made of labels followed by a pointer */
+static void test_dns_msg_negative_ttl_label_pointer(void)
+{
+    static const uint8_t msg[] = {
+        HDR(RCODE_NXDOMAIN, 0, 1), QUESTION,
+        3, 's', 'u', 'b', PTR_ORG, 0x00, DNS_TYPE_SOA, 0x00, DNS_CLASS_IN,
+        BE32(3600U), 0x00, 24,
+        0xc0, RR_OFFSET, PTR_ORG,
+        BE32(1U), BE32(7200U), BE32(900U), BE32(1209600U), BE32(450U),
+    };
+    uint32_t ttl;
+
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _parse(msg, sizeof(msg), &ttl));
+    TEST_ASSERT_EQUAL_INT(450, ttl);
+
+    /* cut within the pointer terminating the owner name */
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _parse(msg, RR_OFFSET + 5, &ttl));
+    TEST_ASSERT_EQUAL_INT(0, ttl);
+    /* cut within the label of the owner name */
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _parse(msg, RR_OFFSET + 2, &ttl));
+    TEST_ASSERT_EQUAL_INT(0, ttl);
+}
+
+/* a truncated SOA record must not be read beyond the message */
+static void test_dns_msg_negative_ttl_truncated(void)
+{
+    static const uint8_t nxdomain[] = {
+        HDR(RCODE_NXDOMAIN, 0, 1), QUESTION, SOA(3600U, 900U),
+    };
+    static const uint8_t nodata[] = {
+        HDR(RCODE_NOERROR, 0, 1), QUESTION, SOA(3600U, 900U),
+    };
+    static const uint8_t short_rdata[] = {
+        HDR(RCODE_NXDOMAIN, 0, 1), QUESTION,
+        PTR_ORG, 0x00, DNS_TYPE_SOA, 0x00, DNS_CLASS_IN, BE32(3600U),
+        0x00, 3, 0x00, 0x00, 0x00,
+    };
+    uint32_t ttl;
+
+    /* MINIMUM cut off */
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _parse(nxdomain, sizeof(nxdomain) - 1, &ttl));
+    TEST_ASSERT_EQUAL_INT(0, ttl);
+    /* RDLENGTH cut off */
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _parse(nxdomain, RR_OFFSET + 9, &ttl));
+    TEST_ASSERT_EQUAL_INT(0, ttl);
+    /* the owner name is a lone pointer byte */
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _parse(nxdomain, RR_OFFSET + 1, &ttl));
+    TEST_ASSERT_EQUAL_INT(0, ttl);
+    /* no authority section at all */
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _parse(nxdomain, RR_OFFSET, &ttl));
+    TEST_ASSERT_EQUAL_INT(0, ttl);
+
+    /* without a usable SOA record, NODATA is no negative response */
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, _parse(nodata, sizeof(nodata) - 1, &ttl));
+    TEST_ASSERT_EQUAL_INT(-EBADMSG, _parse(nodata, RR_OFFSET + 1, &ttl));
+
+    /* RDATA too short to contain MINIMUM */
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _parse(short_rdata, sizeof(short_rdata), &ttl));
+    TEST_ASSERT_EQUAL_INT(0, ttl);
+}
+
+/* NSCOUNT claims more records than the message contains */
+static void test_dns_msg_negative_ttl_nscount(void)
+{
+    static const uint8_t msg[] = {
+        HDR(RCODE_NXDOMAIN, 0, 2), QUESTION, NS(3600U),
+    };
+    uint32_t ttl;
+
+    TEST_ASSERT_EQUAL_INT(-ENOENT, _parse(msg, sizeof(msg), &ttl));
+    TEST_ASSERT_EQUAL_INT(0, ttl);
+}
+
+Test *tests_dns_msg_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_dns_msg_parse_reply_aaaa),
+        new_TestFixture(test_dns_msg_negative_ttl),
+        new_TestFixture(test_dns_msg_negative_ttl_skip_records),
+        new_TestFixture(test_dns_msg_negative_ttl_label_pointer),
+        new_TestFixture(test_dns_msg_negative_ttl_truncated),
+        new_TestFixture(test_dns_msg_negative_ttl_nscount),
+    };
+
+    EMB_UNIT_TESTCALLER(dns_msg_tests, NULL, NULL, fixtures);
+
+    return (Test *)&dns_msg_tests;
+}
+
+void tests_dns_msg(void)
+{
+    TESTS_RUN(tests_dns_msg_tests());
+}
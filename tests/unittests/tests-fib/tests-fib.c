@@ -975,6 +975,132 @@ static void test_fib_20_replace_prefix(void)
     fib_deinit(&test_fib_table);
 }
 
+/*
+* @brief helper to create a prefix of @p len bits of @p addr, with a set host
+* bit to make the address unique
+*/
+static void _prefix_with_host_bit(uint8_t *prefix, const uint8_t *addr,
+                                  unsigned len)
+{
+    memset(prefix, 0, 16);
+    if (len) {
+        memcpy(prefix, addr, len / 8);
+        prefix[len / 8] = 0x80 >> ((len % 8) + 1);
+    }
+}
+
+/*
+* @brief the longest matching prefix wins, independent of the order of insertion
+* It is expected to get the next hop of the longest prefix until it is removed
+* and never to match an address of a different size
+*/
+static void test_fib_21_longest_prefix_match(void)
+{
+    uint8_t dst[16] = { 0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x01 };
+    uint8_t lookup[16];
+    uint8_t nxt[16] = { 0xfe, 0x80 };
+    uint8_t nxt_out[16];
+    /* prefix lengths in the order of insertion, 0 is the default route */
+    static const uint8_t lens[] = { 32, 0, 64, 33, 17 };
+    size_t nxt_size;
+    uint32_t nxt_flags;
+    kernel_pid_t iface_id;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(lens); i++) {
+        uint8_t prefix[16];
+
+        _prefix_with_host_bit(prefix, dst, lens[i]);
+        nxt[15] = lens[i];
+        TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, prefix,
+                                               sizeof(prefix),
+                                               (uint32_t)lens[i] << FIB_FLAG_NET_PREFIX_SHIFT,
+                                               nxt, sizeof(nxt), 0, 100000));
+    }
+    /* an IPv4 address with the same leading bytes */
+    nxt[15] = 0xff;
+    TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, dst, 4, 0,
+                                           nxt, sizeof(nxt), 0, 100000));
+
+    memcpy(lookup, dst, sizeof(lookup));
+    lookup[15] = 0x42;
+
+    static const uint8_t expected[] = { 64, 33, 32, 17, 0 };
+    for (unsigned i = 0; i < ARRAY_SIZE(expected); i++) {
+        uint8_t prefix[16];
+
+        nxt_size = sizeof(nxt_out);
+        TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                                  nxt_out, &nxt_size, &nxt_flags,
+                                                  lookup, sizeof(lookup), 0));
+        TEST_ASSERT_EQUAL_INT(expected[i], nxt_out[15]);
+
+        _prefix_with_host_bit(prefix, dst, expected[i]);
+        fib_remove_entry(&test_fib_table, prefix, sizeof(prefix));
+    }
+
+    nxt_size = sizeof(nxt_out);
+    TEST_ASSERT_EQUAL_INT(-EHOSTUNREACH,
+                          fib_get_next_hop(&test_fib_table, &iface_id,
+                                           nxt_out, &nxt_size, &nxt_flags,
+                                           lookup, sizeof(lookup), 0));
+    TEST_ASSERT_EQUAL_INT(1, fib_get_num_used_entries(&test_fib_table));
+
+    nxt_size = sizeof(nxt_out);
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                                              nxt_out, &nxt_size, &nxt_flags,
+                                              dst, 4, 0));
+    TEST_ASSERT_EQUAL_INT(0xff, nxt_out[15]);
+
+    fib_deinit(&test_fib_table);
+}
+
+/*
+* @brief entries are removed once their lifetime expired
+* It is expected to keep only the entries which did not expire
+*/
+static void test_fib_22_expired_entries(void)
+{
+    uint8_t dst[16] = { 0x20, 0x01, 0x0d, 0xb8 };
+    uint8_t nxt[16] = { 0xfe, 0x80 };
+    uint8_t nxt_out[16];
+    static const uint32_t lifetimes[] = { 100000, 1, (uint32_t)FIB_LIFETIME_NO_EXPIRE, 2 };
+    size_t nxt_size;
+    uint32_t nxt_flags;
+    kernel_pid_t iface_id;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(lifetimes); i++) {
+        dst[15] = i;
+        TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, dst,
+                                               sizeof(dst), 0, nxt, sizeof(nxt),
+                                               0, lifetimes[i]));
+    }
+    TEST_ASSERT_EQUAL_INT(4, fib_get_num_used_entries(&test_fib_table));
+    TEST_ASSERT_EQUAL_INT(5, universal_address_get_num_used_entries());
+
+    xtimer_usleep(3 * US_PER_MS);
+
+    /* any look-up removes the expired entries */
+    dst[15] = 1;
+    nxt_size = sizeof(nxt_out);
+    TEST_ASSERT_EQUAL_INT(-EHOSTUNREACH,
+                          fib_get_next_hop(&test_fib_table, &iface_id,
+                                           nxt_out, &nxt_size, &nxt_flags,
+                                           dst, sizeof(dst), 0));
+    TEST_ASSERT_EQUAL_INT(2, fib_get_num_used_entries(&test_fib_table));
+    TEST_ASSERT_EQUAL_INT(3, universal_address_get_num_used_entries());
+
+    for (unsigned i = 0; i < ARRAY_SIZE(lifetimes); i++) {
+        dst[15] = i;
+        nxt_size = sizeof(nxt_out);
+        int ret = fib_get_next_hop(&test_fib_table, &iface_id, nxt_out,
+                                   &nxt_size, &nxt_flags, dst, sizeof(dst), 0);
+        /* the entries with a lifetime of 1 ms and 2 ms expired */
+        TEST_ASSERT_EQUAL_INT((i & 1) ? -EHOSTUNREACH : 0, ret);
+    }
+
+    fib_deinit(&test_fib_table);
+}
+
 Test *tests_fib_tests(void)
 {
     fib_init(&test_fib_table);
@@ -999,6 +1125,8 @@ Test *tests_fib_tests(void)
                         new_TestFixture(test_fib_18_get_next_hop_invalid_parameters),
                         new_TestFixture(test_fib_19_default_gateway),
                         new_TestFixture(test_fib_20_replace_prefix),
+                        new_TestFixture(test_fib_21_longest_prefix_match),
+                        new_TestFixture(test_fib_22_expired_entries),
     };
 
     EMB_UNIT_TESTCALLER(fib_tests, NULL, NULL, fixtures);
@@ -178,6 +178,173 @@ static void test_nib_ft_get__success4(void)
     TEST_ASSERT_EQUAL_INT(IFACE, fte.iface);
 }
 
+/*
+ * Adds nested routes with prefix lengths 16, 30, 48, and 64 and a route
+ * diverging from them after the first 20 bit, then tries to get addresses
+ * matching each of them.
+ * Expected result: gnrc_ipv6_nib_ft_get() always returns the route with the
+ * longest matching prefix
+ */
+static void test_nib_ft_get__lpm_overlapping(void)
+{
+    static const uint8_t pfx_lens[] = { 16, GLOBAL_PREFIX_LEN, 48, 64 };
+    gnrc_ipv6_nib_ft_t fte;
+    ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                 { .u64 = TEST_UINT64 } } };
+    ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                      { .u64 = TEST_UINT64 } } };
+    /* add in non-sorted order so the index has to split nodes */
+    static const uint8_t order[] = { 3, 1, 2, 0 };
+    ipv6_addr_t other = dst;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(order); i++) {
+        next_hop.u64[1].u64 = TEST_UINT64 + order[i];
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, pfx_lens[order[i]],
+                                                      &next_hop, IFACE, 0));
+    }
+    bf_toggle(other.u8, 20);
+    next_hop.u64[1].u64 = TEST_UINT64 + ARRAY_SIZE(pfx_lens);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&other, 24, &next_hop,
+                                                  IFACE, 0));
+    for (unsigned i = 0; i < ARRAY_SIZE(pfx_lens); i++) {
+        ipv6_addr_t addr = dst;
+
+        /* diverge from all longer prefixes */
+        if ((i + 1) < ARRAY_SIZE(pfx_lens)) {
+            bf_toggle(addr.u8, pfx_lens[i]);
+        }
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&addr, NULL, &fte));
+        TEST_ASSERT_EQUAL_INT(pfx_lens[i], fte.dst_len);
+        TEST_ASSERT(ipv6_addr_match_prefix(&addr, &fte.dst) >= pfx_lens[i]);
+        TEST_ASSERT(fte.next_hop.u64[1].u64 == (TEST_UINT64 + i));
+    }
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&other, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(24, fte.dst_len);
+    /* only matches the first 20 bit of the nested routes */
+    bf_toggle(other.u8, 23);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&other, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(16, fte.dst_len);
+}
+
+/*
+ * Adds nested routes with prefix lengths 30 and 48 and removes them again one
+ * after another.
+ * Expected result: after removal of the longer route gnrc_ipv6_nib_ft_get()
+ * returns the shorter one, after removal of both it returns -ENETUNREACH
+ */
+static void test_nib_ft_get__lpm_removal(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop1 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop2 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 + 1 } } };
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN,
+                                                  &next_hop1, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, 48, &next_hop2,
+                                                  IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(48, fte.dst_len);
+    TEST_ASSERT(ipv6_addr_equal(&next_hop2, &fte.next_hop));
+    gnrc_ipv6_nib_ft_del(&dst, 48);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(GLOBAL_PREFIX_LEN, fte.dst_len);
+    TEST_ASSERT(ipv6_addr_equal(&next_hop1, &fte.next_hop));
+    /* re-add the longer route, remove the shorter one */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, 48, &next_hop2,
+                                                  IFACE, 0));
+    gnrc_ipv6_nib_ft_del(&dst, GLOBAL_PREFIX_LEN);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(48, fte.dst_len);
+    TEST_ASSERT(ipv6_addr_equal(&next_hop2, &fte.next_hop));
+    gnrc_ipv6_nib_ft_del(&dst, 48);
+    TEST_ASSERT_EQUAL_INT(-ENETUNREACH, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+}
+
+/*
+ * Adds the default route and a route, then tries to get an address within and
+ * one outside of the route's prefix, then removes the route.
+ * Expected result: gnrc_ipv6_nib_ft_get() returns the route for the address
+ * within its prefix and the default route for all other addresses
+ */
+static void test_nib_ft_get__lpm_def_route(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop1 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop2 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 + 1 } } };
+    ipv6_addr_t other = dst;
+
+    bf_toggle(other.u8, GLOBAL_PREFIX_LEN - 1);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(NULL, 0, &next_hop1, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN,
+                                                  &next_hop2, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(GLOBAL_PREFIX_LEN, fte.dst_len);
+    TEST_ASSERT(ipv6_addr_equal(&next_hop2, &fte.next_hop));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&other, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(0, fte.dst_len);
+    TEST_ASSERT(ipv6_addr_equal(&next_hop1, &fte.next_hop));
+    gnrc_ipv6_nib_ft_del(&dst, GLOBAL_PREFIX_LEN);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+    TEST_ASSERT_EQUAL_INT(0, fte.dst_len);
+    TEST_ASSERT(ipv6_addr_equal(&next_hop1, &fte.next_hop));
+}
+
+/*
+ * Adds the default route and two routes with the same prefix via different
+ * next hops, then clears the mode of the route added first without removing it
+ * (as the NIB does when a router times out) and afterwards that of the
+ * second one.
+ * Expected result: gnrc_ipv6_nib_ft_get() returns the second route while it
+ * is in use and the default route afterwards
+ */
+static void test_nib_ft_get__lpm_cleared_entry(void)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    _nib_offl_entry_t *route = NULL;
+    static const ipv6_addr_t dst = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                              { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop1 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t next_hop2 = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                  { .u64 = TEST_UINT64 + 1 } } };
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(NULL, 0, &next_hop1, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN,
+                                                  &next_hop1, IFACE, 0));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, GLOBAL_PREFIX_LEN,
+                                                  &next_hop2, IFACE, 0));
+    for (unsigned i = 0; i < 2; i++) {
+        const ipv6_addr_t *next_hop = (i == 0) ? &next_hop1 : &next_hop2;
+
+        while ((route = _nib_offl_iter(route)) != NULL) {
+            if ((route->pfx_len == GLOBAL_PREFIX_LEN) &&
+                ipv6_addr_equal(&route->next_hop->ipv6, next_hop)) {
+                break;
+            }
+        }
+        TEST_ASSERT_NOT_NULL(route);
+        route->mode = _EMPTY;
+        route = NULL;
+        TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_get(&dst, NULL, &fte));
+        if (i == 0) {
+            TEST_ASSERT_EQUAL_INT(GLOBAL_PREFIX_LEN, fte.dst_len);
+            TEST_ASSERT(ipv6_addr_equal(&next_hop2, &fte.next_hop));
+        }
+        else {
+            TEST_ASSERT_EQUAL_INT(0, fte.dst_len);
+            TEST_ASSERT(ipv6_addr_equal(&next_hop1, &fte.next_hop));
+        }
+    }
+}
+
 /*
  * Tries to create a forwarding table entry for the default route (::) with
  * NULL as next hop.
@@ -727,6 +894,10 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_get__success2),
         new_TestFixture(test_nib_ft_get__success3),
         new_TestFixture(test_nib_ft_get__success4),
+        new_TestFixture(test_nib_ft_get__lpm_overlapping),
+        new_TestFixture(test_nib_ft_get__lpm_removal),
+        new_TestFixture(test_nib_ft_get__lpm_def_route),
+        new_TestFixture(test_nib_ft_get__lpm_cleared_entry),
         new_TestFixture(test_nib_ft_add__EINVAL_def_route_next_hop_NULL),
         new_TestFixture(test_nib_ft_add__EINVAL_iface0),
         new_TestFixture(test_nib_ft_add__ENOMEM_diff_def_router),
@@ -361,6 +361,49 @@ static void test_nib_get__empty(void)
     TEST_ASSERT_NULL(_nib_onl_get(&addr, IFACE));
 }
 
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+/*
+ * Creates CONFIG_GNRC_IPV6_NIB_NUMOF entries with different IP addresses,
+ * removes every second one and then looks all of them up.
+ * Expected result: only the remaining entries are found and the hash index
+ * statistics account for all look-ups
+ */
+static void test_nib_get__hash(void)
+{
+    _nib_onl_entry_t *nodes[CONFIG_GNRC_IPV6_NIB_NUMOF];
+    gnrc_ipv6_nib_nc_hash_stats_t stats;
+    ipv6_addr_t addr = { .u64 = { { .u8 = GLOBAL_PREFIX },
+                                  { .u64 = TEST_UINT64 } } };
+
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        TEST_ASSERT_NOT_NULL((nodes[i] = _nib_onl_alloc(&addr, IFACE)));
+        nodes[i]->mode = _NC;
+        addr.u64[1].u64++;
+    }
+    _nib_onl_hash_stats(&stats, true);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_IPV6_NIB_NUMOF, stats.entries);
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i += 2) {
+        nodes[i]->mode = _EMPTY;
+        TEST_ASSERT(_nib_onl_clear(nodes[i]));
+    }
+    addr.u64[1].u64 = TEST_UINT64;
+    for (unsigned i = 0; i < CONFIG_GNRC_IPV6_NIB_NUMOF; i++) {
+        if (i % 2) {
+            TEST_ASSERT(nodes[i] == _nib_onl_get(&addr, IFACE));
+        }
+        else {
+            TEST_ASSERT_NULL(_nib_onl_get(&addr, IFACE));
+        }
+        addr.u64[1].u64++;
+    }
+    _nib_onl_hash_stats(&stats, false);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_IPV6_NIB_NUMOF / 2, stats.entries);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GNRC_IPV6_NIB_NUMOF, stats.lookups);
+    TEST_ASSERT(stats.probes >= (CONFIG_GNRC_IPV6_NIB_NUMOF / 2));
+    TEST_ASSERT(stats.max_probes >= 1);
+}
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
+
 /*
  * Creates CONFIG_GNRC_IPV6_NIB_NUMOF neighbor cache entries with different IP
  * addresses and a non-garbage-collectible AR state and then tries to add
@@ -2020,6 +2063,9 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_get__empty),
         new_TestFixture(test_nib_get__not_in_nib),
         new_TestFixture(test_nib_get__success),
+#if IS_ACTIVE(CONFIG_GNRC_IPV6_NIB_NC_HASH)
+        new_TestFixture(test_nib_get__hash),
+#endif  /* CONFIG_GNRC_IPV6_NIB_NC_HASH */
         new_TestFixture(test_nib_nc_add__no_space_left_diff_addr),
         new_TestFixture(test_nib_nc_add__no_space_left_diff_iface),
         new_TestFixture(test_nib_nc_add__no_space_left_diff_addr_iface),
@@ -404,6 +404,36 @@ static void test_hashes_sha3_hash_sequence_04(void)
     TEST_ASSERT(calc_steps_and_compare_hash_512(m04_1, m04_1_len, m04_2, m04_2_len, h04_512));
 }
 
+static void test_hashes_sha3_hash_unaligned_blocks(void)
+{
+    /* SHA3-256 of the bytes (i * 7) for 1 <= i <= 300 */
+    static const uint8_t expected[] = {
+        0x63, 0x39, 0xD2, 0xFD, 0x3C, 0xE2, 0x8C, 0x29,
+        0x2E, 0x1C, 0xE6, 0xE3, 0x13, 0xB5, 0xD2, 0xC9,
+        0x70, 0x6F, 0xB3, 0xC9, 0x8F, 0xDC, 0x35, 0xE9,
+        0xF3, 0x4B, 0xF2, 0x74, 0x7B, 0xAC, 0x79, 0x21
+    };
+    uint8_t buf[301];
+    uint8_t hash[SHA3_256_DIGEST_LENGTH];
+    keccak_state_t state;
+
+    for (unsigned i = 0; i < sizeof(buf); i++) {
+        buf[i] = i * 7;
+    }
+
+    /* an unaligned message of more than two blocks at once */
+    TEST_ASSERT(calc_and_compare_hash_256(&buf[1], 300, expected));
+
+    /* whole blocks absorbed directly from unaligned input, and after a
+     * partial block */
+    sha3_256_init(&state);
+    sha3_update(&state, &buf[1], 136);
+    sha3_update(&state, &buf[137], 1);
+    sha3_update(&state, &buf[138], 163);
+    sha3_256_final(&state, hash);
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, hash, sizeof(hash)));
+}
+
 static void test_hashes_sha3_hash_sequence_failing_compare(void)
 {
     /* failing compare (message from testcase 02 alterered slightly) */
@@ -419,6 +449,7 @@ Test *tests_hashes_sha3_tests(void)
         new_TestFixture(test_hashes_sha3_hash_sequence_02),
         new_TestFixture(test_hashes_sha3_hash_sequence_03),
         new_TestFixture(test_hashes_sha3_hash_sequence_04),
+        new_TestFixture(test_hashes_sha3_hash_unaligned_blocks),
         new_TestFixture(test_hashes_sha3_hash_sequence_failing_compare),
     };
 
@@ -13,6 +13,7 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
@@ -165,6 +166,94 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+/* straightforward byte-wise sum of RFC 1071 to compare against */
+static uint16_t _ref_csum(uint16_t sum, const uint8_t *buf, size_t len)
+{
+    uint32_t csum = sum;
+
+    for (size_t i = 0; i < len; i++) {
+        csum += (i & 1) ? buf[i] : (buf[i] << 8);
+    }
+    while (csum >> 16) {
+        csum = (csum & 0xffff) + (csum >> 16);
+    }
+    return csum;
+}
+
+static void test_inet_csum__alignment_and_length(void)
+{
+    uint8_t data[80];
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        data[i] = 0xff - (i * 13);
+    }
+    /* covers every alignment of the buffer and every length of the tail
+     * behind the unrolled word loop */
+    for (unsigned off = 0; off < 4; off++) {
+        for (unsigned len = 0; len <= sizeof(data) - off; len++) {
+            TEST_ASSERT_EQUAL_INT(_ref_csum(0x1234, &data[off], len),
+                                  inet_csum(0x1234, &data[off], len));
+        }
+    }
+}
+
+static void test_inet_csum__slices(void)
+{
+    uint8_t data[67];
+    uint16_t sum = 0;
+    size_t accum_len = 0;
+
+    for (unsigned i = 0; i < sizeof(data); i++) {
+        data[i] = i * 7;
+    }
+    /* odd and even slices starting at odd and even addresses */
+    for (unsigned len = 1; accum_len < sizeof(data); len++) {
+        if (len > sizeof(data) - accum_len) {
+            len = sizeof(data) - accum_len;
+        }
+        sum = inet_csum_slice(sum, &data[accum_len], len, accum_len);
+        accum_len += len;
+    }
+    TEST_ASSERT_EQUAL_INT(_ref_csum(0, data, sizeof(data)), sum);
+}
+
+static void test_inet_csum__update(void)
+{
+    /* IPv4 header of test_inet_csum__calculate_csum() with checksum */
+    uint8_t data[] = {
+        0x45, 0x00, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00,
+        0x40, 0x11, 0xb8, 0x61, 0xc0, 0xa8, 0x00, 0x01,
+        0xc0, 0xa8, 0x00, 0xc7,
+    };
+
+    /* decrement the TTL as a router would */
+    uint16_t csum = inet_csum_update(0xb861, 0x4011, 0x3f11);
+    data[8] = 0x3f;
+    data[10] = csum >> 8;
+    data[11] = csum & 0xff;
+    TEST_ASSERT_EQUAL_INT(0xffff, inet_csum(0, data, sizeof(data)));
+
+    /* example of RFC 1624, section 4: must be 0x0000, not -0 (0xffff) */
+    TEST_ASSERT_EQUAL_INT(0x0000, inet_csum_update(0xdd2f, 0x5555, 0x3285));
+}
+
+static void test_inet_csum__update_buf(void)
+{
+    uint8_t data[] = {
+        0x45, 0x00, 0x00, 0x73, 0x00, 0x00, 0x40, 0x00,
+        0x40, 0x11, 0xb8, 0x61, 0xc0, 0xa8, 0x00, 0x01,
+        0xc0, 0xa8, 0x00, 0xc7,
+    };
+    const uint8_t dst[] = { 0x0a, 0x01, 0x02, 0x03 };
+
+    /* rewrite the destination address, as NAT does */
+    uint16_t csum = inet_csum_update_buf(0xb861, &data[16], dst, sizeof(dst));
+    memcpy(&data[16], dst, sizeof(dst));
+    data[10] = csum >> 8;
+    data[11] = csum & 0xff;
+    TEST_ASSERT_EQUAL_INT(0xffff, inet_csum(0, data, sizeof(data)));
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +265,10 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__alignment_and_length),
+        new_TestFixture(test_inet_csum__slices),
+        new_TestFixture(test_inet_csum__update),
+        new_TestFixture(test_inet_csum__update_buf),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
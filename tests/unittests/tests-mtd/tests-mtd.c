@@ -193,6 +193,214 @@ static void test_mtd_write_read_flash(void)
 }
 #endif
 
+#ifdef MODULE_MTD_WRITE_PAGE
+/* NOR flash mock: writes can only clear bits, counts erases */
+#define FLASH_SECTOR_COUNT      (2)
+#define FLASH_PAGE_PER_SECTOR   (2)
+#define FLASH_PAGE_SIZE         (32)
+#define FLASH_SECTOR_SIZE       (FLASH_PAGE_PER_SECTOR * FLASH_PAGE_SIZE)
+
+static uint8_t _flash_mem[FLASH_SECTOR_COUNT * FLASH_SECTOR_SIZE];
+static unsigned _flash_erases;
+
+static int _flash_init(mtd_dev_t *mtd)
+{
+    (void)mtd;
+    return 0;
+}
+
+static int _flash_read_page(mtd_dev_t *mtd, void *dest, uint32_t page,
+                            uint32_t offset, uint32_t size)
+{
+    (void)mtd;
+    memcpy(dest, &_flash_mem[page * FLASH_PAGE_SIZE + offset], size);
+    return size;
+}
+
+static int _flash_write_page(mtd_dev_t *mtd, const void *src, uint32_t page,
+                             uint32_t offset, uint32_t size)
+{
+    const uint8_t *data = src;
+    uint8_t *mem = &_flash_mem[page * FLASH_PAGE_SIZE + offset];
+
+    (void)mtd;
+    if (size > (FLASH_PAGE_SIZE - offset)) {
+        size = FLASH_PAGE_SIZE - offset;
+    }
+    for (unsigned i = 0; i < size; i++) {
+        mem[i] &= data[i];
+    }
+    return size;
+}
+
+static int _flash_erase_sector(mtd_dev_t *mtd, uint32_t sector, uint32_t count)
+{
+    (void)mtd;
+    memset(&_flash_mem[sector * FLASH_SECTOR_SIZE], 0xff, count * FLASH_SECTOR_SIZE);
+    _flash_erases += count;
+    return 0;
+}
+
+static const mtd_desc_t _flash_driver = {
+    .init = _flash_init,
+    .read_page = _flash_read_page,
+    .write_page = _flash_write_page,
+    .erase_sector = _flash_erase_sector,
+    .flags = MTD_DRIVER_FLAG_CLEARING_OVERWRITE,
+};
+
+static mtd_dev_t _flash = {
+    .driver = &_flash_driver,
+    .sector_count = FLASH_SECTOR_COUNT,
+    .pages_per_sector = FLASH_PAGE_PER_SECTOR,
+    .page_size = FLASH_PAGE_SIZE,
+    .write_size = 1,
+};
+
+static void _flash_setup(void)
+{
+    if (_flash.work_area == NULL) {
+        TEST_ASSERT_EQUAL_INT(0, mtd_init(&_flash));
+    }
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(&_flash, 0, FLASH_SECTOR_COUNT));
+    memset(&_flash.write_page_stats, 0, sizeof(_flash.write_page_stats));
+    _flash_erases = 0;
+}
+
+static void test_mtd_write_page__append(void)
+{
+    const char chunk[] = "0123456";
+    uint8_t expected[FLASH_SECTOR_SIZE];
+    uint8_t buf_read[FLASH_SECTOR_SIZE];
+    uint32_t pos = 0;
+
+    _flash_setup();
+    memset(expected, 0xff, sizeof(expected));
+
+    /* append to erased memory, crossing page boundaries */
+    while ((pos + sizeof(chunk)) <= FLASH_SECTOR_SIZE) {
+        int ret = mtd_write_page(&_flash, chunk, pos / FLASH_PAGE_SIZE,
+                                 pos % FLASH_PAGE_SIZE, sizeof(chunk));
+        TEST_ASSERT_EQUAL_INT(0, ret);
+        memcpy(&expected[pos], chunk, sizeof(chunk));
+        pos += sizeof(chunk);
+
+        ret = mtd_read(&_flash, buf_read, 0, sizeof(buf_read));
+        TEST_ASSERT_EQUAL_INT(0, ret);
+        TEST_ASSERT_EQUAL_INT(0, memcmp(expected, buf_read, sizeof(buf_read)));
+    }
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(&_flash));
+
+    TEST_ASSERT_EQUAL_INT(0, memcmp(expected, _flash_mem, sizeof(expected)));
+    TEST_ASSERT_EQUAL_INT(0, _flash_erases);
+    TEST_ASSERT_EQUAL_INT(0, _flash.write_page_stats.erases);
+    TEST_ASSERT_EQUAL_INT(pos / sizeof(chunk), _flash.write_page_stats.erases_avoided);
+}
+
+static void test_mtd_write_page__overwrite(void)
+{
+    uint8_t buf_read[8];
+
+    _flash_setup();
+
+    /* programs erased memory */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(&_flash, "AAAA", 0, 0, 4));
+    /* 'B' sets bits of 'A', this needs an erase */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(&_flash, "BBBB", 0, 2, 4));
+    /* programs erased memory again */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(&_flash, "CC", 1, 0, 2));
+#ifdef MODULE_MTD_WRITE_PAGE_CACHE
+    /* nothing written yet */
+    TEST_ASSERT_EQUAL_INT(0xff, _flash_mem[0]);
+    TEST_ASSERT_EQUAL_INT(0xff, _flash_mem[FLASH_PAGE_SIZE]);
+    TEST_ASSERT_EQUAL_INT(0, _flash_erases);
+#endif
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(&_flash));
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(&_flash, buf_read, 0, 6));
+    TEST_ASSERT_EQUAL_INT(0, memcmp("AABBBB", buf_read, 6));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(&_flash, buf_read, FLASH_PAGE_SIZE, 2));
+    TEST_ASSERT_EQUAL_INT(0, memcmp("CC", buf_read, 2));
+    TEST_ASSERT_EQUAL_INT(1, _flash_erases);
+    TEST_ASSERT_EQUAL_INT(1, _flash.write_page_stats.erases);
+    TEST_ASSERT_EQUAL_INT(2, _flash.write_page_stats.erases_avoided);
+}
+
+#ifdef MODULE_MTD_WRITE_PAGE_CACHE
+static void test_mtd_write_page__cache_coherence(void)
+{
+    uint8_t buf_read[4];
+
+    _flash_setup();
+
+    /* a raw write to the cached sector flushes the cache first */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(&_flash, "XY", 0, 0, 2));
+    TEST_ASSERT_EQUAL_INT(0xff, _flash_mem[0]);
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page_raw(&_flash, "Z", 0, 2, 1));
+    TEST_ASSERT_EQUAL_INT(0, memcmp("XYZ", _flash_mem, 3));
+
+    /* the cache is re-read after the raw write */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(&_flash, "W", 0, 3, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(&_flash, buf_read, 0, 4));
+    TEST_ASSERT_EQUAL_INT(0, memcmp("XYZW", buf_read, 4));
+
+    /* erasing the cached sector drops the cached data */
+    TEST_ASSERT_EQUAL_INT(0, mtd_erase_sector(&_flash, 0, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(&_flash));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(&_flash, buf_read, 0, 4));
+    TEST_ASSERT_EQUAL_INT(0, memcmp("\xff\xff\xff\xff", buf_read, 4));
+
+    /* writing to a different sector writes back the cached one */
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(&_flash, "V", 0, 0, 1));
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(&_flash, "U", FLASH_PAGE_PER_SECTOR, 0, 1));
+    TEST_ASSERT_EQUAL_INT('V', _flash_mem[0]);
+    TEST_ASSERT_EQUAL_INT(0xff, _flash_mem[FLASH_SECTOR_SIZE]);
+
+    /* powering down writes back the cache */
+    mtd_power(&_flash, MTD_POWER_DOWN);
+    TEST_ASSERT_EQUAL_INT('U', _flash_mem[FLASH_SECTOR_SIZE]);
+    TEST_ASSERT_EQUAL_INT(0, _flash.write_page_stats.erases);
+}
+
+static void test_mtd_write_page__flush(void)
+{
+    uint8_t buf_read[4];
+
+    _flash_setup();
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(&_flash, "ABCD", 1, 4, 4));
+    /* the page is not written back before mtd_flush() */
+    TEST_ASSERT_EQUAL_INT(0, memcmp("\xff\xff\xff\xff",
+                                    &_flash_mem[FLASH_PAGE_SIZE + 4], 4));
+    TEST_ASSERT_EQUAL_INT(0, mtd_read(&_flash, buf_read, FLASH_PAGE_SIZE + 4, 4));
+    TEST_ASSERT_EQUAL_INT(0, memcmp("ABCD", buf_read, 4));
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(&_flash));
+    TEST_ASSERT_EQUAL_INT(0, memcmp("ABCD", &_flash_mem[FLASH_PAGE_SIZE + 4], 4));
+    /* the cache is clean now */
+    memset(&_flash_mem[FLASH_PAGE_SIZE + 4], 0xff, 4);
+    TEST_ASSERT_EQUAL_INT(0, mtd_flush(&_flash));
+    TEST_ASSERT_EQUAL_INT(0xff, _flash_mem[FLASH_PAGE_SIZE + 4]);
+    TEST_ASSERT_EQUAL_INT(0, _flash_erases);
+}
+
+#if MODULE_VFS
+static void test_mtd_write_page__vfs_fsync(void)
+{
+    vfs_file_t filp = { .private_data.ptr = &_flash };
+
+    _flash_setup();
+
+    TEST_ASSERT_EQUAL_INT(0, mtd_write_page(&_flash, "EF", 0, 8, 2));
+    TEST_ASSERT_EQUAL_INT(0xff, _flash_mem[8]);
+    /* fsync() on the MTD device file writes back the cache */
+    TEST_ASSERT_EQUAL_INT(0, mtd_vfs_ops.fsync(&filp));
+    TEST_ASSERT_EQUAL_INT(0, memcmp("EF", &_flash_mem[8], 2));
+}
+#endif
+#endif
+#endif
+
 #if MODULE_VFS
 static void test_mtd_vfs(void)
 {
@@ -232,6 +440,17 @@ Test *tests_mtd_tests(void)
 #ifdef MTD_0
         new_TestFixture(test_mtd_write_read_flash),
 #endif
+#ifdef MODULE_MTD_WRITE_PAGE
+        new_TestFixture(test_mtd_write_page__append),
+        new_TestFixture(test_mtd_write_page__overwrite),
+#endif
+#ifdef MODULE_MTD_WRITE_PAGE_CACHE
+        new_TestFixture(test_mtd_write_page__cache_coherence),
+        new_TestFixture(test_mtd_write_page__flush),
+#if MODULE_VFS
+        new_TestFixture(test_mtd_write_page__vfs_fsync),
+#endif
+#endif
 #if MODULE_VFS
         new_TestFixture(test_mtd_vfs),
 #endif
@@ -257,6 +257,72 @@ static void test_nanocoap_cache__max_age(void)
     TEST_ASSERT(nanocoap_cache_entry_is_stale(c, 20));
 }
 
+static nanocoap_cache_entry_t *_add(const char *path, uint8_t fill, size_t len)
+{
+    uint8_t buf[_BUF_SIZE];
+    uint8_t rbuf[_BUF_SIZE];
+    coap_pkt_t req, resp;
+    uint8_t token[2] = {0xDA, 0xEC};
+    size_t hdr_len;
+
+    hdr_len = coap_build_hdr((coap_hdr_t *)&buf[0], COAP_TYPE_NON,
+                             &token[0], 2, COAP_METHOD_GET, 0xABCD);
+    coap_pkt_init(&req, &buf[0], sizeof(buf), hdr_len);
+    coap_opt_add_string(&req, COAP_OPT_URI_PATH, path, '/');
+    coap_opt_finish(&req, COAP_OPT_FINISH_NONE);
+
+    hdr_len = coap_build_hdr((coap_hdr_t *)&rbuf[0], COAP_TYPE_NON,
+                             &token[0], 2, COAP_CODE_205, 0xABCD);
+    coap_pkt_init(&resp, &rbuf[0], sizeof(rbuf), hdr_len);
+    coap_opt_finish(&resp, COAP_OPT_FINISH_NONE);
+    memset(&rbuf[hdr_len], fill, sizeof(rbuf) - hdr_len);
+
+    return nanocoap_cache_add_by_req((const coap_pkt_t *)&req,
+                                     (const coap_pkt_t *)&resp, len);
+}
+
+static void test_nanocoap_cache__byte_budget(void)
+{
+    const size_t len = CONFIG_NANOCOAP_CACHE_RESPONSE_SIZE / 2;
+    nanocoap_cache_entry_t *c1, *c2;
+    nanocoap_cache_stats_t stats;
+    uint8_t key[CONFIG_NANOCOAP_CACHE_KEY_LENGTH];
+
+    nanocoap_cache_init();
+
+    /* responses only take the space they need */
+    c1 = _add("/a", 'a', len);
+    TEST_ASSERT_NOT_NULL(c1);
+    c2 = _add("/b", 'b', len);
+    TEST_ASSERT_NOT_NULL(c2);
+    TEST_ASSERT_EQUAL_INT(2 * len, nanocoap_cache_bytes_used());
+    memcpy(key, c2->cache_key, sizeof(key));
+
+    /* deleting the first response moves the second one */
+    TEST_ASSERT_EQUAL_INT(0, nanocoap_cache_del(c1));
+    TEST_ASSERT_EQUAL_INT(-1, nanocoap_cache_del(c1));
+    TEST_ASSERT_EQUAL_INT(len, nanocoap_cache_bytes_used());
+    c2 = nanocoap_cache_key_lookup(key);
+    TEST_ASSERT_NOT_NULL(c2);
+    TEST_ASSERT((uint8_t *)c2->response_pkt.hdr == c2->response_buf);
+    TEST_ASSERT_EQUAL_INT('b', c2->response_buf[len - 1]);
+
+    /* fill the cache up to its byte budget */
+    for (unsigned i = 0; i < CONFIG_NANOCOAP_CACHE_SIZE / len; i++) {
+        char path[16];
+
+        snprintf(path, sizeof(path), "/path_%u", i);
+        TEST_ASSERT_NOT_NULL(_add(path, i, len));
+        TEST_ASSERT(nanocoap_cache_bytes_used() <= CONFIG_NANOCOAP_CACHE_SIZE);
+    }
+    TEST_ASSERT_NULL(nanocoap_cache_key_lookup(key));
+
+    nanocoap_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(1, stats.hits);
+    TEST_ASSERT_EQUAL_INT(1, stats.misses);
+    TEST_ASSERT(stats.evictions > 0);
+}
+
 Test *tests_nanocoap_cache_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -264,6 +330,7 @@ Test *tests_nanocoap_cache_tests(void)
         new_TestFixture(test_nanocoap_cache__del),
         new_TestFixture(test_nanocoap_cache__cachekey),
         new_TestFixture(test_nanocoap_cache__max_age),
+        new_TestFixture(test_nanocoap_cache__byte_budget),
     };
 
     EMB_UNIT_TESTCALLER(nanocoap_cache_entry_tests, NULL, NULL, fixtures);
@@ -14,6 +14,7 @@
 #include <errno.h>
 
 #include "embUnit.h"
+#include "kernel_defines.h"
 
 #include "net/gnrc/netreg.h"
 #include "net/gnrc/nettype.h"
@@ -185,6 +186,64 @@ void test_netreg_getnext__2_entries(void)
     gnrc_netreg_release_shared();
 }
 
+void test_netreg_getnext__other_type(void)
+{
+    gnrc_netreg_entry_t *res = NULL;
+
+    /* same demux context, but different types */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &entries[0]));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_UNDEF, &entries[1]));
+    gnrc_netreg_acquire_shared();
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_UNDEF, TEST_UINT16));
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16)));
+    TEST_ASSERT(res == &entries[0]);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_UNDEF, TEST_UINT16)));
+    TEST_ASSERT(res == &entries[1]);
+    TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    gnrc_netreg_release_shared();
+}
+
+void test_netreg_lookup__many(void)
+{
+    static gnrc_netreg_entry_t many[64];
+    gnrc_netreg_entry_t *res = NULL;
+    unsigned numof = 0;
+
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i++) {
+        /* the last two entries share a demux context */
+        uint32_t demux_ctx = TEST_UINT16 + ((i < ARRAY_SIZE(many) - 1) ? i : 0);
+
+        gnrc_netreg_entry_init_pid(&many[i], demux_ctx, TEST_UINT8);
+        TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &many[i]));
+    }
+    gnrc_netreg_acquire_shared();
+    for (unsigned i = 1; i < ARRAY_SIZE(many) - 1; i++) {
+        TEST_ASSERT_NOT_NULL((res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                                       TEST_UINT16 + i)));
+        TEST_ASSERT(res == &many[i]);
+        TEST_ASSERT_NULL(gnrc_netreg_getnext(res));
+    }
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST,
+                                       TEST_UINT16 + ARRAY_SIZE(many)));
+    for (res = gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16); res != NULL;
+         res = gnrc_netreg_getnext(res)) {
+        TEST_ASSERT((res == &many[0]) || (res == &many[ARRAY_SIZE(many) - 1]));
+        numof++;
+    }
+    TEST_ASSERT_EQUAL_INT(2, numof);
+    gnrc_netreg_release_shared();
+
+    for (unsigned i = 0; i < ARRAY_SIZE(many); i++) {
+        gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &many[i]);
+    }
+    gnrc_netreg_acquire_shared();
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16));
+    TEST_ASSERT_NULL(gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16 + 1));
+    gnrc_netreg_release_shared();
+}
+
 Test *tests_netreg_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -201,6 +260,8 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__2_entries),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
+        new_TestFixture(test_netreg_getnext__other_type),
+        new_TestFixture(test_netreg_lookup__many),
     };
 
     EMB_UNIT_TESTCALLER(netreg_tests, set_up, NULL, fixtures);
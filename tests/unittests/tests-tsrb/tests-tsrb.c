@@ -213,6 +213,90 @@ static void test_add(void)
     }
 }
 
+static void test_add_get__wrap_around(void)
+{
+    for (int i = 0; i < (int)sizeof(_io_buffer); i++) {
+        _io_buffer[i] = TEST_INPUT + i;
+    }
+    /* move indices close to the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_add(&_tsrb, _io_buffer,
+                                   BUFFER_SIZE - TEST_DROP_NUM));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_drop(&_tsrb, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_add(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(1, tsrb_full(&_tsrb));
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_peek(&_tsrb, _io_buffer,
+                                                 sizeof(_io_buffer)));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i), _io_buffer[i]);
+    }
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_get(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i), _io_buffer[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(IO_BUFFER_CANARY, _io_buffer[BUFFER_SIZE]);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_empty(&_tsrb));
+}
+
+static void test_write_span(void)
+{
+    uint8_t *dst;
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_write_span(&_tsrb, &dst));
+    TEST_ASSERT(dst == _tsrb_buffer);
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        dst[i] = TEST_INPUT + i;
+    }
+    tsrb_write_commit(&_tsrb, BUFFER_SIZE - TEST_DROP_NUM);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM, tsrb_avail(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_write_span(&_tsrb, &dst));
+    TEST_ASSERT(dst == &_tsrb_buffer[BUFFER_SIZE - TEST_DROP_NUM]);
+    tsrb_write_commit(&_tsrb, TEST_DROP_NUM);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_full(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(0, tsrb_write_span(&_tsrb, &dst));
+    /* free space wraps around */
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_drop(&_tsrb, TEST_DROP_NUM));
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_write_span(&_tsrb, &dst));
+    TEST_ASSERT(dst == _tsrb_buffer);
+    for (int i = TEST_DROP_NUM; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i), tsrb_get_one(&_tsrb));
+    }
+    TEST_ASSERT_EQUAL_INT(1, tsrb_empty(&_tsrb));
+}
+
+static void test_read_span(void)
+{
+    const uint8_t *src;
+
+    TEST_ASSERT_EQUAL_INT(0, tsrb_read_span(&_tsrb, &src));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, tsrb_add_one(&_tsrb, TEST_INPUT + i));
+    }
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_read_span(&_tsrb, &src));
+    TEST_ASSERT(src == _tsrb_buffer);
+    tsrb_read_commit(&_tsrb, BUFFER_SIZE - TEST_DROP_NUM);
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_avail(&_tsrb));
+    for (unsigned i = 0; i < TEST_DROP_NUM; i++) {
+        TEST_ASSERT_EQUAL_INT(0, tsrb_add_one(&_tsrb, TEST_INPUT + i));
+    }
+    /* readable data wraps around */
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_read_span(&_tsrb, &src));
+    TEST_ASSERT(src == &_tsrb_buffer[BUFFER_SIZE - TEST_DROP_NUM]);
+    TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + BUFFER_SIZE - TEST_DROP_NUM),
+                          src[0]);
+    tsrb_read_commit(&_tsrb, TEST_DROP_NUM);
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_read_span(&_tsrb, &src));
+    TEST_ASSERT(src == _tsrb_buffer);
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, src[0]);
+    tsrb_read_commit(&_tsrb, TEST_DROP_NUM);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_empty(&_tsrb));
+}
+
 static Test *tests_tsrb_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -228,6 +312,9 @@ static Test *tests_tsrb_tests(void)
         new_TestFixture(test_drop),
         new_TestFixture(test_add_one),
         new_TestFixture(test_add),
+        new_TestFixture(test_add_get__wrap_around),
+        new_TestFixture(test_write_span),
+        new_TestFixture(test_read_span),
     };
 
     EMB_UNIT_TESTCALLER(tsrb_tests, NULL, tear_down, fixtures);
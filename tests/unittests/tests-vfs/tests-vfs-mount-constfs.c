@@ -67,6 +67,25 @@ static vfs_mount_t _test_vfs_mount = {
     .private_data = (void *)&fs_data,
 };
 
+static const constfs_file_t _nested_files[] = {
+    {
+        .path = "/nested.txt",
+        .data = str_data,
+        .size = sizeof(str_data),
+    },
+};
+
+static const constfs_t fs_nested_data = {
+    .files = _nested_files,
+    .nfiles = ARRAY_SIZE(_nested_files),
+};
+
+static vfs_mount_t _test_vfs_mount_nested = {
+    .mount_point = "/test/nested",
+    .fs = &constfs_file_system,
+    .private_data = (void *)&fs_nested_data,
+};
+
 static void test_vfs_mount_umount(void)
 {
     int res;
@@ -128,6 +147,38 @@ static void test_vfs_constfs_open(void)
     TEST_ASSERT_EQUAL_INT(0, res);
 }
 
+static void test_vfs_mount__longest_prefix(void)
+{
+    struct stat buf;
+    int res;
+
+    /* the nested mount is mounted first, but has the longer mount point */
+    res = vfs_mount(&_test_vfs_mount_nested);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_mount(&_test_vfs_mount);
+    TEST_ASSERT_EQUAL_INT(0, res);
+
+    res = vfs_stat("/test/nested/nested.txt", &buf);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_stat("/test/nested/test.txt", &buf);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, res);
+    res = vfs_stat("/test/test.txt", &buf);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_stat("/test/nested.txt", &buf);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, res);
+    /* a mount point is only a prefix up to a directory separator */
+    res = vfs_stat("/testnested/nested.txt", &buf);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, res);
+
+    res = vfs_umount(&_test_vfs_mount_nested, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+    res = vfs_stat("/test/nested/nested.txt", &buf);
+    TEST_ASSERT_EQUAL_INT(-ENOENT, res);
+
+    res = vfs_umount(&_test_vfs_mount, false);
+    TEST_ASSERT_EQUAL_INT(0, res);
+}
+
 static void test_vfs_constfs_read_lseek(void)
 {
     int res;
@@ -211,6 +262,7 @@ Test *tests_vfs_mount_constfs_tests(void)
         new_TestFixture(test_vfs_mount__invalid),
         new_TestFixture(test_vfs_umount__invalid_mount),
         new_TestFixture(test_vfs_constfs_open),
+        new_TestFixture(test_vfs_mount__longest_prefix),
         new_TestFixture(test_vfs_constfs_read_lseek),
 #if MODULE_NEWLIB || MODULE_PICOLIBC || defined(BOARD_NATIVE)
         new_TestFixture(test_vfs_constfs__posix),
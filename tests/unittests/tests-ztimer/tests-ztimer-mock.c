@@ -288,6 +288,71 @@ static void test_ztimer_mock_is_set(void)
     TEST_ASSERT(!ztimer_is_set(z, &alarm2));
 }
 
+/**
+ * @brief   Testing the pairing heap timer queue
+ */
+static void test_ztimer_mock_heap(void)
+{
+    ztimer_mock_t zmock;
+    ztimer_clock_t *z = &zmock.super;
+    ztimer_t alarms[8];
+    uint32_t count = 0;
+
+    ztimer_mock_init(&zmock, 16);
+    ztimer_clock_use_heap(z);
+
+    /* make sure ztimer stays turned on */
+    ztimer_acquire(z);
+
+    /* set in non-monotonic order, timer i expires at (i + 1) * 1000 */
+    static const uint8_t order[] = { 5, 2, 7, 0, 3, 6, 1, 4 };
+    for (unsigned i = 0; i < ARRAY_SIZE(order); i++) {
+        alarms[order[i]] = (ztimer_t){ .callback = cb_incr, .arg = &count, };
+        ztimer_set(z, &alarms[order[i]], (order[i] + 1) * 1000);
+    }
+    for (unsigned i = 0; i < ARRAY_SIZE(alarms); i++) {
+        TEST_ASSERT(ztimer_is_set(z, &alarms[i]));
+    }
+
+    /* remove the head and one inner timer */
+    TEST_ASSERT(ztimer_remove(z, &alarms[0]));
+    TEST_ASSERT(ztimer_remove(z, &alarms[5]));
+    TEST_ASSERT(!ztimer_remove(z, &alarms[5]));
+    TEST_ASSERT(!ztimer_is_set(z, &alarms[0]));
+    TEST_ASSERT(!ztimer_is_set(z, &alarms[5]));
+
+    ztimer_mock_advance(&zmock, 1999);
+    TEST_ASSERT_EQUAL_INT(0, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(1, count);
+    TEST_ASSERT(!ztimer_is_set(z, &alarms[1]));
+
+    /* re-set a pending timer to a later target */
+    ztimer_set(z, &alarms[2], 10000);
+    ztimer_mock_advance(&zmock, 2000);
+    TEST_ASSERT_EQUAL_INT(2, count);
+    TEST_ASSERT(!ztimer_is_set(z, &alarms[3]));
+    TEST_ASSERT(ztimer_is_set(z, &alarms[2]));
+
+    /* expire the remaining timers (4, 6, 7, then the re-set 2) */
+    ztimer_mock_advance(&zmock, 7999);
+    TEST_ASSERT_EQUAL_INT(5, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(6, count);
+    for (unsigned i = 0; i < ARRAY_SIZE(alarms); i++) {
+        TEST_ASSERT(!ztimer_is_set(z, &alarms[i]));
+    }
+
+    /* a target beyond the 16 bit range of the mock clock */
+    ztimer_set(z, &alarms[0], 0x20000ul);
+    ztimer_mock_advance(&zmock, 0x1ffff);
+    TEST_ASSERT_EQUAL_INT(6, count);
+    ztimer_mock_advance(&zmock, 1);
+    TEST_ASSERT_EQUAL_INT(7, count);
+
+    ztimer_release(z);
+}
+
 Test *tests_ztimer_mock_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -298,6 +363,7 @@ Test *tests_ztimer_mock_tests(void)
         new_TestFixture(test_ztimer_mock_set32),
         new_TestFixture(test_ztimer_mock_set16),
         new_TestFixture(test_ztimer_mock_is_set),
+        new_TestFixture(test_ztimer_mock_heap),
     };
 
     EMB_UNIT_TESTCALLER(ztimer_tests, NULL, NULL, fixtures);